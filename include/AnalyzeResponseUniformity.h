@@ -69,6 +69,13 @@ namespace QualityControl {
             
             //Actions - Methods that Do Something
             //------------------------------------------------------------------------------------------------------------------------------------------
+            //Parallel Filling********
+            //Prepares inputDetWorker, a copy of the detector, to be filled by one thread: its physics objects are removed, its histograms are emptied
+            //& no longer shared, its run history summaries are cleared and only the per run histograms of the current run (iNum_Run) are kept
+            virtual void initHistosWorker(DetectorMPGD & inputDetWorker);
+            
+            //Adds the histograms, run history summaries & physics objects filled by one thread in inputDetWorker to inputDet
+            virtual void mergeHistosWorker(DetectorMPGD & inputDet, DetectorMPGD & inputDetWorker);
             
             //Getters - Methods that Get (i.e. Return) Something
             //------------------------------------------------------------------------------------------------------------------------------------------
@@ -88,6 +95,10 @@ namespace QualityControl {
         protected:
             //Actions - Methods that Do Something
             //------------------------------------------------------------------------------------------------------------------------------------------
+            //As above, for the histograms of one sector
+            void initHistosWorker(HistosPhysObj & inputHistosWorker);
+            void mergeHistosWorker(HistosPhysObj & inputHistos, HistosPhysObj & inputHistosWorker);
+            
             //Calculates Summary Statistics
             void calcStatistics(SummaryStatistics &inputStatObs, std::multiset<float> &mset_fInputObs, std::string strObsName);
             
@@ -104,6 +115,10 @@ namespace QualityControl {
             //Getters - Methods that Get (i.e. Return) Something
             //------------------------------------------------------------------------------------------------------------------------------------------
             
+            //Returns a fit-free estimate of the peak of hInput: the mode from a parabola through the maximum of the smoothed spectrum
+            //and the FWHM from the half maximum crossings (or, if one is outside the histogram, from the 15.87% & 84.13% quantiles)
+            PeakEstimate getPeakEstimate(std::shared_ptr<TH1F> hInput);
+            
             //Returns a fit whose parameters match those defined in the AnalysisSetupUniformity
             //TF1 getFit(int iEta, int iPhi, int iSlice, Timing::HistoSetup & setupHisto, std::shared_ptr<TH1F> hInput, TSpectrum &specInput );
             TF1 getFit(int iEta, int iPhi, int iSlice, Plotter::InfoFit & setupFit, std::shared_ptr<TH1F> hInput, TSpectrum &specInput );
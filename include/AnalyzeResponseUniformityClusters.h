@@ -12,11 +12,13 @@
 //C++ Includes
 #include <algorithm>
 #include <cmath>
+#include <fstream>
 #include <iterator>
 #include <map>
 #include <memory>
 #include <numeric>
 #include <set>
+#include <sstream>
 #include <stdio.h>
 #include <string>
 #include <vector>
@@ -24,6 +26,7 @@
 //Framework Includes
 #include "AnalyzeResponseUniformity.h"
 //#include "DetectorMPGD.h"
+#include "Logger.h"
 #include "ParameterLoaderDetector.h"
 #include "TimingUtilityFunctions.h"
 #include "TimingUtilityTypes.h"
@@ -32,6 +35,7 @@
 
 //ROOT Includes
 //#include "Math/MinimizerOptions.h"
+#include "TAxis.h"
 #include "TDirectory.h"
 #include "TF1.h"
 #include "TFitResult.h"
@@ -71,6 +75,10 @@ namespace QualityControl {
             //Loops over all slices in detMPGD and fits Booked histograms for the full detector
             virtual void fitHistos(DetectorMPGD & inputDet);
             
+            //Redefines the slices of each iPhi sector, in one pass over its clustADC_v_clustPos histogram, such that each slice holds at least
+            //aSetup.iUniformityMinClusters clusters; neighbouring slices are merged and populated ones split (into at most aSetup.iUniformitySplitMax pieces)
+            virtual void setSlicesAdaptive(DetectorMPGD & inputDet);
+            
             
             //Initialize**************
             //Loops through the detector and initializes all cluster graphs
@@ -120,21 +128,39 @@ namespace QualityControl {
             
             //Printers - Methods that Print Something
             //------------------------------------------------------------------------------------------------------------------------------------------
+            //Writes the converged parameters of the slice fits accepted by fitHistos(); can be read back by loadFitSeeds()
+            virtual void printFitSeeds(std::string & strOutputTextFileName);
             
             //Setters - Methods that Set Something
             //------------------------------------------------------------------------------------------------------------------------------------------
+            //Sets the fit seeds (e.g. from a previous run); slices with a seed covering the same position range start their fit from it
+            virtual void setFitSeeds(Uniformity::FitSeedStore & inputSeeds){ seedsInput = inputSeeds; return; };
             
         private:
             //Actions - Methods that Do Something
             //------------------------------------------------------------------------------------------------------------------------------------------
+            //Sets the x-bin range of inputSlice and its position & width from axisPos
+            void setSliceBins(SectorSlice & inputSlice, TAxis * axisPos, int iBinLow, int iBinHigh);
+            
+            //Sets the position -> slice lookup of inputSector from the bin ranges of its slices; iNPosBins is the number of position bins the ranges refer to
+            void setSliceLookup(ReadoutSectorPhi & inputSector, int iNPosBins);
             
             //Getters - Methods that Get (i.e. Return) Something
             //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns a copy of the 2D histogram strName in dirInput; nullptr if it is not found (e.g. 2D histograms were not booked)
+            std::shared_ptr<TH2F> getHisto2D(TDirectory * dirInput, const std::string & strName);
+            
+            //true -> a fit parameter with meaning strParamMeaning scales with the detector gain (i.e. PEAK, FWHM, HWHM, SIGMA)
+            bool isGainScaled(const std::string & strParamMeaning);
             
             //Data Members
             //------------------------------------------------------------------------------------------------------------------------------------------
-            
+            Uniformity::FitSeedStore seedsInput;    //Seeds the slice fits start from
+            Uniformity::FitSeedStore seedsOutput;   //Converged parameters of the accepted slice fits
         }; //End class AnalyzeResponseUniformityClusters
+        
+        //Loads fit seeds written by AnalyzeResponseUniformityClusters::printFitSeeds()
+        Uniformity::FitSeedStore loadFitSeeds(std::string & strInputTextFileName);
     } //End namespace Uniformity
 } //End namespace QualityControl
 
@@ -0,0 +1,127 @@
+//
+//  AnalyzeStripHealth.h
+//  
+//
+//
+//
+
+#ifndef ____AnalyzeStripHealth__
+#define ____AnalyzeStripHealth__
+
+//C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+//Framework Includes
+#include "DetectorMPGD.h"
+#include "FrameworkBase.h"
+#include "TimingUtilityFunctions.h"
+#include "UniformityUtilityFunctions.h"
+#include "UniformityUtilityTypes.h"
+
+//ROOT Includes
+
+namespace QualityControl {
+    namespace Uniformity {
+        //Health of a single readout strip
+        enum StripHealthStatus{
+            kStrip_Healthy = 0,     //Strip behaves like its neighbours in all runs
+            kStrip_Dead,            //Occupancy consistent with zero in all conclusive runs
+            kStrip_Hot,             //Occupancy far above the sector median in the majority of runs
+            kStrip_Intermittent,    //Dead in some conclusive runs, alive in others
+            kStrip_Unknown,         //Not enough statistics in any run to decide
+            kStrip_Masked           //Masked by the input strip mask (StripMask_File); its hits are rejected, so it is not tested
+        };
+
+        //Statistics of a single readout strip accumulated over many runs
+        struct StripHealthStats{
+            int iNRuns_Conclusive;  //Runs in which the sector had enough statistics for the dead strip test
+            int iNRuns_Dead;        //Runs in which the strip failed the dead strip test
+            int iNRuns_Hot;         //Runs in which the strip failed the hot strip test
+
+            long lOccupancy;        //Total number of selected hits over all runs
+            double dExpected;       //Total expected number of hits over all runs (sum of sector medians)
+
+            double dADC_Mean;       //Running mean of the hit ADC (Welford)
+            double dADC_M2;         //Running sum of squared deviations of the hit ADC (Welford)
+
+            StripHealthStats(){
+                iNRuns_Conclusive = iNRuns_Dead = iNRuns_Hot = 0;
+                lOccupancy = 0;
+                dExpected = dADC_Mean = dADC_M2 = 0.;
+            }
+        }; //End StripHealthStats
+
+        class AnalyzeStripHealth : public FrameworkBase {
+
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Default
+            AnalyzeStripHealth();
+
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Adds the hits stored in inputDet (assumed to be from a single run) to the per strip statistics
+            //Each strip is compared to the median occupancy of its iEta sector in this run
+            virtual void accumulateRun(DetectorMPGD & inputDet);
+
+            //Wipes all accumulated statistics
+            virtual void reset(){ map_stripStats.clear(); iNum_RunsAccumulated = 0; return; };
+
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the status of a strip based on all runs accumulated so far
+            virtual StripHealthStatus getStatus(const StripHealthStats & inputStats);
+
+            //As above for strip iStrip of sector iEta; kStrip_Masked if it is masked by the input strip mask
+            virtual StripHealthStatus getStatus(int iEta, int iStrip);
+
+            //Returns a mask where every dead, hot, intermittent, or already masked strip is set
+            virtual Uniformity::StripMask getStripMask();
+
+            //Printers - Methods that Print Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Writes the per strip statistics & status of every strip
+            virtual void printHealthReport(std::string & strOutputTextFileName);
+
+            //Writes the list of masked strips; can be read back by loadStripMask()
+            virtual void printStripMask(std::string & strOutputTextFileName);
+
+            //Setters - Methods that Set Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Sets the strip mask the selectors apply; masked strips have no hits and are left out of the dead/hot tests & the sector median
+            virtual void setStripMask(Uniformity::StripMask & inputMask){ maskStrips = inputMask; return; };
+
+        private:
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the poisson probability of observing lObs or fewer counts given an expectation dMean (lower tail only)
+            virtual double getPoissonCDF(long lObs, double dMean);
+
+            //Returns a string describing the input status
+            virtual std::string getStatusName(StripHealthStatus inputStatus);
+
+            //Attributes
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            int iNum_RunsAccumulated;
+
+            Uniformity::StripMask maskStrips;   //Strips rejected by the selectors
+
+            std::map<int, std::vector<StripHealthStats> > map_stripStats; //key value understood as iEta; vector index is the strip number
+        }; //End class AnalyzeStripHealth
+
+        //Loads a strip mask written by AnalyzeStripHealth::printStripMask()
+        Uniformity::StripMask loadStripMask(std::string & strInputTextFileName);
+    } //End namespace Uniformity
+} //End namespace QualityControl
+
+#endif /* defined(____AnalyzeStripHealth__) */
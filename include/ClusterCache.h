@@ -0,0 +1,184 @@
+//
+//  ClusterCache.h
+//  
+//
+//
+//
+
+#ifndef ____ClusterCache__
+#define ____ClusterCache__
+
+//C++ Includes
+#include <cstdint>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+//Framework Includes
+
+//ROOT Includes
+#include "TBranch.h"
+#include "TObjArray.h"
+#include "TTree.h"
+
+/*
+ * The cluster cache is a flat binary file holding the same information as the TCluster tree written by SRSOutputROOT.
+ * It is meant to be memory mapped and read with plain pointer arithmetic.
+ * Layout (native byte order):
+ *      ClusterCacheHeader                          (32 bytes)
+ *      ClusterCacheRecord [ulNClusters]            (24 bytes each, grouped by event)
+ *      uint64_t [ulNEvents + 1]                    index of the first cluster of each event; the last entry is ulNClusters
+ * Event i of the cache corresponds to entry i of the TCluster tree.
+ */
+
+namespace QualityControl {
+    namespace Uniformity {
+        const char strClusterCache_Magic[8] = {'G','E','M','C','L','U','S','T'};
+        const uint32_t uiClusterCache_Version = 1;
+        
+        //Extension given to cluster cache files, replaces the ".root" of the corresponding TFile
+        const std::string strClusterCache_Ext = ".clustcache";
+        
+        struct ClusterCacheHeader{
+            char cMagic[8];         //strClusterCache_Magic
+            uint32_t uiVersion;     //uiClusterCache_Version
+            uint32_t uiRecordSize;  //sizeof(ClusterCacheRecord)
+            uint64_t ulNEvents;     //Number of events
+            uint64_t ulNClusters;   //Number of clusters over all events
+        }; //End ClusterCacheHeader
+        
+        struct ClusterCacheRecord{
+            float fPlaneID;         //planeID branch of TCluster, i.e. iEta position of the cluster
+            float fPos;             //clustPos branch of TCluster
+            float fADC;             //clustADCs branch of TCluster
+            int32_t iSize;          //clustSize branch of TCluster
+            int32_t iTimeBin;       //clustTimebin branch of TCluster
+            int32_t iDetID;         //detID branch of TCluster
+        }; //End ClusterCacheRecord
+        
+        static_assert( sizeof(ClusterCacheHeader) == 32, "ClusterCacheHeader must be 32 bytes" );
+        static_assert( sizeof(ClusterCacheRecord) == 24, "ClusterCacheRecord must be 24 bytes" );
+        
+        class ClusterCacheWriter {
+            
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Default
+            ClusterCacheWriter();
+            
+            //Destructor
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            ~ClusterCacheWriter(){ close(); };
+            
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Appends one event holding iNClusters clusters
+            virtual void addEvent(const ClusterCacheRecord * ptr_Clusters, int iNClusters);
+            
+            //Writes the event index & the final header, then closes the file; returns false (and deletes the file) if any write failed
+            virtual bool close();
+            
+            //Opens strOutputFileName for writing; returns false on failure
+            virtual bool open(std::string strOutputFileName);
+            
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            virtual bool isOpen(){ return (file_Output != NULL); };
+            
+        private:
+            //Attributes
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            bool bWriteSuccess;     //false after a failed write, close() then deletes the partial file
+            
+            FILE * file_Output;
+            
+            std::string strFile_Output;
+            
+            std::vector<uint64_t> vec_ulEvtOffset; //Index of the first cluster of each event
+        }; //End class ClusterCacheWriter
+        
+        class ClusterCacheReader {
+            
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Default
+            ClusterCacheReader();
+            
+            //Destructor
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            ~ClusterCacheReader(){ close(); };
+            
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Unmaps the file
+            virtual void close();
+            
+            //Memory maps strInputFileName and checks its header & size; returns false if it is not a valid cluster cache
+            virtual bool open(std::string strInputFileName);
+            
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns a pointer to the first cluster of event iEvt; its clusters are contiguous
+            inline const ClusterCacheRecord * getClusters(int iEvt) const { return ptr_Records + ptr_EvtOffset[iEvt]; };
+            
+            //Returns the number of clusters in event iEvt
+            inline int getNumClusters(int iEvt) const { return (int)(ptr_EvtOffset[iEvt+1] - ptr_EvtOffset[iEvt]); };
+            
+            //Returns the number of events
+            inline int getNumEvents() const { return (ptr_Header == NULL) ? 0 : (int)ptr_Header->ulNEvents; };
+            
+            virtual bool isOpen(){ return (ptr_Header != NULL); };
+            
+        private:
+            //Attributes
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            size_t iFileSize;
+            
+            void * ptr_Map;
+            
+            const ClusterCacheHeader * ptr_Header;
+            const ClusterCacheRecord * ptr_Records;
+            const uint64_t * ptr_EvtOffset;
+        }; //End class ClusterCacheReader
+        
+        //Saves the branch statuses & addresses of a tree on construction and restores them on destruction
+        //Lets a function read a tree it does not own without disturbing the branch addresses of the caller
+        class TreeBranchState {
+            
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            TreeBranchState(TTree * inputTree);
+            
+            //Destructor
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            ~TreeBranchState();
+            
+        private:
+            //Attributes
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            TTree * tree_Input;
+            
+            std::vector<TBranch *> vec_Branches;
+            std::vector<char *> vec_ptrAddress;    //NULL if the caller set no address
+            std::vector<bool> vec_bStatus;
+        }; //End class TreeBranchState
+        
+        //Converts the TCluster tree of an amoreSRS/framework output file into a cluster cache; returns false on failure
+        //The branch statuses & addresses of tree_Clusters are left as the caller set them
+        bool convertClusterTree(TTree * tree_Clusters, std::string strOutputFileName);
+        
+        //Concatenates the events of the caches in vec_strInputFileNames, in order, into strOutputFileName; returns false on failure
+        bool mergeClusterCaches(const std::vector<std::string> & vec_strInputFileNames, std::string strOutputFileName);
+        
+        //Returns the name of the cluster cache belonging to strInputRootFileName
+        std::string getClusterCacheName(std::string strInputRootFileName);
+        
+        //Returns true if strCacheFileName exists and is not older than strInputRootFileName
+        bool isClusterCacheCurrent(std::string strCacheFileName, std::string strInputRootFileName);
+    } //End namespace Uniformity
+} //End namespace QualityControl
+
+#endif /* defined(____ClusterCache__) */
@@ -0,0 +1,138 @@
+//
+//  ComparisonInput.h
+//  
+//
+//
+//
+
+#ifndef ____ComparisonInput__
+#define ____ComparisonInput__
+
+//C++ Includes
+#include <iterator>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//Framework Includes
+#include "TimingUtilityFunctions.h"
+#include "UniformityUtilityFunctions.h"
+
+//ROOT Includes
+#include "TClass.h"
+#include "TDirectory.h"
+#include "TFile.h"
+#include "TH1.h"
+#include "TH1F.h"
+#include "TKey.h"
+#include "TROOT.h"
+
+namespace QualityControl {
+    namespace Uniformity {
+        //Key of a cached histogram: first -> index of the input file; second -> path of the histogram inside the file
+        typedef std::pair<int, std::string> ComparisonKey;
+
+        //Provides the histograms of a set of input files to VisualizeComparison
+        //Each input file is opened once and a key index of its contents is built when it is first accessed
+        //Histograms are only read when requested and are kept in a least recently used (LRU) cache
+        class ComparisonInput {
+            
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Default
+            ComparisonInput();
+            
+            //Destructor
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            ~ComparisonInput(){ close(); };
+            
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Closes all input files and wipes the cache & the key index
+            virtual void close();
+            
+            //Reads every histogram in vec_strPaths from every input file in vec_iFiles which is not cached yet
+            //Files are read in parallel by up to m_iNThreads threads; one thread handles a given file at a time
+            //The cache is grown to hold all of the prefetched histograms if needed
+            virtual void prefetch(std::vector<int> & vec_iFiles, std::vector<std::string> & vec_strPaths);
+            
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns a copy of the histogram found at strPath in input file iFile; the copy may be modified freely
+            //Returns a nullptr if the file cannot be opened or the histogram does not exist
+            virtual std::shared_ptr<TH1F> getHisto(int iFile, std::string strPath);
+            
+            //Returns the number of cache hits & misses
+            virtual int getNumCacheHits(){ return m_iNCacheHits; };
+            virtual int getNumCacheMisses(){ return m_iNCacheMisses; };
+            
+            //Returns the number of input files
+            virtual int getNumFiles(){ return m_vec_strFileList.size(); };
+            
+            //Setters - Methods that Set Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Sets the maximum number of histograms held in the cache
+            virtual void setCacheSize(int iInput){ m_iCacheSize = (iInput > 0) ? iInput : 1; return; };
+            
+            //Sets the input files; closes any previously opened file
+            virtual void setInputFiles(std::vector<std::string> vec_strInput){
+                close();
+                m_vec_strFileList = vec_strInput;
+                m_vec_fileInput.assign(m_vec_strFileList.size(), nullptr);
+                m_vec_map_strIndex.assign(m_vec_strFileList.size(), std::map<std::string, std::string>() );
+                return;
+            };
+            
+            //Sets the maximum number of threads used by prefetch()
+            virtual void setNThreads(int iInput){ m_iNThreads = iInput; return; };
+            
+        private:
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Adds inputHisto to the cache and drops the least recently used histograms beyond m_iCacheSize
+            virtual void addToCache(ComparisonKey & inputKey, std::shared_ptr<TH1F> inputHisto);
+            
+            //Recursively adds the path (key) and class name (value) of every object in dir_Input to map_strIndex
+            virtual void indexDirectory(TDirectory * dir_Input, std::string strPrefix, std::map<std::string, std::string> & map_strIndex);
+            
+            //Opens input file iFile & builds its key index if this has not been done yet; returns false if the file cannot be opened
+            virtual bool openFile(int iFile);
+            
+            //Reads all histograms in vec_strPaths from input file iFile into the cache; only called by prefetch()
+            virtual void prefetchFile(int iFile, std::vector<std::string> & vec_strPaths);
+            
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the cached histogram for inputKey (and marks it as most recently used); nullptr if not cached
+            virtual std::shared_ptr<TH1F> getFromCache(ComparisonKey & inputKey);
+            
+            //Reads the histogram at strPath from input file iFile; nullptr if it does not exist
+            virtual std::shared_ptr<TH1F> readHisto(int iFile, std::string & strPath);
+            
+            //Data Members
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            int m_iCacheSize;
+            int m_iNCacheHits, m_iNCacheMisses;
+            int m_iNThreads;
+            
+            std::list<std::pair<ComparisonKey, std::shared_ptr<TH1F> > > m_list_cache; //Front is the most recently used histogram
+            std::map<ComparisonKey, std::list<std::pair<ComparisonKey, std::shared_ptr<TH1F> > >::iterator > m_map_cacheIdx;
+            
+            std::mutex m_mutex_cache;
+            
+            std::vector<std::string> m_vec_strFileList;
+            std::vector<TFile *> m_vec_fileInput;
+            std::vector<std::map<std::string, std::string> > m_vec_map_strIndex; //Per file; key -> path of object inside the file; value -> class name
+        }; //End class ComparisonInput
+    } //End namespace Uniformity
+} //End namespace QualityControl
+
+#endif /* defined(____ComparisonInput__) */
@@ -39,6 +39,8 @@ namespace QualityControl {
             friend class AnalyzeResponseUniformity;
             friend class AnalyzeResponseUniformityClusters;
             friend class AnalyzeResponseUniformityHits;
+            friend class AnalyzeStripHealth;
+            friend class MemoryReport;
             
         public:
             //Constructors
@@ -141,6 +143,9 @@ namespace QualityControl {
             //Returns clusters for a given (iEta,iPhi value)
             virtual std::multimap<int, Cluster> getClusters(int iEta, int iPhi);
             
+            //returns the iEta sector matching an input Y position (e.g. planeID from amoreSRS); -1 if no match
+            virtual int getEtaIdx(float fInputPos_Y);
+            
             //returns the position of an iEta sector
             virtual float getEtaPos(int iEta);
             
@@ -172,6 +177,9 @@ namespace QualityControl {
             //returns the phi sector
             virtual ReadoutSectorPhi getPhiSector(int iEta, int iPhi);
             
+            //returns the strip number (in the strip numbering of amoreSRS) of an input X position in sector iEta; -1 if no match
+            virtual int getStripNum(int iEta, float fInputPos_X);
+            
             //returns the summary statistics
             virtual SummaryStatistics getStatNormChi2(){ return statClustADC_Fit_NormChi2; };
             virtual SummaryStatistics getStatPkPos(){ return statClustADC_Fit_PkPos; };
@@ -0,0 +1,144 @@
+//
+//  EventIndex.h
+//  
+//
+//
+//
+
+#ifndef ____EventIndex__
+#define ____EventIndex__
+
+//C++ Includes
+#include <cstdint>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+//Framework Includes
+
+//ROOT Includes
+#include "TFile.h"
+#include "TTree.h"
+
+/*
+ * The event index is a small sidecar file holding, for each event of an input ROOT file, the cluster & hit multiplicity
+ * (in total and per planeID) together with a short summary of the event.  The selectors use it to apply the multiplicity
+ * cut without touching the TCluster/THit trees, so only the events which pass are read from the trees.
+ * Layout (native byte order):
+ *      EventIndexHeader                            (32 bytes)
+ *      float [uiNPlanes]                           planeID of each plane, in increasing order
+ *      EventIndexRecord [ulNEvents]                (16 bytes each)
+ *      uint16_t [ulNEvents * uiNPlanes]            cluster multiplicity of each event & plane (event major)
+ *      uint16_t [ulNEvents * uiNPlanes]            hit multiplicity of each event & plane (event major)
+ * Event i of the index corresponds to entry i of the TCluster and/or THit tree.
+ */
+
+namespace QualityControl {
+    namespace Uniformity {
+        const char strEventIndex_Magic[8] = {'G','E','M','E','V','I','D','X'};
+        const uint32_t uiEventIndex_Version = 1;
+
+        //Flags stored in EventIndexHeader::uiFlags
+        const uint32_t uiEventIndex_HasClusters = 0x1;
+        const uint32_t uiEventIndex_HasHits     = 0x2;
+
+        //Extension given to event index files, replaces the ".root" of the corresponding TFile
+        const std::string strEventIndex_Ext = ".evtidx";
+
+        struct EventIndexHeader{
+            char cMagic[8];         //strEventIndex_Magic
+            uint32_t uiVersion;     //uiEventIndex_Version
+            uint32_t uiFlags;       //uiEventIndex_HasClusters | uiEventIndex_HasHits
+            uint64_t ulNEvents;     //Number of events
+            uint32_t uiNPlanes;     //Number of distinct planeID's
+            uint32_t uiRecordSize;  //sizeof(EventIndexRecord)
+        }; //End EventIndexHeader
+
+        struct EventIndexRecord{
+            int32_t iNClusters;     //nclust branch of TCluster
+            int32_t iNHits;         //nch branch of THit
+            float fClustADC_Sum;    //Sum of clustADCs over all clusters of the event
+            float fClustADC_Max;    //Largest clustADCs of the event
+        }; //End EventIndexRecord
+
+        static_assert( sizeof(EventIndexHeader) == 32, "EventIndexHeader must be 32 bytes" );
+        static_assert( sizeof(EventIndexRecord) == 16, "EventIndexRecord must be 16 bytes" );
+
+        class EventIndex {
+
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Default
+            EventIndex();
+
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Builds the index from the TCluster and/or THit trees of file_InputRootFile, only the multiplicity, planeID & clustADCs branches are read
+            //The branch statuses & addresses already set on the trees are left untouched; returns false if neither tree is found
+            virtual bool build(TFile * file_InputRootFile);
+
+            //Clears the index
+            virtual void clear();
+
+            //Reads strInputFileName; returns false if it is not a valid event index
+            virtual bool read(std::string strInputFileName);
+
+            //Writes the index to strOutputFileName; returns false on failure
+            virtual bool write(std::string strOutputFileName);
+
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the number of events
+            inline int getNumEvents() const { return (int)vec_Records.size(); };
+
+            //Returns the number of planes
+            inline int getNumPlanes() const { return (int)vec_fPlaneID.size(); };
+
+            //Returns the number of clusters in event iEvt
+            inline int getNumClusters(int iEvt) const { return vec_Records[iEvt].iNClusters; };
+
+            //Returns the number of clusters in event iEvt on plane iPlane (see getPlaneIdx())
+            inline int getNumClusters(int iEvt, int iPlane) const { return vec_usPlaneClusters[ (size_t)iEvt * vec_fPlaneID.size() + iPlane ]; };
+
+            //Returns the number of hits in event iEvt
+            inline int getNumHits(int iEvt) const { return vec_Records[iEvt].iNHits; };
+
+            //Returns the number of hits in event iEvt on plane iPlane (see getPlaneIdx())
+            inline int getNumHits(int iEvt, int iPlane) const { return vec_usPlaneHits[ (size_t)iEvt * vec_fPlaneID.size() + iPlane ]; };
+
+            //Returns the index of the plane whose planeID is fPlaneID; -1 if there is no such plane
+            virtual int getPlaneIdx(float fPlaneID) const;
+
+            //Returns the planeID of plane iPlane
+            inline float getPlaneID(int iPlane) const { return vec_fPlaneID[iPlane]; };
+
+            //Returns the summary of event iEvt
+            inline const EventIndexRecord & getRecord(int iEvt) const { return vec_Records[iEvt]; };
+
+            virtual bool hasClusters() const { return (uiFlags & uiEventIndex_HasClusters); };
+            virtual bool hasHits() const { return (uiFlags & uiEventIndex_HasHits); };
+
+        private:
+            //Attributes
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            uint32_t uiFlags;
+
+            std::vector<float> vec_fPlaneID;            //planeID of each plane, in increasing order
+
+            std::vector<uint16_t> vec_usPlaneClusters;  //Cluster multiplicity of each event & plane
+            std::vector<uint16_t> vec_usPlaneHits;      //Hit multiplicity of each event & plane
+
+            std::vector<EventIndexRecord> vec_Records;  //Summary of each event
+        }; //End class EventIndex
+
+        //Returns the name of the event index belonging to strInputRootFileName
+        std::string getEventIndexName(std::string strInputRootFileName);
+
+        //Loads the event index belonging to file_InputRootFile into inputIndex
+        //The index is (re)built from the file if it is missing, older than the file, or lacks the requested tree; returns false on failure
+        bool loadEventIndex(TFile * file_InputRootFile, EventIndex & inputIndex, bool bNeedClusters, bool bNeedHits);
+    } //End namespace Uniformity
+} //End namespace QualityControl
+
+#endif /* defined(____EventIndex__) */
@@ -0,0 +1,104 @@
+//
+//  InputChain.h
+//  
+//
+//
+//
+
+#ifndef ____InputChain__
+#define ____InputChain__
+
+//C++ Includes
+#include <fcntl.h>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+//Framework Includes
+#include "TimingUtilityFunctions.h"
+#include "UniformityUtilityFunctions.h"
+
+//ROOT Includes
+#include "TChain.h"
+#include "TFile.h"
+#include "TROOT.h"
+#include "TTree.h"
+
+/*
+ * The input chain reads several amoreSRS output files as one logical run.  open() visits the files in parallel (one TFile
+ * per file and thread), records the number of entries of each requested tree, and asks the kernel to read ahead each file
+ * (posix_fadvise WILLNEED) so the data are already paged in when the chain reaches them.  getChain() then returns a TChain
+ * built with the known number of entries per file, so the chain never opens the files one after another just to count
+ * them; the event number is the global entry number of the chain and getEventRange() spans all files.
+ */
+
+namespace QualityControl {
+    namespace Uniformity {
+        class InputChain {
+
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Default
+            InputChain();
+
+            //Set the input files at construction
+            InputChain(std::vector<std::string> vec_strInputFiles);
+
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Forgets the files & the entries found by open()
+            virtual void close();
+
+            //Visits all input files, in parallel if iNThreads > 1, and records the entries of each tree in vec_strTreeNames
+            //Returns false if no input file could be opened
+            virtual bool open(std::vector<std::string> vec_strTreeNames);
+
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns a TChain of the tree strTreeName over all input files; files which lack the tree are skipped
+            //The caller owns the TChain; returns nullptr if no file has the tree
+            virtual TChain * getChain(std::string strTreeName);
+
+            //Returns the number of input files
+            virtual int getNumFiles(){ return vec_strFiles.size(); };
+
+            //Returns the total number of entries of strTreeName over all input files
+            virtual long long getNumEntries(std::string strTreeName);
+
+            //Setters - Methods that Set Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Sets the input files
+            virtual void setInputFiles(std::vector<std::string> vec_strInputFiles){ close(); vec_strFiles = vec_strInputFiles; return; };
+
+            //Sets the number of threads used to open the files
+            virtual void setNThreads(int iInput){ iNThreads = iInput; return; };
+
+            //Sets the size of the TTreeCache of the chains
+            virtual void setCacheSize(long long llInput){ llCacheSize = llInput; return; };
+
+        private:
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Asks the kernel to read ahead file iFile & records the entries of each requested tree
+            void openFile(int iFile, std::vector<std::string> & vec_strTreeNames);
+
+            //Attributes
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            int iNThreads;              //Threads used by open()
+
+            long long llCacheSize;      //TTreeCache size of the chains (bytes)
+
+            std::vector<std::string> vec_strFiles;  //Input files, in the order they are chained
+
+            std::map<std::string, std::vector<long long> > map_llEntries;   //key -> tree name; value -> entries in each file (-1 -> file or tree missing)
+        }; //End class InputChain
+    } //End namespace Uniformity
+} //End namespace QualityControl
+
+#endif /* defined(____InputChain__) */
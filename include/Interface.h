@@ -18,6 +18,7 @@
 #include "DetectorMPGD.h"   //Needs to be included before AnalyzeResponseUniformity.h
 #include "AnalyzeResponseUniformityClusters.h"
 #include "AnalyzeResponseUniformityHits.h"
+#include "AnalyzeStripHealth.h"
 #include "UniformityUtilityTypes.h"
 #include "VisualizeUniformity.h"
 
@@ -74,6 +75,7 @@ namespace QualityControl {
             //Analyzers
             AnalyzeResponseUniformityClusters clustAnalyzer;
             AnalyzeResponseUniformityHits hitAnalyzer;
+            AnalyzeStripHealth stripHealth;
             
             //Selectors
             SelectorCluster clustSelector;
@@ -13,6 +13,7 @@
 #include <map>
 #include <stdio.h>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -25,12 +26,18 @@
 //#include "ParameterLoaderAmoreSRS.h"
 //#include "ParameterLoaderAnaysis.h"
 //#include "ParameterLoaderRun.h"
+#include "ClusterCache.h"
+#include "EventIndex.h"
+#include "InputChain.h"
 #include "Interface.h"
 #include "InterfaceRun.h"
+#include "MemoryReport.h"
 #include "UniformityUtilityTypes.h"
+#include "VisualizeRenderPool.h"
 //#include "VisualizeUniformity.h"
 
 //ROOT Includes
+#include "TChain.h"
 #include "TROOT.h"
 #include "TFile.h"
 
@@ -101,6 +108,17 @@ namespace QualityControl {
             //Runs the analysis framework on input created by the CMS_GEM_AnalysisFramework
             virtual void analyzeInputFrmwrk();
             
+            //Estimates the memory held by detMPGD after the iRunIdx'th input file, prints it if requested, and enforces aSetup.fMemory_Budget
+            //by switching off the run histories (bRunHistory) of the remaining files; a warning is printed if the budget is still exceeded
+            virtual void checkMemory(int iRunIdx);
+            
+            //Splits the selection & histogram filling of the hits (bClusters false) or clusters (bClusters true) of one run over rSetup.iAna_NThreads threads
+            //Each thread reads a contiguous part of the event range with its own reader & selector into its own copy of detMPGD; the copies are merged into detMPGD
+            virtual void fillHistosParallel(bool bClusters, std::string strInputFile, InputChain & chainInput, bool bChained);
+            
+            //Closes the input of one run of analyzeInputAmoreSRS(); either the TFile or the chains (any may be NULL)
+            virtual void closeInputAmoreSRS(TFile * file_ROOTInput, TChain * chain_Clusters, TChain * chain_Hits);
+            
             //Stores the results of the analysis based on rSetup
             virtual void storeResults(TFile * file_Results, std::string strFileName);
             
@@ -115,6 +133,9 @@ namespace QualityControl {
             
             //Attributes
             //------------------------------------------------------------------------------------------------------------------------------------------
+            bool bRunHistory;       //true -> book the per run histograms of each input file
+            
+            int iNRunHistory;       //Number of input files whose per run histograms were booked
             
             std::vector<std::pair<int, std::string> > vec_pairedRunList; //vec_pairedRunList[i].first -> Run number; vec_pairedRunList[i].second -> filename
             //std::vector<std::string> vec_strRunList;
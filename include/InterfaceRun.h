@@ -20,6 +20,7 @@
 //Framework Includes
 //#include "DetectorMPGD.h"
 #include "Interface.h"
+#include "Logger.h"
 #include "UniformityUtilityTypes.h"
 
 //ROOT Includes
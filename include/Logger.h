@@ -0,0 +1,152 @@
+//
+//  Logger.h
+//
+//
+//
+//
+
+#ifndef ____Logger__
+#define ____Logger__
+
+//C++ Includes
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <stdio.h>
+#include <string>
+
+//Framework Includes
+
+//ROOT Includes
+
+/*
+ * The logger is the single place diagnostics of the reconstruction & analysis go through.  Each message has a level and a
+ * category (usually "Class::method()"); messages below the threshold level are dropped before being formatted.  Each
+ * category may print a burst of iBurst lines, then at most fLinesPerSec lines per second; the lines beyond that are only
+ * counted and the count is reported with the next line of the category & in the summary.  Hot paths (per event, per APV)
+ * should not print at all but increment a counter, the counters are printed by printSummary().  A hot path registers its
+ * counter once with registerCounter() and increments it through the returned handle: one relaxed atomic add, no lock.
+ * Lines go to std::cout, or to a log file when one is set.  All methods are thread safe.
+ */
+
+namespace QualityControl {
+    namespace Uniformity {
+        enum LogLevel{
+            kLogDebug = 0,
+            kLogInfo,
+            kLogWarning,
+            kLogError,
+            kLogSilent      //Threshold only, nothing is printed
+        }; //End LogLevel
+
+        class Logger {
+
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the logger of the process
+            static Logger & getInstance();
+
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Increments the counter iCounter (from registerCounter()) by lIncrement; nothing is printed, lock free
+            inline void count(int iCounter, long lIncrement = 1){
+                if ( iCounter >= 0 && iCounter < iMaxCounters ) arr_lCounters[iCounter].fetch_add(lIncrement, std::memory_order_relaxed);
+            };
+
+            //As above, looking the counter up by name; for code run rarely, hot paths use a handle
+            virtual void count(const std::string & strCategory, long lIncrement = 1);
+
+            //Prints strMsg under strCategory if eLevel passes the threshold & the category is not over its rate
+            virtual void log(LogLevel eLevel, const std::string & strCategory, const std::string & strMsg);
+
+            //printf-like version of log(); the message is formatted only if it is printed
+            virtual void logf(LogLevel eLevel, const std::string & strCategory, const char * cFormat, ...);
+
+            //Prints the counters & the number of suppressed lines of each category
+            virtual void printSummary();
+
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the counter strCategory
+            virtual long getCount(const std::string & strCategory);
+
+            //true -> a message of level eLevel would be printed; cheap, to guard the formatting of messages
+            virtual bool isEnabled(LogLevel eLevel) const {
+                int iLevel = iThreshold.load(std::memory_order_relaxed);
+
+                return eLevel >= iLevel && iLevel != kLogSilent;
+            };
+
+            //Returns the handle of the counter strCategory, registering it on first use; -1 if iMaxCounters are already registered
+            virtual int registerCounter(const std::string & strCategory);
+
+            //Setters - Methods that Set Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Messages below eLevel are dropped
+            virtual void setLevel(LogLevel eLevel){ iThreshold.store(eLevel, std::memory_order_relaxed); };
+
+            //Sets the level from its name {DEBUG, INFO, WARNING, ERROR, SILENT} (case-insensitive); unknown names leave it unchanged
+            virtual void setLevel(std::string strLevel);
+
+            //Lines go to strFileName (appended), an empty name goes back to std::cout
+            virtual void setLogFile(std::string strFileName);
+
+            //Each category prints a burst of iBurstInput lines, then fLinesPerSecInput lines per second (<= 0 -> no limit)
+            virtual void setRateLimit(float fLinesPerSecInput, int iBurstInput);
+
+        private:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Default
+            Logger();
+            Logger(const Logger &);
+            Logger & operator=(const Logger &);
+
+            //Rate limiting & suppressed lines of one category
+            struct CategoryState{
+                double dTokens;         //Lines the category may still print now
+                long lSuppressed;       //Lines dropped since the last one printed
+                long lSuppressedTotal;  //Lines dropped over the job
+
+                std::chrono::steady_clock::time_point timeLast; //Last refill of dTokens
+
+                CategoryState(){
+                    dTokens = -1;
+                    lSuppressed = lSuppressedTotal = 0;
+                }
+            }; //End CategoryState
+
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //true -> strCategory may print one more line now; call with mutexLog locked
+            bool acquire(CategoryState & inputState);
+
+            //Writes one line; call with mutexLog locked
+            void write(LogLevel eLevel, const std::string & strCategory, const std::string & strMsg, long lSuppressed);
+
+            //Attributes
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            static const int iMaxCounters = 256;
+
+            std::atomic<int> iThreshold;    //LogLevel; read without the lock by every thread logging
+
+            float fLinesPerSec; //Lines per second & category after the burst, <= 0 -> no limit
+            int iBurst;         //Lines a category may print at once
+
+            std::ofstream fileLog;
+
+            std::map<std::string, CategoryState> map_CategoryStates;
+            std::map<std::string, int> map_CounterIdx;     //Name -> handle of the registered counters
+
+            std::atomic<long> arr_lCounters[iMaxCounters];  //Fixed size, a handle stays valid while others are registered
+
+            std::mutex mutexLog;
+        }; //End class Logger
+    } //End namespace Uniformity
+} //End namespace QualityControl
+
+#endif /* defined(____Logger__) */
@@ -0,0 +1,112 @@
+//
+//  MemoryReport.h
+//  
+//
+//
+//
+
+#ifndef ____MemoryReport__
+#define ____MemoryReport__
+
+//C++ Includes
+#include <map>
+#include <stdio.h>
+#include <string>
+
+//Framework Includes
+#include "DetectorMPGD.h"
+#include "UniformityUtilityTypes.h"
+
+//ROOT Includes
+#include "TF1.h"
+#include "TGraphErrors.h"
+#include "TH1F.h"
+#include "TH2F.h"
+
+/*
+ * The memory report estimates the heap held by the analysis objects of a DetectorMPGD: the histograms of each
+ * HistosPhysObj (1D, 2D, the per run histories & the run history summaries), the slice histograms & fits, the iEta graphs and the stored
+ * clusters & hits.  Sizes are computed from the object contents (bins, points, parameters, container nodes) and do not
+ * include the ROOT bookkeeping (e.g. TClass, gROOT lists); they are meant for budgeting, not for exact accounting.
+ */
+
+namespace QualityControl {
+    namespace Uniformity {
+        //Categories of the report
+        const std::string strMemCat_Histos1D    = "Histos1D";
+        const std::string strMemCat_Histos2D    = "Histos2D";
+        const std::string strMemCat_RunHistory  = "RunHistory";
+        const std::string strMemCat_Slices      = "Slices";
+        const std::string strMemCat_Fits        = "Fits";
+        const std::string strMemCat_Graphs      = "Graphs";
+        const std::string strMemCat_Clusters    = "Clusters";
+        const std::string strMemCat_Hits        = "Hits";
+
+        struct MemoryUsage{
+            long lNObjects; //Number of objects
+            long lBytes;    //Estimated bytes held by these objects
+
+            MemoryUsage(){
+                lNObjects = lBytes = 0;
+            }
+        }; //End MemoryUsage
+
+        class MemoryReport {
+
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Default
+            MemoryReport();
+
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Adds the objects held by inputDet to the report
+            virtual void accumulate(DetectorMPGD & inputDet);
+
+            //Clears the report
+            virtual void clear(){ map_Usage.clear(); return; };
+
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the estimated bytes in category strCategory
+            virtual long getBytes(const std::string & strCategory);
+
+            //Returns the estimated bytes over all categories
+            virtual long getBytesTotal();
+
+            //Returns the number of objects in category strCategory
+            virtual long getNObjects(const std::string & strCategory);
+
+            //Printers - Methods that Print Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Prints the bytes & number of objects in each category
+            virtual void printReport();
+
+        private:
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Adds the histograms of inputHistos to the report
+            void accumulate(HistosPhysObj & inputHistos);
+
+            //Adds one object of lBytes to strCategory
+            void add(const std::string & strCategory, long lBytes);
+
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Estimated bytes of an object; zero for nullptr
+            long getBytes(TH1F * hInput);
+            long getBytes(TH2F * hInput);
+            long getBytes(TGraphErrors * gInput);
+            long getBytes(TF1 * fitInput);
+            long getBytes(const Hit & inputHit);
+            long getBytes(const Cluster & inputCluster);
+
+            //Data Members
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            std::map<std::string, MemoryUsage> map_Usage;   //key -> category (strMemCat_*)
+        }; //End class MemoryReport
+    } //End namespace Uniformity
+} //End namespace QualityControl
+
+#endif /* defined(____MemoryReport__) */
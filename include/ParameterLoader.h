@@ -11,6 +11,7 @@
 
 //C++ Includes
 #include <algorithm>
+#include <glob.h>
 #include <iostream>
 #include <stdio.h>
 #include <string>
@@ -56,7 +57,9 @@ namespace QualityControl {
             };
             
             //Gets the list of input runs from the input config file
-            std::vector<std::pair<int, std::string> > getPairedRunList(std::ifstream &file_Input, std::string strIdent, bool bVerboseMode);
+            //Each line of the run list is a comma separated list of files and/or glob patterns
+            //bChain == false -> one run per file; bChain == true -> one run per line, the files are given as a comma separated list (run number taken from the first file)
+            std::vector<std::pair<int, std::string> > getPairedRunList(std::ifstream &file_Input, std::string strIdent, bool bVerboseMode, bool bChain = false);
             std::vector<std::string> getRunList(std::ifstream &file_Input, bool bVerboseMode);
             
             //Printers - Methods that Print Something
@@ -77,6 +80,9 @@ namespace QualityControl {
         protected:
             //Getters - Methods that Get (i.e. Return) Something
             //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the files of a run list line; a comma separated list of files and/or glob patterns, patterns are expanded in alphabetical order
+            std::vector<std::string> getExpandedFileList(std::string strInput);
+            
             //Gets the run number from an input run name
             int getRunNumber(std::string strRunName, std::string strIdent);
             
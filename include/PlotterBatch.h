@@ -0,0 +1,99 @@
+//
+//  PlotterBatch.h
+//  
+//
+//
+//
+
+#ifndef ____PlotterBatch__
+#define ____PlotterBatch__
+
+//C++ Includes
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+//Framework Includes
+#include "ParameterLoaderPlotter.h"
+#include "PlotterGeneric.h"
+#include "PlotterGraph.h"
+#include "PlotterGraph2D.h"
+#include "PlotterGraphErrors.h"
+#include "PlotterHisto.h"
+#include "PlotterHisto2D.h"
+#include "PlotterUtilityTypes.h"
+#include "QualityControlSectionNames.h"
+#include "TimingUtilityFunctions.h"
+
+//ROOT Includes
+#include "TCanvas.h"
+#include "TROOT.h"
+
+namespace QualityControl {
+    namespace Plotter {
+        class PlotterBatch {
+            
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Default
+            PlotterBatch();
+            
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Adds a plot config file to the batch
+            virtual void addConfig(std::string strInputConfig){ m_vec_strConfigs.push_back(strInputConfig); return; };
+            
+            //Renders every plot config file in headless (batch) mode & saves the requested image formats
+            //No output ROOT file is written; each worker draws all of its plots on a single canvas which is cleared after each plot is saved
+            //iNWorkers <= 1 -> configs are rendered serially in this process
+            //iNWorkers > 1  -> configs are dealt round-robin to forked processes (ROOT graphics is not thread-safe)
+            //Returns the number of config files that could not be plotted
+            virtual int render();
+            
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the number of stored config files
+            virtual int getNumConfigs(){ return m_vec_strConfigs.size(); };
+            
+            //Setters - Methods that Set Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Sets the image file formats to save, e.g. {"png","pdf","svg"}
+            virtual void setImgFormats(std::vector<std::string> vec_strInput){ m_vec_strImgFormats = vec_strInput; return; };
+            
+            //Sets the number of worker processes
+            virtual void setNWorkers(int iInput){ m_iNWorkers = iInput; return; };
+            
+            //Sets the verbose mode
+            virtual void setVerboseMode(bool bInput){ m_bVerboseMode = bInput; return; };
+            
+        private:
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Renders a single plot config file on inputCanvas; returns true if successful
+            virtual bool plotConfig(std::string & strInputConfig, std::shared_ptr<TCanvas> inputCanvas);
+            
+            //Renders the configs assigned to worker iWorker; returns the number of failures
+            virtual int runWorker(int iWorker, int iNWorkers);
+            
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns a new plotter for the plot type given; nullptr if the type is not recognized
+            virtual std::shared_ptr<PlotterGeneric> getPlotter(std::string & strPlotType);
+            
+            //Attributes
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            bool m_bVerboseMode;
+            
+            int m_iNWorkers;
+            
+            std::vector<std::string> m_vec_strConfigs;
+            std::vector<std::string> m_vec_strImgFormats;
+        }; //End class PlotterBatch
+    } //End namespace Plotter
+} //End namespace QualityControl
+
+#endif /* defined(____PlotterBatch__) */
@@ -15,6 +15,7 @@
 #include <stdio.h>
 #include <string>
 #include <tuple>
+#include <vector>
 
 //Framework Includes
 #include "CMS_lumi.h"
@@ -57,6 +58,10 @@ namespace QualityControl {
             //Saves output to a ROOT file
             virtual void plotAndStore();
             
+            //Clears the canvas & releases it (unless it was supplied with setCanvas())
+            //Any fits drawn on it are released as well
+            virtual void releaseCanvas();
+            
             //Getters - Methods that Get (i.e. Return) Something
             //------------------------------------------------------------------------------------------------------------------------------------------
             
@@ -68,6 +73,16 @@ namespace QualityControl {
             //Sets the flag for automatically saving canvases
             virtual void setAutoSaveCanvas(bool bInput){ m_bSaveCanvases = bInput; return; };
             
+            //Sets the flag for writing the canvas & plots to the output ROOT file
+            virtual void setAutoWriteRootFile(bool bInput){ m_bWriteRootFile = bInput; return; };
+            
+            //Sets the flag for releasing the canvas immediately after it has been saved
+            virtual void setAutoReleaseCanvas(bool bInput){ m_bReleaseCanvas = bInput; return; };
+            
+            //Supplies an existing canvas to draw on instead of creating a new one
+            //The canvas is cleared, renamed, and resized by initCanv()
+            virtual void setCanvas(std::shared_ptr<TCanvas> inputCanvas){ m_canv = inputCanvas; m_bExternalCanvas = (inputCanvas != nullptr); return; };
+            
             //Sets the canvas parameters
             virtual void setCanvasParameters(InfoCanvas & inputCanvInfo){
                 m_canvInfo = inputCanvInfo;
@@ -102,6 +117,13 @@ namespace QualityControl {
                 return;
             }
             
+            //Sets the image file formats written by save2ImgFile(), e.g. {"png","pdf","svg"}
+            //Each entry is used as the file extension given to TCanvas::SaveAs()
+            virtual void setImgFormats(std::vector<std::string> vec_strInput){
+                m_vec_strImgFormats = vec_strInput;
+                return;
+            }
+            
             //Sets the output TFile name & option
             virtual void setOutputNameNOption(std::string  strInputName, std::string strInputOption){
                 m_strOutputFile_Name    = strInputName;
@@ -166,7 +188,7 @@ namespace QualityControl {
             //To be over-ridded by inherited classes
             virtual void performAndDrawFit(TLegend & inputLegend, InfoFit & fitInfo, InfoPlot & plotInfo);
 
-            //Saves the canvas as a *.png and a *.pdf file
+            //Saves the canvas in each of the formats stored in m_vec_strImgFormats
             virtual void save2ImgFile(std::shared_ptr<TCanvas> inputCanvas);
             
             //Saves all TObjects to an output ROOT file
@@ -193,6 +215,9 @@ namespace QualityControl {
             bool m_bIsPrelim;
             bool m_bMonoColor;
             bool m_bSaveCanvases;
+            bool m_bWriteRootFile;
+            bool m_bReleaseCanvas;
+            bool m_bExternalCanvas; //True -> m_canv was supplied by setCanvas() and is only cleared, never released
             
             int m_iLogoPos; //Determines CMS Logo position
             //int m_iSameNamePlotCount; //Tracks How Many Plots have the same TName
@@ -204,6 +229,8 @@ namespace QualityControl {
             std::string m_strOutputFile_Name;
             std::string m_strOutputFile_Option;
             
+            std::vector<std::string> m_vec_strImgFormats; //Extensions of the image files written by save2ImgFile()
+            
             InfoCanvas m_canvInfo;
             
             std::shared_ptr<TStyle> m_tdrStyle;
@@ -12,6 +12,7 @@
 //C++ Includes
 #include <map>
 #include <stdio.h>
+#include <vector>
 
 //Framework Includes
 #include "ReadoutSector.h"
@@ -44,9 +45,22 @@ namespace QualityControl{
             
             std::map<int, Uniformity::SectorSlice> map_slices;  //Slices of this sector
             
+            std::vector<int> vec_iSliceByPosBin;    //Key in map_slices of each of vec_iSliceByPosBin.size() equal position bins spanning [fPos_Xlow, fPos_Xhigh)
+            
             std::multimap<int, Uniformity::Cluster> map_clusters;   //key value understood as event number
             std::multimap<int, Uniformity::Hit> map_hits;           //key value understood as event number
             
+            //Getters
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the key in map_slices of the slice containing fPos; -1 if fPos is outside the sector or the lookup is not set
+            inline int getSliceByPos(float fPos) const {
+                if ( vec_iSliceByPosBin.empty() || !( fPos >= fPos_Xlow && fPos < fPos_Xhigh ) ) return -1;
+                
+                int iBin = (int)( ( fPos - fPos_Xlow ) / ( fPos_Xhigh - fPos_Xlow ) * vec_iSliceByPosBin.size() );
+                
+                return ( iBin < vec_iSliceByPosBin.size() ) ? vec_iSliceByPosBin[iBin] : -1;
+            };
+            
             //Operators
             //------------------------------------------------------------------------------------------------------------------------------------------
             //Assignment operator
@@ -63,6 +77,7 @@ namespace QualityControl{
                     iStripNum_Max = other.iStripNum_Max;
                     
                     map_slices  = other.map_slices;
+                    vec_iSliceByPosBin = other.vec_iSliceByPosBin;
                     map_hits    = other.map_hits;
                     map_clusters= other.map_clusters;
                     
@@ -0,0 +1,134 @@
+//
+//  RunHistoryStore.h
+//  
+//
+//
+//
+
+#ifndef ____RunHistoryStore__
+#define ____RunHistoryStore__
+
+//C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+//Framework Includes
+
+//ROOT Includes
+#include "TGraphErrors.h"
+#include "TH2F.h"
+#include "TROOT.h"
+
+/*
+ * The run history store summarizes an observable (e.g. cluster ADC) of one sector as a function of the run number in a fixed
+ * amount of memory.  Each history bin covers iRunsPerBin consecutive runs (in the order they are filled) and holds the count,
+ * sum, sum of squares, and a quantile sketch (a coarse histogram of iNBinsSketch bins over the observable range) of the values
+ * filled in those runs.  When more than iNBinsMax history bins are needed neighbouring bins are merged pairwise and
+ * iRunsPerBin doubles, so the memory does not grow with the number of runs.
+ */
+
+namespace QualityControl {
+    namespace Uniformity {
+        class RunHistoryStore {
+
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Default
+            RunHistoryStore();
+
+            //Sets at most iNBinsMax history bins, each with a quantile sketch of iNBinsSketch bins over [fLower, fUpper)
+            RunHistoryStore(int iNBinsMax, int iNBinsSketch, float fLower, float fUpper);
+
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Clears the history, the binning is kept
+            virtual void clear();
+
+            //Adds the history of inputStore (same sketch binning) after the runs already stored; a first run of inputStore matching
+            //the last run stored here is merged into it (e.g. the same run filled by several threads)
+            virtual void add(const RunHistoryStore & inputStore);
+
+            //Adds fVal observed in run iRun
+            virtual void fill(int iRun, float fVal);
+
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the memory held by the store
+            virtual long getBytes() const;
+
+            //Returns the number of values in history bin iBin
+            virtual long getCount(int iBin) const { return vec_binHistory[iBin].lCount; };
+
+            //Returns a TGraphErrors of the median (y) & half the inter-quartile range (ey) of each history bin (x -> bin index)
+            virtual TGraphErrors getGraphMedian(std::string strName) const;
+
+            //Returns a TH2F of the quantile sketch (y) of each history bin (x); x bins are labeled by the run range they cover
+            virtual TH2F getHisto2D(std::string strName, std::string strTitleY) const;
+
+            //Returns the mean of history bin iBin
+            virtual float getMean(int iBin) const;
+
+            //Returns the number of filled history bins
+            virtual int getNBins() const { return vec_binHistory.size(); };
+
+            //Returns the fProb quantile of history bin iBin estimated from its sketch
+            virtual float getQuantile(int iBin, float fProb) const;
+
+            //Returns the first & last run of history bin iBin
+            virtual int getRunFirst(int iBin) const { return vec_binHistory[iBin].iRun_First; };
+            virtual int getRunLast(int iBin) const { return vec_binHistory[iBin].iRun_Last; };
+
+            //Returns the number of runs summarized in one history bin
+            virtual int getRunsPerBin() const { return iRunsPerBin; };
+
+            //Returns the standard deviation of history bin iBin
+            virtual float getStdDev(int iBin) const;
+
+            //true -> nothing has been filled
+            virtual bool empty() const { return vec_binHistory.empty(); };
+
+        private:
+            //Summary of the runs in one history bin
+            struct HistoryBin{
+                int iRun_First, iRun_Last;  //First & last run of the bin
+                int iNRuns;                 //Number of runs in the bin
+
+                long lCount;                //Number of values
+                double dSum, dSumSq;        //Sum & sum of squares of the values
+
+                std::vector<float> vec_fSketch; //Coarse histogram of the values; quantile sketch
+
+                HistoryBin(){
+                    iRun_First = iRun_Last = -1;
+                    iNRuns = 0;
+                    lCount = 0;
+                    dSum = dSumSq = 0.;
+                }
+            }; //End HistoryBin
+
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Merges neighbouring history bins pairwise & doubles iRunsPerBin
+            void downsample();
+
+            //Makes the last history bin the one of run iRun, starting a new bin if needed; iNRunsInput runs are counted
+            void startRun(int iRun, int iNRunsInput);
+
+            //Attributes
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            int iNBinsMax;      //Maximum number of history bins
+            int iNBinsSketch;   //Number of bins in the quantile sketch
+            int iRunsPerBin;    //Runs summarized in one history bin
+
+            float fSketch_Lower, fSketch_Upper; //Range of the quantile sketch; values outside go into the first/last sketch bin
+
+            std::vector<HistoryBin> vec_binHistory;
+        }; //End class RunHistoryStore
+    } //End namespace Uniformity
+} //End namespace QualityControl
+
+#endif /* defined(____RunHistoryStore__) */
@@ -0,0 +1,79 @@
+#ifndef __SRSAPVCONTEXT__
+#define __SRSAPVCONTEXT__
+/*******************************************************************************
+ *  SRSAPVContext                                                               *
+ *  Per run constants of each APV, built once from the mapping and pedestals    *
+ *******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#define NCH 128
+
+class SRSPedestal;
+
+//============================================================================================
+// Everything SRSAPVEvent used to look up in SRSMapping for each APV of each event: readout
+// geometry, APV position on its plane, header level, channel to strip (and pad) tables and the
+// pedestals of the APV. Filled by SRSAPVEvent::BuildContext(), read only afterwards
+struct SRSAPVContext {
+  SRSAPVContext() ;
+
+  int fFECNo, fADCChannel, fAPVID, fAPVKey ;
+  int fAPVHeaderLevel, fAPVIndexOnPlane, fAPVOrientation, fAPVstripmapping, fNbOfAPVsFromPlane ;
+  std::string fAPV, fPlane, fDetector, fDetectorType, fReadoutBoard ;
+
+  float fPlaneSize, fEtaSectorPos ;
+  float fTrapezoidDetLength, fTrapezoidDetOuterRadius, fTrapezoidDetInnerRadius ;
+  float fPitch ;        // fPlaneSize / (NCH * fNbOfAPVsFromPlane)
+  int   fStripOffset ;  // first strip of the APV on its plane, NCH * (fAPVIndexOnPlane % fNbOfAPVsFromPlane)
+
+  std::vector<float> fPadDetectorMap ;
+  int fStripNoFromChNo[NCH] ;  // SRSAPVEvent::StripMapping() of every APV channel
+  int fPadNoFromChNo[NCH] ;    // PADPLANE only, 65535 == channel not connected
+
+  bool fIsPedestalLoaded ;
+  std::vector<float> fPedestalOffsets, fPedestalNoises, fMaskedChannels ;
+};
+
+//============================================================================================
+// The contexts of all the APVs of the mapping, indexed directly by (FEC << 4) | ADC channel, and a
+// 16 bits mask of the active ADC channels of each FEC: a frame of an unmapped or masked channel is
+// rejected with one bit test. Built once per run (SRSMain::Init) and shared by all the SRSFECDecoder
+class SRSAPVContextTable {
+
+ public:
+  SRSAPVContextTable() ;
+  ~SRSAPVContextTable() {}
+
+  //=== The apvID of the mapping holds the FEC number on 4 bits, 16 ADC channels per FEC; the 8 bits
+  //    FEC ID of the equipment header beyond 15 cannot be mapped and fail the range check of IsActive()
+  static const int kNbOfFECs = 16 ;
+  static const int kNbOfADCChannels = 16 ;
+
+  //=== ped may be 0, the APVs then have no pedestals (full readout frames are skipped).
+  //    apvMaskFraction > 0: an APV with at least this fraction of masked channels (CHMASKCUT) is not active
+  void Build(SRSPedestal * ped, float apvMaskFraction = 0) ;
+
+  bool IsActive(int fecNo, int adcChannel) const {
+    if ((fecNo < 0) || (fecNo >= kNbOfFECs) || (adcChannel < 0) || (adcChannel >= kNbOfADCChannels)) return false ;
+    return (fActiveChannels[fecNo] >> adcChannel) & 1 ;
+  }
+
+  //=== 0 if the FEC channel is not in the mapping or masked
+  const SRSAPVContext * GetContext(int fecNo, int adcChannel) const {
+    if (!IsActive(fecNo, adcChannel)) return 0 ;
+    return &fContexts[fIndexFromAPVID[(fecNo << 4) | adcChannel]] ;
+  }
+
+  int GetNbOfAPVs() const {return (int) fContexts.size();}
+  int GetNbOfMaskedAPVs() const {return fNbOfMaskedAPVs;}
+
+ private:
+  std::vector<SRSAPVContext> fContexts ;
+  std::vector<int> fIndexFromAPVID ;            // kNbOfFECs * kNbOfADCChannels entries, -1 == not in the mapping
+  std::vector<unsigned short> fActiveChannels ; // bit adcChannel of fActiveChannels[fecNo]
+  int fNbOfMaskedAPVs ;
+};
+
+#endif
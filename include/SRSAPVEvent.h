@@ -21,6 +21,7 @@
 */
 #include "SRSHit.h"
 #include "SRSMapping.h"
+#include "SRSAPVContext.h"
 
 #define NCH 128
 
@@ -30,8 +31,12 @@ class SRSAPVEvent {
 public:
     
     SRSAPVEvent(int fec_no, int fec_channel, int apv_id, int sigmaLevel, int packet_size) ;
+    SRSAPVEvent(const SRSAPVContext * context, int sigmaLevel, int packet_size) ;
     ~SRSAPVEvent() ;
     
+    // Fills context with the mapping of the APV apv_id (see SRSAPVContextTable)
+    static void BuildContext(int fec_no, int fec_channel, int apv_id, SRSAPVContext & context) ;
+    
     void Add32BitsRawData(unsigned int rawdata32bits);
     void ComputeTimeBinCommonMode() ;
     
@@ -44,13 +49,17 @@ public:
     std::vector<unsigned int> GetRawData16bits() {return fRawData16bits ;}
     
     
-    std::multimap<int, float> GetTimeBinMap() {return fapvTimeBinDataMap ;}
+    // Flat [timebin * NCH + stripNo] data of the last frame, corrected once ComputeListOfAPVHits() ran
+    std::vector<float> GetTimeBinData() {return fTimeBinData ;}
+    int GetNbTimeBins()                 {return fNbTimeBins ;}
     
     void ComputeMeanTimeBinPedestalData() ;
     std::vector<float> GetPedestalData() {return fPedestalData ;}
     
     void ComputeMeanTimeBinRawPedestalData() ;
     std::vector<float> GetRawPedestalData() {return fRawPedestalData ;}
+
+    int ComputeTimeBinRawData(std::vector<float> & timeBinData) ;
     std::list <SRSHit * > ComputeListOfAPVHits() ;
     std::list <SRSHit * > ComputeListOfAPVHitsZS() ;
     
@@ -127,6 +136,7 @@ public:
         SetCommonModeFlag(commonmode) ;
     }
     
+    // Not needed when the context of the APV holds its pedestals
     void SetPedestals(std::vector<float> noises, std::vector<float> offsets, std::vector<float> maskChs) {
         fMaskedChannels = maskChs;
         fPedestalNoises = noises ;
@@ -146,6 +156,19 @@ public:
     
 private:
     
+    SRSAPVEvent(const SRSAPVEvent &) ;
+    SRSAPVEvent & operator=(const SRSAPVEvent &) ;
+    
+    void InitFromContext(const SRSAPVContext * context, int zeroSupCut, int packetSize) ;
+    
+    const std::vector<float> & PedestalOffsets() const {return fContext->fIsPedestalLoaded ? fContext->fPedestalOffsets : fPedestalOffsets ;}
+    const std::vector<float> & PedestalNoises()  const {return fContext->fIsPedestalLoaded ? fContext->fPedestalNoises  : fPedestalNoises ;}
+    const std::vector<float> & MaskedChannels()  const {return fContext->fIsPedestalLoaded ? fContext->fMaskedChannels  : fMaskedChannels ;}
+    
+    int UnpackTimeBinRawData(std::vector<float> & timeBinData) ;
+    void ComputeMeanTimeBinData(std::vector<float> & meanTimeBinData) ;
+    float ComputeCommonMode(const float * data, const float * offsets, const float * noises, const float * masks, int firstStrip, int lastStrip, float zeroSupCut) ;
+    
     int fFECNo, fADCChannel, fAPVID, fAPVKey, fZeroSupCut, fNbCluster ;
     int fAPVIndexOnPlane, fAPVOrientation, fAPVstripmapping, fNbOfAPVsFromPlane, fAPVHeaderLevel, fPacketSize;
     float fPlaneSize, fEtaSectorPos, fAPVGain, fMeanAPVnoise;
@@ -155,12 +178,14 @@ private:
     float fTrapezoidDetLength, fTrapezoidDetOuterRadius, fTrapezoidDetInnerRadius;
     
     std::vector<unsigned int> fRawData16bits, fRawData32bits;
-    std::multimap<int, float> fapvTimeBinDataMap ;
+    std::vector<float> fTimeBinData ;
+    int fNbTimeBins ;
     std::vector<float> fPedestalData, fRawPedestalData, fPedestalOffsets, fRawPedestalOffsets,fPedestalNoises, fRawPedestalNoises, fMaskedChannels;
     
     std::vector<float>  fPadDetectorMap, fCommonModeOffsets, fCommonModeOffsets_odd,   fCommonModeOffsets_even ;
     
-    std::map <int, int> fapvChToPadChMap ;
+    const SRSAPVContext * fContext ;
+    SRSAPVContext * fOwnedContext ;  // only for the stand alone constructor
     
 };
 
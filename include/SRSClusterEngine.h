@@ -0,0 +1,73 @@
+#ifndef __SRSCLUSTERENGINE__
+#define __SRSCLUSTERENGINE__
+/*******************************************************************************
+ *  SRSClusterEngine                                                            *
+ *  Clustering of the hits of one detector plane in a single linear scan        *
+ *******************************************************************************/
+
+#include <vector>
+
+class SRSHit;
+
+//============================================================================================
+// One strip of the plane, copied out of the SRSHit once so the scan only touches a flat array
+struct SRSClusterHit {
+  int   fStripNo ;
+  int   fTimeBin ;   // peak time bin of the strip
+  float fADCs ;
+  SRSHit * fHit ;
+};
+
+//============================================================================================
+// One cluster: fNbOfHits consecutive entries of GetSortedHits() starting at fFirstHit
+struct SRSClusterRecord {
+  int   fFirstHit, fNbOfHits ;
+  int   fPeakTimeBin ;   // time bin of the strip with the largest ADCs
+  float fSumADCs, fPeakADCs ;
+};
+
+//============================================================================================
+// The hits of a plane are sorted by strip number with a radix (counting) pass, then grouped in
+// one scan: a strip closes the running cluster when more than fMaxGap strips are missing since
+// the previous one. Strips below fNeighbourCut are ignored and a cluster is kept only if one of
+// its strips reaches fSeedCut. The buffers are kept between planes and events, so after the
+// first events no memory is allocated anymore
+class SRSClusterEngine {
+
+ public:
+  SRSClusterEngine() ;
+  ~SRSClusterEngine() {}
+
+  void SetMaxGap(int gap)              {fMaxGap = gap;}
+  void SetSeedCut(float cut)           {fSeedCut = cut;}
+  void SetNeighbourCut(float cut)      {fNeighbourCut = cut;}
+
+  int   GetMaxGap()       const {return fMaxGap;}
+  float GetSeedCut()      const {return fSeedCut;}
+  float GetNeighbourCut() const {return fNeighbourCut;}
+
+  //=== Starts a new plane, the capacity of the buffers is kept
+  void Clear() ;
+  void AddHit(SRSHit * hit) ;
+
+  //=== Sorts & groups the hits added since Clear(); isPadPlane == every hit is its own cluster
+  //    returns the number of clusters
+  int ComputeClusters(bool isPadPlane) ;
+
+  int GetNbOfHits() const {return (int) fHits.size();}
+
+  const std::vector<SRSClusterHit> &    GetSortedHits() const {return fSortedHits;}
+  const std::vector<SRSClusterRecord> & GetClusters()   const {return fClusters;}
+
+ private:
+  void SortByStripNo() ;
+  void CloseCluster(SRSClusterRecord & cluster) ;
+
+  int fMaxGap ;
+  float fSeedCut, fNeighbourCut ;
+
+  std::vector<SRSClusterHit> fHits, fSortedHits ;
+  std::vector<SRSClusterRecord> fClusters ;
+};
+
+#endif
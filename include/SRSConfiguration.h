@@ -93,6 +93,42 @@ class SRSConfiguration {
   const char * GetHitMaxOrTotalADCs() const {return fIsHitMaxOrTotalADCs.c_str();};
   void  SetHitMaxOrTotalADCs(const char * name) {fIsHitMaxOrTotalADCs  = std::string(name);}
 
+  const char * GetNbOfThreads() const {return fNbOfThreads.c_str();};
+  void  SetNbOfThreads(const char * name) {fNbOfThreads  = std::string(name);}
+
+  const char * GetClusterCache() const {return fClusterCache.c_str();};
+  void  SetClusterCache(const char * name) {fClusterCache  = std::string(name);}
+
+  const char * GetClusterMaxGap() const {return fClusterMaxGap.c_str();};
+  void  SetClusterMaxGap(const char * name) {fClusterMaxGap  = std::string(name);}
+
+  const char * GetClusterSeedCut() const {return fClusterSeedCut.c_str();};
+  void  SetClusterSeedCut(const char * name) {fClusterSeedCut  = std::string(name);}
+
+  const char * GetClusterNeighbourCut() const {return fClusterNeighbourCut.c_str();};
+  void  SetClusterNeighbourCut(const char * name) {fClusterNeighbourCut  = std::string(name);}
+
+  const char * GetAPVMaskFraction() const {return fAPVMaskFraction.c_str();};
+  void  SetAPVMaskFraction(const char * name) {fAPVMaskFraction  = std::string(name);}
+
+  const char * GetLogLevel() const {return fLogLevel.c_str();};
+  void  SetLogLevel(const char * name) {fLogLevel  = std::string(name);}
+
+  const char * GetLogFile() const {return fLogFile.c_str();};
+  void  SetLogFile(const char * name) {fLogFile  = std::string(name);}
+
+  const char * GetLogRate() const {return fLogRate.c_str();};
+  void  SetLogRate(const char * name) {fLogRate  = std::string(name);}
+
+  const char * GetEventRange() const {return fEventRange.c_str();};
+  void  SetEventRange(const char * name) {fEventRange  = std::string(name);}
+
+  const char * GetRecoChunks() const {return fRecoChunks.c_str();};
+  void  SetRecoChunks(const char * name) {fRecoChunks  = std::string(name);}
+
+  const char * GetSplitDetectors() const {return fSplitDetectors.c_str();};
+  void  SetSplitDetectors(const char * name) {fSplitDetectors  = std::string(name);}
+
   bool Load(const char * filename);
   void Save(const char * filename) const; 
   void Dump() const;
@@ -106,6 +142,8 @@ class SRSConfiguration {
   std::string fMappingFile, fPadMappingFile, fSavedMappingFile, fRunNbFile, fRunName, fRunType, fROOTDataType, fCycleWait, fZeroSupCut, fMaskedChannelCut, fHistosFile, fTrackingOffsetDir;
   std::string fDisplayFile, fPositionCorrectionFile, fPositionCorrectionFlag, fPedestalFile, fRawPedestalFile, fAPVGainCalibrationFile;
   std::string fMaxClusterSize, fMinClusterSize, fStartEventNumber, fMaxClusterMultiplicity, fIsHitMaxOrTotalADCs, fIsClusterMaxOrTotalADCs, fEventFrequencyNumber;
+  std::string fNbOfThreads, fClusterCache, fClusterMaxGap, fClusterSeedCut, fClusterNeighbourCut, fAPVMaskFraction;
+  std::string fLogLevel, fLogFile, fLogRate, fEventRange, fRecoChunks, fSplitDetectors;
 
 };
 
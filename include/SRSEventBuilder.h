@@ -9,11 +9,24 @@
 //#include "SRSMapping.h"
 //#include "SRSPedestal.h"
 #include "SRSCluster.h"
+#include "SRSClusterEngine.h"
 #include "SRSHit.h"
 #include "SRSAPVEvent.h"
 
 #define PI 3.14159265359
 
+//============================================================================================
+// Hits & clusters of one detector plane in the current event. The mapping information of the
+// plane is looked up once, when the plane is seen for the first time in the run
+struct SRSPlaneEvent {
+  std::string fPlane, fDetector, fReadoutBoard ;
+  int fDetID ;
+  float fPlaneID ;   // planeID or eta sector, as written in the trees
+
+  std::vector<SRSHit *>     fHits ;
+  std::vector<SRSCluster *> fClusters ;   // largest ADCs first
+};
+
 class SRSEventBuilder{
     
 public:
@@ -25,20 +38,31 @@ public:
     
     template <typename M> void ClearVectorMap( M & amap ) ;
     
-    void AddHitInDetectorPlane(SRSHit* hit) {fHitsInDetectorPlaneMap[hit->GetPlane()].push_back(hit) ;}
+    //=== Clears the event (hits & clusters are deleted) keeping the plane table and the capacity of the
+    //    containers, so one builder serves all the events of a run
+    void Reset(int triggerNb) ;
+
+    void AddHitInDetectorPlane(SRSHit* hit) {GetPlaneEvent(hit->GetPlane()).fHits.push_back(hit) ;}
     
     void AddHit(SRSHit* hit ) {fListOfHits.push_back(hit) ;}
     
     void AddMeanDetectorPlaneNoise(std::string detPlaneName, float meanAPVnoise) { fDetectorPlaneNoise[detPlaneName].push_back(meanAPVnoise);}
     
     void ComputeClustersInDetectorPlane() ;
+    //=== Engine (gap tolerance, seed & neighbour cuts, buffers) shared by the events of a run; not owned
+    void SetClusterEngine(SRSClusterEngine * clusterEngine) {fClusterEngine = clusterEngine;}
     void AddAPVEvent(SRSAPVEvent* apvEvent) {fListOfAPVEvents.push_back(apvEvent); }
     std::string GetRunType() {return fRunType;}
+    int GetZeroSupCut() {return fZeroSupCut;}
     
-    std::list<SRSHit*>  GetListOfHits() {return fListOfHits;}
+    const std::vector<SRSHit*> & GetListOfHits() const {return fListOfHits;}
     
-    std::map < std::string, std::list <SRSHit * > > GetHitsInDetectorPlane() {return fHitsInDetectorPlaneMap;}
-    std::map < std::string, std::list <SRSCluster * > >  GetClustersInDetectorPlane() {return fClustersInDetectorPlaneMap ;}
+    //=== Planes of the run, in the order of their names (as the string keyed maps used before)
+    const std::vector<SRSPlaneEvent> & GetPlaneEvents()  const {return fPlaneEvents;}
+    const std::vector<int> & GetPlaneEventsByName()      const {return fPlaneEventsByName;}
+
+    //=== Sorts the hits of each plane by strip number, in place
+    void SortHitsByStripNo() ;
     
     void SetTriggerList(std::map<std::string, std::string> triggerList)  {fTriggerList = triggerList ;}
     int GetTriggerCount() {return fTriggerCount;}
@@ -54,10 +78,9 @@ public:
     //    SRSAPVEvent * GetAPVEventFromAPVKey(int apvKey) {return (SRSAPVEvent*) (fListOfAPVEvents->At(apvKey));}
     
     void DeleteListOfAPVEvents(std::list<SRSAPVEvent*>&  listOfAPVEvents) ;
-    void DeleteListOfHits(std::list<SRSHit *>& listOfHits) ;
+    void DeleteListOfHits(std::vector<SRSHit *>& listOfHits) ;
     //void DeleteListOfClusters(TList * listOfClusters) ;
     
-    void DeleteHitsInDetectorPlaneMap( std::map <std::string, std::list <SRSHit * > >  & stringListMap) ;
     //    void DeleteClustersInDetectorPlaneMap( std::map < std::string, std::list <SRSCluster * > > & stringListMap) ;
     //    float GetDetectorPlaneNoise(std::string planeName) { return TMath::Mean(fDetectorPlaneNoise[planeName].begin(), fDetectorPlaneNoise[planeName].end());}
     
@@ -77,19 +100,27 @@ public:
     
 private:
     int atoi(const std::string& s);
+    SRSPlaneEvent & GetPlaneEvent(const std::string & planeName) ;
+    SRSPlaneEvent * FindPlaneEvent(const std::string & planeName) ;
+    void ClearClusters(SRSPlaneEvent & planeEvent) ;
+
     int fTriggerCount, fMinClusterSize, fMaxClusterSize, fMaxClusterMultiplicity, fZeroSupCut ;
     
     std::list<SRSAPVEvent *>  fListOfAPVEvents; 
-    std::list<SRSHit *>       fListOfHits;
+    std::vector<SRSHit *>     fListOfHits;
     std::string fIsClusterMaxOrTotalADCs, fIsHitMaxOrTotalADCs, fRunType ;
     bool fIsGoodEvent, fIsGoodClusterEvent, fIsClusterPosCorrection ;
     
     std::map < std::string, std::vector <float > > fDetectorPlaneNoise ;
     std::map<std::string, std::string> fTriggerList ;
-    std::map < std::string, std::list <SRSHit * > >  fHitsInDetectorPlaneMap ;
-    std::map < std::string, std::list <SRSCluster * > >  fClustersInDetectorPlaneMap ;
+
+    std::vector<SRSPlaneEvent> fPlaneEvents ;
+    std::vector<int> fPlaneEventsByName ;
+    std::map<std::string, int> fPlaneEventIndex ;
+    int fLastPlaneEvent ;   // plane of the previous hit, consecutive hits are mostly on the same plane
     
     const char * fClusterPositionCorrectionRootFile ;
+    SRSClusterEngine * fClusterEngine ;
     
 };
 #endif
@@ -1,15 +1,23 @@
 #include <vector>
 #include <map>
 class SRSEventBuilder;
+class SRSPedestal;
+class SRSAPVContextTable;
 class SRSFECDecoder{
  public:
-  SRSFECDecoder(SRSEventBuilder* eB);
+  // With apvContexts the APVs are taken from the per run context table (mapping & pedestals), otherwise
+  // they are looked up in SRSMapping / ped for each frame
+  SRSFECDecoder(SRSEventBuilder* eB, SRSPedestal* ped = 0, const SRSAPVContextTable* apvContexts = 0);
   void decodeFEC(unsigned int nw, unsigned long* buffer);
   //  void BuildHits(std::vector<unsigned long int> data32bits, int fec_no, int fec_channel);
-  void BuildHits(std::vector<unsigned long int> data32bits, int fec_no, int fec_channel, SRSEventBuilder * eventBuilder) ;
+  void BuildHits(const std::vector<unsigned long int> & data32bits, int fec_no, int fec_channel, SRSEventBuilder * eventBuilder) ;
  private:
+  bool IsActiveChannel(int fec_no, int fec_channel) const ;
   SRSEventBuilder* feventBuilder;
+  SRSPedestal* fPedestal;
+  const SRSAPVContextTable* fAPVContexts;
+  bool fIsZeroSuppressed;
   int fPacketSize;
-  std::vector <int>  fActiveFecChannels ;
-  std::map<int, std::vector<int> > fActiveFecChannelsMap ;
+  bool fIsActiveChannel;                      // channel of the current packet, its payload is skipped otherwise
+  std::vector <unsigned short> fActiveChannels ; // bit fec_channel of fActiveChannels[fec_no], without context table
 };
@@ -54,7 +54,7 @@ public:
     
     void ClearTimeBinADCs() {fTimeBinADCs.clear() ;}
     
-    std::vector<float> GetTimeBinADCs() { return fTimeBinADCs ;}
+    const std::vector<float> & GetTimeBinADCs() const { return fTimeBinADCs ;}
     
     int GetAPVID()            {return fapvID;}
     void SetAPVID(int apvID) {fapvID = apvID;}
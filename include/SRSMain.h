@@ -4,6 +4,7 @@
 //C++ Includes
 #include <string>
 #include <memory>
+#include <vector>
 
 //Framework Includes
 
@@ -12,6 +13,10 @@
 class SRSMapping;
 class SRSConfiguration;
 class SRSOutputROOT;
+class SRSPedestal;
+class SRSClusterEngine;
+class SRSAPVContextTable;
+class SRSRawIndex;
 class SRSMain{
 public:
     SRSMain(const std::string& rawfile, const std::string& config);
@@ -19,10 +24,22 @@ public:
     //static SRSMain* Reprocessor(const std::string& rawfile, const std::string& config);
     void Reprocess();
     void Close();
+    // Output files are <output name>_dataTree.root, ...
+    std::string GetOutputName() const;
+    // Tree files written: <output name>_dataTree.root, or one per detector (SPLITDETECTORS YES)
+    std::vector<std::string> GetOutputFiles() const;
+    // Detector of each file of GetOutputFiles(), empty if the file holds all detectors
+    std::vector<std::string> GetOutputDetectors() const;
+    static std::string GetRunName(const std::string& rawfile);
 
 private:
     //SRSMain(const std::string& rawfile, const std::string& config);
     void Init();
+    void ReprocessPedestal();
+    void ReprocessEvents(const SRSRawIndex* index, unsigned int firstEvent, unsigned int lastEvent);
+    bool ReprocessChunks(const SRSRawIndex& index, unsigned int firstEvent, unsigned int lastEvent, unsigned int nbOfChunks);
+    bool MergeChunks(const std::vector<std::string>& partNames);
+    std::string GetRunName() const;
 private:
     //static SRSMain* _repro;
     //SRSConfiguration* _conf;
@@ -32,12 +49,20 @@ private:
     std::unique_ptr<SRSConfiguration> _conf;
     //std::unique_ptr<SRSMapping> _maps;
     std::shared_ptr<SRSMapping> _maps;
-    std::unique_ptr<SRSOutputROOT> _root;
+    // One output per detector when they are split, each named <output name><suffix>
+    std::vector<std::unique_ptr<SRSOutputROOT> > _roots;
+    std::vector<std::string> _outputSuffixes;
+    std::unique_ptr<SRSPedestal> _ped;
+    std::unique_ptr<SRSClusterEngine> _clusterEngine;
+    std::unique_ptr<SRSAPVContextTable> _apvContexts;
 
 private:
     std::string _rawfile;
     std::string _config;
+    std::string _outputName;
+    unsigned int _nbOfFECs;
     bool _isClosed;
+    bool _isOutputWritten;
     
 };
 #endif
@@ -24,6 +24,8 @@
 #include "SRSConfiguration.h"
 #include "SRSEventBuilder.h"
 
+#include "ClusterCache.h"
+
 
 
 class SRSOutputROOT {
@@ -44,6 +46,12 @@ public:
     void SetRunType(std::string runtype)     {fRunType = runtype;}
     void SetROOTDataType(const std::string& rootdatatype){ fROOTDataType = rootdatatype ; }
     void SetZeroSupCut(Int_t zeroSupCut) {fZeroSupCut = zeroSupCut;}
+
+    // Only the planes of this detector (SRSMapping detector ID) are written, -1 == all detectors
+    void SetDetector(int detID) {fDetID = detID;}
+
+    // Clusters are also written to this flat binary file (see ClusterCache.h); closed by WriteRootFile()
+    bool SetClusterCacheFile(const std::string& filename) {return fClusterCache.open(filename);}
     
     
     void DeleteHitsTree() ;
@@ -56,10 +64,14 @@ private:
     TTree * fHitTree ;
     TTree * fClusterTree ;
 
+    QualityControl::Uniformity::ClusterCacheWriter fClusterCache ;
+    std::vector<QualityControl::Uniformity::ClusterCacheRecord> fClusterCacheRecords ;
+
     std::string fRunType, fRunName;
     std::string fROOTDataType;
     
     int m_evtID, m_chID, m_nclust, fZeroSupCut;            //
+    int fDetID ;
     
     float * m_planeID;      // Plane Number
     int * m_strip;        // Strip Number
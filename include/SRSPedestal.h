@@ -0,0 +1,100 @@
+#ifndef __SRSPEDESTAL__
+#define __SRSPEDESTAL__
+/*******************************************************************************
+ *  based on AMORE FOR SRS - SRS                                                *
+ *  SRSPedestal                                                                 *
+ *  SRS Module Class                                                            *
+ *  Author: Kondo GNANVO 18/08/2010                                             *
+ *  Rewritten as a multi-threaded, single pass pedestal engine (no ROOT)        *
+ *******************************************************************************/
+
+#include <map>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+
+#define NCH 128
+
+class SRSAPVEvent;
+
+//============================================================================================
+// Running (Welford) statistics of one APV over a pedestal run
+//   time bin quantities are stored flat as [timebin * NCH + stripNo]
+//   offsets are computed on the raw data, noises on the common mode subtracted data
+class SRSAPVPedestalData {
+
+ public:
+  SRSAPVPedestalData(int apvID = 0) ;
+
+  void Fill(const std::vector<float> & timeBinData, int nbTimeBins) ;
+  void Merge(const SRSAPVPedestalData & other) ;
+
+  int  GetAPVID()      const {return fAPVID;}
+  int  GetNbTimeBins() const {return fNbTimeBins;}
+  long GetNbFrames()   const {return fNbFrames;}
+
+  //=== Per strip quantities, as expected by SRSAPVEvent::SetPedestals()
+  std::vector<float> GetOffsets() const ;
+  std::vector<float> GetNoises() const ;
+
+  //=== Per strip and time bin quantities, [timebin * NCH + stripNo]
+  std::vector<float> GetTimeBinOffsets() const ;
+  std::vector<float> GetTimeBinNoises() const ;
+
+ private:
+  void Resize(int nbTimeBins) ;
+
+  int fAPVID, fNbTimeBins ;
+  long fNbFrames ;
+
+  std::vector<long>   fTimeBinEntries ;
+  std::vector<double> fOffsetMean, fOffsetM2, fNoiseMean, fNoiseM2 ;
+  std::vector<double> fStripNoiseMean, fStripNoiseM2 ;
+};
+
+//============================================================================================
+class SRSPedestal {
+
+ public:
+  SRSPedestal() ;
+  ~SRSPedestal() ;
+
+  //=== Pedestal run processing: fragments of the raw file are dealt to nbOfThreads workers
+  bool ComputePedestals(const std::string & rawfile, unsigned int nbOfThreads = 0) ;
+
+  //=== Compact binary pedestal file
+  void SavePedestalFile(const char * filename) ;
+  bool LoadPedestalFile(const char * filename) ;
+
+  bool IsAPVLoaded(int apvID) const {return (fOffsets.find(apvID) != fOffsets.end());}
+
+  std::vector<float> GetAPVOffsets(int apvID)        {return fOffsets[apvID];}
+  std::vector<float> GetAPVNoises(int apvID)         {return fNoises[apvID];}
+  std::vector<float> GetAPVMaskedChannels(int apvID) {return fMaskedChannels[apvID];}
+
+  std::vector<float> GetAPVTimeBinOffsets(int apvID) {return fTimeBinOffsets[apvID];}
+  std::vector<float> GetAPVTimeBinNoises(int apvID)  {return fTimeBinNoises[apvID];}
+
+  void  SetMaskedChannelCut(float cut) {fMaskedChannelCut = cut;}
+  float GetMaskedChannelCut()          {return fMaskedChannelCut;}
+
+  void Print() ;
+
+ private:
+  void ProcessFragments(const std::vector< std::vector<unsigned int> > & fragments, unsigned int first, unsigned int last, std::map<int, SRSAPVEvent *> & apvEvents, std::map<int, SRSAPVPedestalData> & apvData) ;
+  void ProcessFragment(const std::vector<unsigned int> & fragment, std::map<int, SRSAPVEvent *> & apvEvents, std::map<int, SRSAPVPedestalData> & apvData, std::vector<float> & timeBinData) ;
+  void ProcessFrame(int apvID, const std::vector<unsigned int> & frame, std::map<int, SRSAPVEvent *> & apvEvents, std::map<int, SRSAPVPedestalData> & apvData, std::vector<float> & timeBinData) ;
+
+  void Clear() ;
+
+  float fMaskedChannelCut ;
+  long fNbFragments ;
+
+  std::map<int, int> fNbTimeBins ;
+  std::map<int, long> fNbFrames ;
+  std::map<int, std::vector<float> > fOffsets, fNoises, fMaskedChannels ;
+  std::map<int, std::vector<float> > fTimeBinOffsets, fTimeBinNoises ;
+};
+
+#endif
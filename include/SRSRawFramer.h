@@ -0,0 +1,81 @@
+#ifndef __SRSRAWFRAMER__
+#define __SRSRAWFRAMER__
+/*******************************************************************************
+ *  SRSRawFramer                                                                *
+ *  Splits the raw stream into FEC fragments and resynchronizes on corruption   *
+ *******************************************************************************/
+
+#include <map>
+#include <string>
+#include <vector>
+
+class SRSRawStream;
+
+//============================================================================================
+// A FEC fragment is the event header (8 words), then the APV frames, each starting with an
+// "APZ" (zero suppressed) or "ADC" (full readout) header word, and ends with 0xfafafafa.
+// NextFragment() only returns fragments with that structure: a fragment longer than fMaxWords
+// is dropped up to the next 0xfafafafa, a fragment without a valid APV header is dropped. An APV
+// header repeating an ADC channel of the fragment, with room for an event header before it, is
+// the first frame of the next fragment whose end marker was lost: the words before that event
+// header are dropped and the framing continues from it. The
+// dropped byte ranges (offsets over the chained files of the run) and the corruption counters
+// per FEC and per APV are written by WriteReport()
+class SRSRawFramer {
+
+ public:
+  SRSRawFramer(SRSRawStream & stream, unsigned int maxWords) ;
+  ~SRSRawFramer() {}
+
+  //=== Next valid fragment, 0xfafafafa included, and the FEC id of its event header;
+  //    false at the end of the stream
+  bool NextFragment(std::vector<unsigned long> & fragment, int & fecNo) ;
+
+  //=== Stream offset of the first word of the last fragment returned
+  unsigned long long GetFragmentOffset() const {return fFragmentOffset;}
+
+  //=== Continues with the fragment starting at this stream offset (e.g. from SRSRawIndex)
+  bool Seek(unsigned long long offset) ;
+
+  void WriteReport(const std::string & fileName) const ;
+
+  long GetNbOfFragments()        const {return fNbOfFragments;}
+  long GetNbOfCorruptFragments() const {return fNbOfCorruptFragments;}
+  unsigned long long GetNbOfSkippedBytes() const {return fNbOfSkippedBytes;}
+
+ private:
+  struct SkippedRange {
+    unsigned long long fFirstByte, fNbOfBytes ;
+    std::string fReason ;
+  };
+
+  bool ReadWord(unsigned int & word) ;
+  static bool IsAPVHeader(unsigned int word) ;
+
+  //=== Empty string if the fragment is valid; counts the suspicious APV frames it holds
+  std::string CheckFragment(const std::vector<unsigned long> & fragment, int & fecNo) ;
+
+  //=== Start of a second event header in the fragment (-1 if none) and the FEC id of the first one
+  static int FindEventBoundary(const std::vector<unsigned long> & fragment, int & fecNo) ;
+
+  //=== Drops the words before each second event header of the fragment, firstByte follows
+  void DropMergedFragments(std::vector<unsigned long> & fragment, unsigned long long & firstByte) ;
+  void Skip(unsigned long long firstByte, unsigned long long nbOfBytes, int fecNo, const std::string & reason) ;
+
+  SRSRawStream & fStream ;
+  unsigned int fMaxWords ;
+
+  //=== Words are read by blocks, fOffset is the stream offset of the next word
+  std::vector<unsigned int> fBlock ;
+  unsigned int fBlockPos, fBlockSize ;
+  unsigned long long fOffset, fFragmentOffset ;
+
+  long fNbOfFragments, fNbOfCorruptFragments ;
+  unsigned long long fNbOfSkippedBytes ;
+  std::map<int, long> fNbOfFragmentsPerFEC, fNbOfCorruptFragmentsPerFEC ;  // FEC -1 == unknown
+  std::map<int, long> fNbOfCorruptFramesPerAPV ;                         // apvID = (FEC << 4) | ADC channel
+  std::vector<SkippedRange> fSkippedRanges ;                             // the first kMaxRanges only
+  static const unsigned int kMaxRanges = 10000 ;
+};
+
+#endif
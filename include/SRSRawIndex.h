@@ -0,0 +1,43 @@
+#ifndef __SRSRAWINDEX__
+#define __SRSRAWINDEX__
+/*******************************************************************************
+ *  SRSRawIndex                                                                 *
+ *  Byte offsets of the events of a run, for random access to the raw stream    *
+ *******************************************************************************/
+
+#include <string>
+#include <vector>
+
+//============================================================================================
+// Event i (from 1, numbered as in SRSMain::Reprocess()) starts with the fragment of FEC 1 found
+// at GetEventOffset(i) of the raw stream (offsets over the chained files of the run). Build()
+// scans the stream once with SRSRawFramer; the index is then saved next to the raw file as
+// <run>.rawidx and reloaded by the next jobs, unless the size of the raw files changed.
+//
+// File layout (native byte order): "SRSRAWIX", uint32 version, uint32 unused,
+// uint64 size of the raw files on disk, uint64 number of events, uint64 offsets [number of events]
+class SRSRawIndex {
+
+ public:
+  SRSRawIndex() {fStreamSize = 0;}
+  ~SRSRawIndex() {}
+
+  //=== Scans the comma separated raw files; maxWords as for SRSRawFramer
+  bool Build(const std::string & rawfiles, unsigned int maxWords) ;
+
+  //=== false if the file is missing, corrupted, or made for a stream of another size
+  bool Load(const std::string & fileName, unsigned long long streamSize) ;
+  bool Save(const std::string & fileName) const ;
+
+  unsigned int GetNbOfEvents() const {return fEventOffsets.size();}
+  unsigned long long GetEventOffset(unsigned int eventNb) const {return fEventOffsets[eventNb - 1];}
+
+  //=== Extension of the index file, appended to the run name
+  static const char * GetExtension() {return ".rawidx";}
+
+ private:
+  unsigned long long fStreamSize ;
+  std::vector<unsigned long long> fEventOffsets ;
+};
+
+#endif
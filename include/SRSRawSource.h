@@ -0,0 +1,42 @@
+#ifndef __SRSRAWSOURCE__
+#define __SRSRAWSOURCE__
+/*******************************************************************************
+ *  SRSRawSource                                                                *
+ *  Bytes of one raw file: plain, compressed, or a member of a tar archive      *
+ *******************************************************************************/
+
+#include <string>
+#include <fstream>
+
+//============================================================================================
+// Open() looks at the first bytes of the file and decompresses it on the fly:
+//   gzip (1f 8b)           always, with zlib as linked by ROOT
+//   zstd (28 b5 2f fd)     if built with -DSRS_WITH_ZSTD (-lzstd)
+//   lz4 frame (04 22 4d 18) if built with -DSRS_WITH_LZ4 (-llz4)
+// "archive.tar:run.raw" reads the member run.raw of the archive, which may itself be compressed
+// (.tar.gz, ...); the member is found by its path in the archive or by its file name.
+// Compressed data are decompressed by a background thread a few blocks ahead of the reader, so
+// the decompression overlaps the decoding of the events.
+class SRSRawSource {
+
+ public:
+  virtual ~SRSRawSource() {}
+
+  //=== Reads up to n bytes, less only at the end of the data (or on corrupted compressed data)
+  virtual std::streamsize Read(char * s, std::streamsize n) = 0 ;
+
+  //=== Random access, uncompressed data only; the others are read from the start
+  virtual bool IsSeekable() const {return false;}
+  virtual bool Seek(unsigned long long offset) {return false;}
+
+  //=== Bytes of raw data, known for seekable sources only
+  virtual unsigned long long GetSize() const {return 0;}
+
+  //=== 0 if the file cannot be opened, is not a known format or has no such member
+  static SRSRawSource * Open(const std::string & name) ;
+
+  //=== File on disk holding the data of name (the archive of a member)
+  static std::string GetDiskFile(const std::string & name) ;
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef __SRSRAWSTREAM__
+#define __SRSRAWSTREAM__
+/*******************************************************************************
+ *  SRSRawStream                                                                *
+ *  Reads a comma separated list of raw files as one continuous stream          *
+ *******************************************************************************/
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "SRSRawSource.h"
+
+//============================================================================================
+// Drop-in for the std::ifstream used on the raw data: the files of one run are read one after
+// the other as if they were a single file; while a file is read the kernel is asked to read
+// ahead the next one (posix_fadvise WILLNEED). Each file may be compressed or a member of a tar
+// archive (see SRSRawSource)
+class SRSRawStream {
+
+ public:
+  SRSRawStream(const std::string & rawfiles) ;
+  ~SRSRawStream() {close();}
+
+  //=== Reads n bytes, continuing into the next file if needed; eof() is set once the last file is exhausted
+  SRSRawStream & read(char * s, std::streamsize n) ;
+
+  //=== Number of bytes obtained by the last read(), less than asked only at the end of the stream
+  std::streamsize gcount() const {return fLastCount;}
+
+  //=== Continues reading at byte offset of the stream (counted over the files in order, uncompressed);
+  //    compressed files are decompressed from their start up to the offset
+  bool seekg(unsigned long long offset) ;
+
+  //=== Total size in bytes of the files on disk (compressed, whole archives), identifies the run
+  unsigned long long GetSize() const ;
+
+  //=== Same for a comma separated list of raw files, from the file system only (nothing is opened)
+  static unsigned long long GetSize(const std::string & rawfiles) ;
+
+  bool eof()     const {return fEOF;}
+  bool is_open() const {return fIsOpen;}
+  void close() ;
+
+  operator bool() const {return !fEOF;}
+
+  //=== Number of files, their names and the file being read
+  unsigned int GetNbFiles()     const {return fFiles.size();}
+  const std::string & GetFile(unsigned int iFile) const {return fFiles[iFile];}
+  unsigned int GetCurrentFile() const {return fCurrentFile;}
+
+ private:
+  static std::vector<std::string> SplitFiles(const std::string & rawfiles) ;
+  static unsigned long long GetDiskSize(const std::string & file) ;
+
+  bool OpenFile(unsigned int iFile) ;
+  void Prefetch(unsigned int iFile) ;
+
+  std::vector<std::string> fFiles ;
+  std::vector<unsigned long long> fFileSizes ;
+  std::unique_ptr<SRSRawSource> fSource ;
+  unsigned int fCurrentFile ;
+  std::streamsize fLastCount ;
+  bool fIsOpen, fEOF ;
+};
+
+#endif
@@ -14,6 +14,7 @@
 
 //Framework Includes
 #include "FrameworkBase.h"
+#include "Logger.h"
 #include "UniformityUtilityTypes.h"
 
 //ROOT Includes
@@ -43,6 +44,9 @@ namespace QualityControl {
             
             //Setters - Methods that Set Something
             //------------------------------------------------------------------------------------------------------------------------------------------
+            //Sets the strip mask; hits/clusters on masked strips are rejected before any other selection
+            virtual void setStripMask(Uniformity::StripMask & inputMask){ maskStrips = inputMask; return; };
+            
             //Sets the analysis parameters
             /*virtual void setAnalysisParameters(Uniformity::AnalysisSetupUniformity &inputSetup){
              aSetupUniformity = inputSetup;
@@ -64,6 +68,7 @@ namespace QualityControl {
             
             //Data Members
             //Uniformity::AnalysisSetupUniformity aSetupUniformity;
+            Uniformity::StripMask maskStrips;   //Strips to be rejected
             
         }; //End class Selector
         
@@ -15,7 +15,9 @@
 #include <vector>
 
 //Framework Includes
+#include "ClusterCache.h"
 #include "DetectorMPGD.h"
+#include "EventIndex.h"
 #include "Selector.h"
 #include "TimingUtilityFunctions.h"
 #include "UniformityUtilityTypes.h"
@@ -67,6 +69,15 @@ namespace QualityControl {
             //Input is a TFile *
             virtual void setClusters(TFile * file_InputRootFile, Uniformity::DetectorMPGD &inputDet);
             
+            //Given the TCluster tree (or a TChain of TCluster trees) from amoreSRS
+            //Applies the cluster selection and stores those selected clusters in inputDet
+            //Input is a TTree *, event numbers are the tree (chain) entry numbers
+            virtual void setClusters(TTree * tree_Clusters, Uniformity::DetectorMPGD &inputDet);
+            
+            //Given a cluster cache (see ClusterCache.h)
+            //Applies the cluster selection and stores those selected clusters in inputDet
+            virtual void setClusters(Uniformity::ClusterCacheReader & inputCache, Uniformity::DetectorMPGD &inputDet);
+            
             //Sets the clusters found in event number iEvtNum in TTree inputTree to event inputEvt
             //virtual void setClusters(Uniformity::Event &inputEvt, TTree * inputTree, int iEvtNum);
             
@@ -86,6 +97,14 @@ namespace QualityControl {
                 return;
             };
             
+            //As above but overwrites the stored AnalysisSetupUniformity object
+            //Input is a TTree *
+            virtual void setClusters(TTree * tree_Clusters, Uniformity::DetectorMPGD &inputDet, Uniformity::AnalysisSetupUniformity inputSetup){
+                setAnalysisParameters(inputSetup);
+                setClusters(tree_Clusters, inputDet);
+                return;
+            };
+            
         private:
             //Actions - Methods that Do Something
             //------------------------------------------------------------------------------------------------------------------------------------------
@@ -98,7 +117,8 @@ namespace QualityControl {
             
             //Setters - Methods that Set Something
             //------------------------------------------------------------------------------------------------------------------------------------------
-            
+            //As setClusters(TTree *, DetectorMPGD &); if ptr_Index is not a nullptr the cluster multiplicity is taken from it
+            void setClusters(TTree * tree_Clusters, Uniformity::EventIndex * ptr_Index, Uniformity::DetectorMPGD &inputDet);
         }; //End class SelectorCluster
     } //End namespace Uniformity
 } //End namespace QualityControl
@@ -17,6 +17,7 @@
 
 //Framework Includes
 #include "DetectorMPGD.h"
+#include "EventIndex.h"
 #include "Selector.h"
 #include "UniformityUtilityTypes.h"
 #include "TimingUtilityFunctions.h"
@@ -72,6 +73,18 @@ namespace QualityControl {
             //Input is a TFile *
             virtual void setHits(TFile * file_InputRootFile, Uniformity::DetectorMPGD &inputDet);
             
+            //Given the THit tree (or a TChain of THit trees) from amoreSRS
+            //Applies the hit selection and stores those selected hits in inputDet
+            //Input is a TTree *, event numbers are the tree (chain) entry numbers
+            virtual void setHits(TTree * tree_Hits, Uniformity::DetectorMPGD &inputDet);
+            
+            //As above but overwrites the stored AnalysisSetupUniformity object
+            //Input is a TTree *
+            virtual void setHits(TTree * tree_Hits, Uniformity::DetectorMPGD &inputDet, Uniformity::AnalysisSetupUniformity inputSetup){
+                setAnalysisParameters(inputSetup);
+                setHits(tree_Hits, inputDet);
+                return;
+            };
             
             //As above but overwrites the stored AnalysisSetupUniformity object
             //Input is a std::string storing the physical filename
@@ -101,6 +114,8 @@ namespace QualityControl {
             
             //Setters - Methods that Set Something
             //------------------------------------------------------------------------------------------------------------------------------------------
+            //As setHits(TTree *, DetectorMPGD &); if ptr_Index is not a nullptr the hit multiplicity is taken from it
+            void setHits(TTree * tree_Hits, Uniformity::EventIndex * ptr_Index, Uniformity::DetectorMPGD &inputDet);
         }; //End class SelectorHit
     } //End namespace Uniformity
 } //End namespace QualityControl
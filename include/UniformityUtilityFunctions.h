@@ -46,7 +46,7 @@ namespace QualityControl {
         //iFirstEvt -> a starting event number
         //iNEvt -> a desired number of events
         //iNTreeEntries -> a total number of events ()
-        //Returns a valid event range to loop over
+        //Returns a valid event range to loop over, [first, second)
         std::pair<int,int> getEventRange(int iFirstEvt, int iNEvt, int iNTreeEntries);
         
         //Recursive function, like std::ceil but rounds tInput upward, returning the smallest integral power of 10 that is not less than tInput.
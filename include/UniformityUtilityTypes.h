@@ -10,15 +10,18 @@
 #define _UniformityUtilityTypes_h
 
 //C++ Includes
+#include <bitset>
 #include <map>
 #include <set>
 #include <stdio.h>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 //Framework Includes
 #include "PlotterUtilityTypes.h"
+#include "RunHistoryStore.h"
 #include "TimingUtilityTypes.h"
 
 //ROOT Includes
@@ -60,11 +63,129 @@ namespace QualityControl {
             } //End SelParamClusters Initial Values
         }; //End SelParamClusters
         
+        //Maximum number of readout strips per iEta sector that can be masked
+        const int iStripMask_NStrips = 1024;
+        
+        //Mask of readout strips to be rejected by the selectors
+        //One bitset per iEta sector; bit i set -> strip i (e.g. strip from amoreSRS) is masked
+        struct StripMask{
+            std::map<int, std::bitset<iStripMask_NStrips> > map_maskEta;   //key value understood as iEta
+            
+            //true -> no strips are masked
+            bool empty() const { return map_maskEta.empty(); };
+            
+            //true -> strip iStrip of sector iEta is masked
+            bool isMasked(int iEta, int iStrip) const{
+                if (iStrip < 0 || iStrip >= iStripMask_NStrips) return false;
+                
+                auto iterEta = map_maskEta.find(iEta);
+                
+                return ( iterEta != map_maskEta.end() && (*iterEta).second.test(iStrip) );
+            };
+            
+            //Masks strip iStrip of sector iEta
+            void setMasked(int iEta, int iStrip){
+                if (iStrip < 0 || iStrip >= iStripMask_NStrips) return;
+                
+                map_maskEta[iEta].set(iStrip);
+                return;
+            };
+            
+            //Returns the total number of masked strips
+            int getNumMasked() const{
+                int iRetVal = 0;
+                for (auto iterEta = map_maskEta.begin(); iterEta != map_maskEta.end(); ++iterEta) {
+                    iRetVal += (*iterEta).second.count();
+                }
+                
+                return iRetVal;
+            };
+            
+            void clear(){ map_maskEta.clear(); return; };
+        }; //End StripMask
+        
+        //Converged fit of one slice; used as the starting point for the same slice in a later run
+        struct FitSeed{
+            float fPos_Min, fPos_Max;       //Cluster position range of the slice; a seed is only used by a slice covering the same range
+            float fRange_Min, fRange_Max;   //Fit range used
+            
+            std::vector<float> vec_fParam;  //Converged fit parameters
+            
+            FitSeed(){
+                fPos_Min = fPos_Max = 0.;
+                fRange_Min = fRange_Max = 0.;
+            }
+        }; //End FitSeed
+        
+        //Converged slice fits of a previous run
+        struct FitSeedStore{
+            std::map<std::tuple<int,int,int>, FitSeed> map_seeds;   //key value understood as (iEta, iPhi, iSlice)
+            
+            //true -> no seeds are stored
+            bool empty() const { return map_seeds.empty(); };
+            
+            //true -> a seed exists for (iEta, iPhi, iSlice)
+            bool hasSeed(int iEta, int iPhi, int iSlice) const{
+                return ( map_seeds.count( std::make_tuple(iEta, iPhi, iSlice) ) > 0 );
+            };
+            
+            //Returns the seed of (iEta, iPhi, iSlice); check hasSeed() first
+            const FitSeed & getSeed(int iEta, int iPhi, int iSlice) const{
+                return map_seeds.at( std::make_tuple(iEta, iPhi, iSlice) );
+            };
+            
+            //Stores the seed of (iEta, iPhi, iSlice)
+            void setSeed(int iEta, int iPhi, int iSlice, FitSeed & inputSeed){
+                map_seeds[std::make_tuple(iEta, iPhi, iSlice)] = inputSeed;
+                return;
+            };
+            
+            void clear(){ map_seeds.clear(); return; };
+        }; //End FitSeedStore
+        
+        //Fit-free estimate of the peak of an ADC spectrum
+        struct PeakEstimate{
+            bool bValid;            //true -> enough entries & a peak was found
+            
+            float fPkPos, fPkPosErr;        //Peak position & its (statistical) uncertainty
+            float fPkWidth, fPkWidthErr;    //Peak FWHM & its (statistical) uncertainty
+            
+            PeakEstimate(){
+                bValid = false;
+                fPkPos = fPkPosErr = fPkWidth = fPkWidthErr = 0.;
+            }
+        }; //End PeakEstimate
+        
         //Analysis Setup
         struct AnalysisSetupUniformity{
+            bool bClusterCache_Use;     //true -> clusters are read from the cluster cache next to each input file (created from the TCluster tree if missing or outdated)
+            bool bEventIndex_Use;       //true -> the multiplicity cut is applied using the event index next to each input file (created from the input file if missing or outdated)
+            bool bUniformityAdaptive;   //true -> slices are merged/split before fitting so each holds at least iUniformityMinClusters clusters
+            
             int iEvt_First;  //Starting Event For Analysis
             int iEvt_Total;    //Total number of Events to Analyze
             int iUniformityGranularity; //Each iPhi sector is partitioned into this many slices
+            int iUniformityMinClusters; //Adaptive slicing: minimum number of clusters in a slice
+            int iUniformitySplitMax;    //Adaptive slicing: maximum number of pieces one of the iUniformityGranularity slices may be split into
+            
+            bool bUniformityHistos2D;   //true -> book the cluster 2D histograms (ADC vs Pos, Size, Time; Size vs Pos); slice histograms are always filled directly
+            
+            bool bRunHistory_Full;      //true -> book the full per run ADC & Time vs Event Number histograms; the run history summaries are always kept
+            int iRunHistory_NBins;      //Maximum number of history bins in the run history summaries; runs are merged beyond this
+            int iRunHistory_SketchBins; //Number of bins of the quantile sketch in each history bin
+            
+            float fStripHealth_PVal_Dead;   //Poisson probability below which a strip is considered dead in a run
+            float fStripHealth_NSigma_Hot;  //Number of sigma above the sector median occupancy for a strip to be considered hot in a run
+            
+            float fFitSeed_GainScale;       //Expected gain of this run relative to the run strFile_FitSeed was made from; scales the seeded peak position, widths, & fit range
+            
+            bool bMemory_Report;            //true -> print the estimated memory held by the analysis objects after each run
+            float fMemory_Budget;           //Memory budget for the analysis objects in MB; when the projection exceeds it the per run histories are no longer booked (non-positive -> no budget)
+            
+            std::string strFile_StripMask;  //Name of input strip mask file; strips listed here are rejected by the selectors
+            std::string strFile_FitSeed;    //Name of input fit seed file; slice fits start from the converged parameters stored here
+            
+            std::string strUniformityFitMode;   //"FIT" -> slices are fit; "FAST" -> fit-free peak estimate only; "FAST_SEED" -> the estimate seeds the fit
             
             Plotter::InfoFit fitSetup_clustADC;
             
@@ -84,9 +205,34 @@ namespace QualityControl {
             
             //Initialization
             AnalysisSetupUniformity(){
+                bClusterCache_Use = false;
+                bEventIndex_Use = false;
+                bUniformityAdaptive = false;
+                
                 iEvt_First =  0;
                 iEvt_Total = -1;
                 iUniformityGranularity = 4;
+                iUniformityMinClusters = 1000;
+                iUniformitySplitMax = 4;
+                
+                bUniformityHistos2D = true;
+                
+                bRunHistory_Full = true;
+                iRunHistory_NBins = 64;
+                iRunHistory_SketchBins = 50;
+                
+                fStripHealth_PVal_Dead = 1e-6;
+                fStripHealth_NSigma_Hot = 5.;
+                
+                fFitSeed_GainScale = 1.;
+                
+                bMemory_Report = false;
+                fMemory_Budget = -1.;
+                
+                strFile_FitSeed = "";
+                
+                strUniformityFitMode = "FIT";
+                strFile_StripMask = "";
             } //End Initialization
         }; //End AnalysisSetupUniformity
         
@@ -101,13 +247,18 @@ namespace QualityControl {
             bool bAnaStep_Hits;                 //true -> perform the hit analysis (NOTE if bAnaStep_Reco is true this must also be true); false -> do not
             bool bAnaStep_Visualize;            //true -> make summary plots at end of analysis; false -> do not
             
+            int iAna_NThreads;                  //Number of threads the selection & histogram filling of one run is split over; 1 -> in series
+            
             bool bRecoStep_All;                 //true -> reconstruct hits & clusters; false -> do not;
             //bool bRecoStep_Clusters;
             //bool bRecoStep_Hits;
             
             //Setup - Comparison
             std::string strIdent;               //Unique identifier in input runs
-            std::string strObsName;             //Name of Observable to be compared across inputs
+            std::string strObsName;             //Name of Observable to be compared across inputs; may be a comma separated list
+            
+            int iComp_CacheSize;                //Maximum number of histograms held in the comparison input cache
+            int iComp_NThreads;                 //Number of threads used to read the comparison input files
             
             //Setup - Detector
             int iEta, iPhi, iSlice;             //Position within the detector
@@ -115,11 +266,14 @@ namespace QualityControl {
             std::string strDetName;             //Name of the detector
 
             //Setup - I/O
+            bool bInputChain;                   //true -> the files of one run list line are read as a single run (TChain or one raw stream); false -> one run per file
             bool bInputFromFrmwrk;              //true -> input file is a framework output file, not from amoreSRS; false -> input file(s) are from amoreSRS
             //bool bInputIsRaw;                   //true -> input is a raw file; false -> it is a root file
             bool bLoadSuccess;
             bool bMultiOutput;                  //true -> one output file per input run; false -> one output file representing the "sum" of the input runs
             
+            int iInputChain_NThreads;           //Number of threads used to open the files of a chained run
+            
             std::string strFile_Config_Reco;    //Name of reco config file
             std::string strFile_Config_Ana;     //Name of analysis config file
             std::string strFile_Config_Map;     //Name of mapping file
@@ -132,6 +286,8 @@ namespace QualityControl {
             bool bVisPlots_PhiLines;            //true -> summary plots have phi lines segmenting sectors; false -> they do not
             bool bVisPlots_AutoSaving;          //true -> automatically save canvases during visualize step; false -> do not
             
+            int iVisPlots_NWorkers;             //Number of processes used to render the summary canvases; 1 -> render in series
+            
             std::string strDrawOption;
 
             //Default constructor
@@ -142,6 +298,8 @@ namespace QualityControl {
                 //Setup - Analyzer
                 bAnaStep_Clusters = bAnaStep_Fitting = bAnaStep_Hits = bAnaStep_Visualize = true;
                 
+                iAna_NThreads = 1;
+                
                 //Setup - Reconstruction
                 //bInputIsRaw = false;
                 bRecoStep_All = false;
@@ -151,6 +309,9 @@ namespace QualityControl {
                 strIdent = "RUN";
                 strObsName = "CLUSTADC";
                 
+                iComp_CacheSize = 256;
+                iComp_NThreads = 1;
+                
                 //Setup - Detector
                 iEta = 4;
                 iPhi = 2;
@@ -159,7 +320,8 @@ namespace QualityControl {
                 strDetName = "Detector";
 
                 //Setup - I/O
-                bInputFromFrmwrk = bMultiOutput = false;
+                bInputChain = bInputFromFrmwrk = bMultiOutput = false;
+                iInputChain_NThreads = 1;
                 bLoadSuccess = false;   //This is set to true if the struct is loaded successfully
 
                 strFile_Config_Reco = "config/configReco.cfg";
@@ -173,6 +335,8 @@ namespace QualityControl {
                 bDrawNormalized = false;
                 bVisPlots_PhiLines = true;
                 bVisPlots_AutoSaving = false;
+                
+                iVisPlots_NWorkers = 1;
 
                 strDrawOption = "E1";
             } //End Default constructor
@@ -281,6 +445,10 @@ namespace QualityControl {
             std::map<int, std::shared_ptr<TH2F> > map_hADC_v_EvtNum_by_Run; //ADC vs Event Number for all physics objects (time series) for a given run (map_hADC_v_EvtNum_by_Run.first)
             std::map<int, std::shared_ptr<TH2F> > map_hTime_v_EvtNum_by_Run; //Time vs Event Number for all physics objects (time series) for a given run (map_hTime_v_EvtNum_by_Run.first)
             
+            //Run History Summaries; fixed size, independent of the number of runs
+            RunHistoryStore storeADC_v_Run;     //ADC vs Run for all physics objects
+            RunHistoryStore storeTime_v_Run;    //Time vs Run for all physics objects
+            
             //Default Constructor
             HistosPhysObj(){
                 
@@ -304,6 +472,9 @@ namespace QualityControl {
                 
                 map_hADC_v_EvtNum_by_Run    = other.map_hADC_v_EvtNum_by_Run;
                 map_hTime_v_EvtNum_by_Run   = other.map_hTime_v_EvtNum_by_Run;
+                
+                storeADC_v_Run  = other.storeADC_v_Run;
+                storeTime_v_Run = other.storeTime_v_Run;
             } //End Copy Constructor
             
             //Assignment operator
@@ -325,6 +496,9 @@ namespace QualityControl {
                     
                     map_hADC_v_EvtNum_by_Run    = other.map_hADC_v_EvtNum_by_Run;
                     map_hTime_v_EvtNum_by_Run   = other.map_hTime_v_EvtNum_by_Run;
+                    
+                    storeADC_v_Run  = other.storeADC_v_Run;
+                    storeTime_v_Run = other.storeTime_v_Run;
                 } //Protects against invalid self-assignment
                 
                 return *this;
@@ -411,10 +585,12 @@ namespace QualityControl {
         //Defines a slice of a phi sector within the detector
         struct SectorSlice{
             bool bFitAccepted;
+            bool bEstimate;     //true -> the slice result comes from the fit-free estimator, no fit was performed
 
             float fPos_Center;    //Center of the slice;
             float fWidth;       //Width of the slice;
             
+            int iBin_Low, iBin_High;    //Range of x-bins of the iPhi sector's clustADC_v_clustPos histogram covered by the slice
             int iMinuitStatus;	//Minuit Status Code
 
             //One dimensional fits
@@ -431,17 +607,22 @@ namespace QualityControl {
             //Default Constructor
             SectorSlice(){
                 bFitAccepted = false;
+                bEstimate = false;
                 fPos_Center = fWidth = -1;
+                iBin_Low = iBin_High = -1;
                 iMinuitStatus  = 0;
             } //End Default Constructor
             
             //Copy Constructor
             SectorSlice(const SectorSlice& other){
                 bFitAccepted = other.bFitAccepted;
+                bEstimate = other.bEstimate;
 
                 fPos_Center = other.fPos_Center;
                 fWidth      = other.fWidth;
                 
+                iBin_Low    = other.iBin_Low;
+                iBin_High   = other.iBin_High;
                 iMinuitStatus  = other.iMinuitStatus;
 
                 //Deep copy
@@ -453,10 +634,13 @@ namespace QualityControl {
             SectorSlice & operator=(const SectorSlice & other){
                 if (this != &other ) { //Protects against invalid self-assignment
                     bFitAccepted= other.bFitAccepted;
+                    bEstimate   = other.bEstimate;
 
                     fPos_Center = other.fPos_Center;
                     fWidth      = other.fWidth;
                     
+                    iBin_Low    = other.iBin_Low;
+                    iBin_High   = other.iBin_High;
                     iMinuitStatus  = other.iMinuitStatus;
 
                     //Deep copy
@@ -19,6 +19,7 @@
 #include <vector>
 
 //Framework Includes
+#include "ComparisonInput.h"
 #include "Visualizer.h"
 
 //ROOT Includes
@@ -51,6 +52,8 @@ namespace QualityControl {
             
             //Draws a given observable onto a single pad of canvas
             //Takes a std::string which stores the physical filename as input
+            //strObsName may be a comma separated list of observables; one canvas is drawn per observable
+            //and all requested histograms are read from the input files up front
             virtual void storeCanvasComparisonHisto(std::string strOutputROOTFileName, std::string strOption, std::string strObsName);
             
             //Draws a given observable onto a single pad of canvas
@@ -71,12 +74,19 @@ namespace QualityControl {
             //Sets the input identifier
             virtual void setIdentifier(std::string strInput){ m_strIdent = strInput; return; };
             
+            //Sets the maximum number of histograms held in the input cache
+            virtual void setInputCacheSize(int iInput){ m_input.setCacheSize(iInput); return; };
+            
             //Sets the input files to be considered
             virtual void setInputFiles(std::vector<std::string> vec_strInput){
                 m_vec_strFileList = vec_strInput;
+                m_input.setInputFiles(vec_strInput);
                 return;
             };
             
+            //Sets the number of threads used to read the input files
+            virtual void setInputNThreads(int iInput){ m_input.setNThreads(iInput); return; };
+            
             //Should the created distributions be normalized?
             virtual void setNormalize(bool bInput){ m_bNormalize = bInput; return; };
 
@@ -108,7 +118,14 @@ namespace QualityControl {
             
             //Getters - Methods that Get (i.e. Return) Something
             //------------------------------------------------------------------------------------------------------------------------------------------
-            virtual std::shared_ptr<TH1F> getObsHisto(TFile * file_InputRootFile, std::string strObsName);
+            //Returns a map of index in m_vec_strFileList (key) and identifier (value) for each input file whose name contains m_strIdent
+            virtual std::map<int, std::string> getIdentifiedFiles();
+            
+            //Returns the histogram of an observable from input file iFile
+            virtual std::shared_ptr<TH1F> getObsHisto(int iFile, std::string strObsName);
+            
+            //Returns the path of an observable's histogram inside an input file
+            virtual std::string getObsHistoPath(std::string strObsName);
             
             //Returns a map of identifier (key) and observable histogram
             virtual std::map<std::string, std::shared_ptr<TH1F> > getObsHistoMap(std::string strObsName);
@@ -129,6 +146,8 @@ namespace QualityControl {
             
             std::vector<std::string> m_vec_strFileList;
             
+            Uniformity::ComparisonInput m_input;
+            
         }; //End class VisualizeComparison
     } //End namespace Uniformity
 } //End namespace QualityControl
@@ -0,0 +1,89 @@
+//
+//  VisualizeRenderPool.h
+//
+//
+//
+//
+
+#ifndef ____VisualizeRenderPool__
+#define ____VisualizeRenderPool__
+
+//C++ Includes
+#include <functional>
+#include <stdio.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+//Framework Includes
+#include "TimingUtilityFunctions.h"
+#include "UniformityUtilityFunctions.h"
+
+//ROOT Includes
+#include "TClass.h"
+#include "TDirectory.h"
+#include "TFile.h"
+#include "TKey.h"
+#include "TROOT.h"
+
+namespace QualityControl {
+    namespace Uniformity {
+        //A canvas job writes its canvases into the TFile it is given (e.g. a call to one of the VisualizeUniformity::store* methods)
+        typedef std::function<void(TFile *)> CanvasJob;
+
+        class VisualizeRenderPool {
+
+        public:
+            //Constructors
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Default
+            VisualizeRenderPool();
+
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Adds a canvas job; jobs are merged into the output file in the order they are added
+            virtual void addJob(std::string strJobName, CanvasJob job){
+                vec_jobs.push_back( std::make_pair(strJobName, job) );
+                return;
+            };
+
+            //Wipes all stored jobs
+            virtual void clear(){ vec_jobs.clear(); return; };
+
+            //Renders all stored jobs and writes the canvases into file_Results
+            //iNWorkers <= 1 -> jobs are run serially in this process directly on file_Results
+            //iNWorkers > 1  -> jobs are dealt round-robin to iNWorkers forked processes (ROOT graphics is not thread-safe)
+            //                  each job writes to its own temporary file, which is merged into file_Results in job order
+            //                  jobs whose worker failed are re-run serially in this process
+            //Stored jobs are cleared afterwards
+            virtual void render(TFile * file_Results, int iNWorkers);
+
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the number of stored jobs
+            virtual int getNumJobs(){ return vec_jobs.size(); };
+
+        private:
+            //Actions - Methods that Do Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Recursively copies every object (and sub-directory) of dir_Source into dir_Target
+            virtual void mergeDirectory(TDirectory * dir_Source, TDirectory * dir_Target);
+
+            //Runs the jobs assigned to worker iWorker; only called in a forked process
+            virtual void runWorker(int iWorker, int iNWorkers, std::string & strTempFileBase);
+
+            //Getters - Methods that Get (i.e. Return) Something
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            //Returns the name of the temporary file of job iJob
+            virtual std::string getTempFileName(std::string & strTempFileBase, int iJob){
+                return strTempFileBase + "_renderJob" + Timing::getString(iJob) + ".root";
+            };
+
+            //Attributes
+            //------------------------------------------------------------------------------------------------------------------------------------------
+            std::vector<std::pair<std::string, CanvasJob> > vec_jobs; //first -> job name (for messages); second -> job
+        }; //End class VisualizeRenderPool
+    } //End namespace Uniformity
+} //End namespace QualityControl
+
+#endif /* defined(____VisualizeRenderPool__) */
@@ -196,7 +196,10 @@ namespace QualityControl {
             
             virtual std::map<int, std::shared_ptr<TH2F> > getMapObsHisto2D(std::string strObsName, Uniformity::ReadoutSector &inputSector);
             
-            virtual std::shared_ptr<TH2F> getSummarizedRunHistoryHisto2D(std::map<int, std::shared_ptr<TH2F> > inputMapHisto2D, int iEta, int iPhi );
+            //Returns the run history summary of strObsName; an empty store if the observable has none
+            virtual Uniformity::RunHistoryStore getObsRunHistoryStore(std::string strObsName, Uniformity::ReadoutSector &inputSector);
+            
+            virtual std::shared_ptr<TH2F> getSummarizedRunHistoryHisto2D(std::map<int, std::shared_ptr<TH2F> > & inputMapHisto2D, int iEta, int iPhi );
             
             //Printers - Methods that Print Something
             //------------------------------------------------------------------------------------------------------------------------------------------
@@ -1,23 +1,23 @@
 #!/bin/zsh
 #Usage:
-#	source makeAllPlots.sh <Plot Config File Directory>
+#	source makeAllPlots.sh <Plot Config File Directory> <Number of Workers (Optional)> <Image Formats (Optional)>
+#		Image Formats: comma separated list, default C,eps,pdf,png
 
 #store the original directory
 DIR_ORIG=$PWD
 
 #setup input variables
 DIR_CONFIG=$1
+NUM_WORKERS=${2:-1}
+IMG_FORMATS=${3:-"C,eps,pdf,png"}
 
 #Move to the data directory
 cd $DIR_CONFIG
 
-#Make Plots
-for f in *.cfg
-do
-	echo "=============================================="
-	echo "Making plot from file:" $f
-	$GEM_BASE/genericPlotter $f false
-done
+#Make Plots; all config files are handled by a single call in batch mode
+echo "=============================================="
+echo "Making plots from files:" *.cfg
+$GEM_BASE/genericPlotter --batch $IMG_FORMATS $NUM_WORKERS *.cfg
 
 echo "=============================================="
 echo "All Plots Have Been Made!"
@@ -44,6 +44,148 @@ AnalyzeResponseUniformity::AnalyzeResponseUniformity(AnalysisSetupUniformity inp
     detMPGD = inputDet;
 } //End Constructor
 
+//Prepares inputDetWorker, a copy of the detector, to be filled by one thread
+void AnalyzeResponseUniformity::initHistosWorker(DetectorMPGD & inputDetWorker){
+    //The thread only holds the physics objects it selects
+    inputDetWorker.resetPhysObj();
+    
+    //Detector Level
+    if ( inputDetWorker.hMulti_Clust != nullptr ) { inputDetWorker.hMulti_Clust->Reset(); }
+    if ( inputDetWorker.hMulti_Hit != nullptr ) { inputDetWorker.hMulti_Hit->Reset(); }
+    
+    //Loop Over Stored iEta Sectors
+    for (auto iterEta = inputDetWorker.map_sectorsEta.begin(); iterEta != inputDetWorker.map_sectorsEta.end(); ++iterEta) { //Loop Over iEta Sectors
+        initHistosWorker( (*iterEta).second.clustHistos );
+        initHistosWorker( (*iterEta).second.hitHistos );
+        
+        //Loop Over Stored iPhi Sectors
+        for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); ++iterPhi) { //Loop Over iPhi Sectors
+            initHistosWorker( (*iterPhi).second.clustHistos );
+            initHistosWorker( (*iterPhi).second.hitHistos );
+            
+            //Loop Over Stored Slices
+            for (auto iterSlice = (*iterPhi).second.map_slices.begin(); iterSlice != (*iterPhi).second.map_slices.end(); ++iterSlice) { //Loop Over Slices
+                if ( (*iterSlice).second.hSlice_ClustADC != nullptr ) { (*iterSlice).second.hSlice_ClustADC->Reset(); }
+            } //End Loop Over Slices
+        } //End Loop Over iPhi Sectors
+    } //End Loop Over iEta Sectors
+    
+    return;
+} //End AnalyzeResponseUniformity::initHistosWorker() - DetectorMPGD
+
+//As above, for the histograms of one sector; the 1D & 2D histograms are already deep copies (see HistosPhysObj)
+void AnalyzeResponseUniformity::initHistosWorker(HistosPhysObj & inputHistosWorker){
+    //Variable Declaration
+    std::map<int, std::shared_ptr<TH2F> > map_hADC_v_EvtNum;
+    std::map<int, std::shared_ptr<TH2F> > map_hTime_v_EvtNum;
+    
+    if ( inputHistosWorker.hADC != nullptr ) { inputHistosWorker.hADC->Reset(); }
+    if ( inputHistosWorker.hMulti != nullptr ) { inputHistosWorker.hMulti->Reset(); }
+    if ( inputHistosWorker.hPos != nullptr ) { inputHistosWorker.hPos->Reset(); }
+    if ( inputHistosWorker.hSize != nullptr ) { inputHistosWorker.hSize->Reset(); }
+    if ( inputHistosWorker.hTime != nullptr ) { inputHistosWorker.hTime->Reset(); }
+    
+    if ( inputHistosWorker.hADC_v_Pos != nullptr ) { inputHistosWorker.hADC_v_Pos->Reset(); }
+    if ( inputHistosWorker.hADC_v_Size != nullptr ) { inputHistosWorker.hADC_v_Size->Reset(); }
+    if ( inputHistosWorker.hADC_v_Time != nullptr ) { inputHistosWorker.hADC_v_Time->Reset(); }
+    if ( inputHistosWorker.hADCMax_v_ADCInt != nullptr ) { inputHistosWorker.hADCMax_v_ADCInt->Reset(); }
+    if ( inputHistosWorker.hSize_v_Pos != nullptr ) { inputHistosWorker.hSize_v_Pos->Reset(); }
+    
+    //The per run histograms are shared by copies; keep a private, empty copy of the current run only
+    if ( inputHistosWorker.map_hADC_v_EvtNum_by_Run.count(iNum_Run) > 0 ) {
+        map_hADC_v_EvtNum[iNum_Run] = std::make_shared<TH2F>( *inputHistosWorker.map_hADC_v_EvtNum_by_Run[iNum_Run].get() );
+        map_hADC_v_EvtNum[iNum_Run]->Reset();
+    }
+    
+    if ( inputHistosWorker.map_hTime_v_EvtNum_by_Run.count(iNum_Run) > 0 ) {
+        map_hTime_v_EvtNum[iNum_Run] = std::make_shared<TH2F>( *inputHistosWorker.map_hTime_v_EvtNum_by_Run[iNum_Run].get() );
+        map_hTime_v_EvtNum[iNum_Run]->Reset();
+    }
+    
+    inputHistosWorker.map_hADC_v_EvtNum_by_Run.swap(map_hADC_v_EvtNum);
+    inputHistosWorker.map_hTime_v_EvtNum_by_Run.swap(map_hTime_v_EvtNum);
+    
+    //The binning of the run history summaries is kept
+    inputHistosWorker.storeADC_v_Run.clear();
+    inputHistosWorker.storeTime_v_Run.clear();
+    
+    return;
+} //End AnalyzeResponseUniformity::initHistosWorker() - HistosPhysObj
+
+//Adds the histograms, run history summaries & physics objects filled by one thread in inputDetWorker to inputDet
+void AnalyzeResponseUniformity::mergeHistosWorker(DetectorMPGD & inputDet, DetectorMPGD & inputDetWorker){
+    //Detector Level
+    if ( inputDet.hMulti_Clust != nullptr && inputDetWorker.hMulti_Clust != nullptr ) { inputDet.hMulti_Clust->Add( inputDetWorker.hMulti_Clust.get() ); }
+    if ( inputDet.hMulti_Hit != nullptr && inputDetWorker.hMulti_Hit != nullptr ) { inputDet.hMulti_Hit->Add( inputDetWorker.hMulti_Hit.get() ); }
+    
+    //Loop Over Stored iEta Sectors
+    for (auto iterEta = inputDet.map_sectorsEta.begin(); iterEta != inputDet.map_sectorsEta.end(); ++iterEta) { //Loop Over iEta Sectors
+        auto iterEtaWorker = inputDetWorker.map_sectorsEta.find( (*iterEta).first );
+        
+        if ( iterEtaWorker == inputDetWorker.map_sectorsEta.end() ) continue;
+        
+        mergeHistosWorker( (*iterEta).second.clustHistos, (*iterEtaWorker).second.clustHistos );
+        mergeHistosWorker( (*iterEta).second.hitHistos, (*iterEtaWorker).second.hitHistos );
+        
+        //Loop Over Stored iPhi Sectors
+        for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); ++iterPhi) { //Loop Over iPhi Sectors
+            auto iterPhiWorker = (*iterEtaWorker).second.map_sectorsPhi.find( (*iterPhi).first );
+            
+            if ( iterPhiWorker == (*iterEtaWorker).second.map_sectorsPhi.end() ) continue;
+            
+            mergeHistosWorker( (*iterPhi).second.clustHistos, (*iterPhiWorker).second.clustHistos );
+            mergeHistosWorker( (*iterPhi).second.hitHistos, (*iterPhiWorker).second.hitHistos );
+            
+            //Loop Over Stored Slices
+            for (auto iterSlice = (*iterPhi).second.map_slices.begin(); iterSlice != (*iterPhi).second.map_slices.end(); ++iterSlice) { //Loop Over Slices
+                auto iterSliceWorker = (*iterPhiWorker).second.map_slices.find( (*iterSlice).first );
+                
+                if ( iterSliceWorker == (*iterPhiWorker).second.map_slices.end() ) continue;
+                
+                if ( (*iterSlice).second.hSlice_ClustADC != nullptr && (*iterSliceWorker).second.hSlice_ClustADC != nullptr ) {
+                    (*iterSlice).second.hSlice_ClustADC->Add( (*iterSliceWorker).second.hSlice_ClustADC.get() );
+                }
+            } //End Loop Over Slices
+            
+            //Physics Objects; event numbers of different threads do not overlap
+            (*iterPhi).second.map_clusters.insert( (*iterPhiWorker).second.map_clusters.begin(), (*iterPhiWorker).second.map_clusters.end() );
+            (*iterPhi).second.map_hits.insert( (*iterPhiWorker).second.map_hits.begin(), (*iterPhiWorker).second.map_hits.end() );
+        } //End Loop Over iPhi Sectors
+    } //End Loop Over iEta Sectors
+    
+    return;
+} //End AnalyzeResponseUniformity::mergeHistosWorker() - DetectorMPGD
+
+//As above, for the histograms of one sector; empty histograms are skipped
+void AnalyzeResponseUniformity::mergeHistosWorker(HistosPhysObj & inputHistos, HistosPhysObj & inputHistosWorker){
+    if ( inputHistos.hADC != nullptr && inputHistosWorker.hADC != nullptr && inputHistosWorker.hADC->GetEntries() > 0 ) { inputHistos.hADC->Add( inputHistosWorker.hADC.get() ); }
+    if ( inputHistos.hMulti != nullptr && inputHistosWorker.hMulti != nullptr && inputHistosWorker.hMulti->GetEntries() > 0 ) { inputHistos.hMulti->Add( inputHistosWorker.hMulti.get() ); }
+    if ( inputHistos.hPos != nullptr && inputHistosWorker.hPos != nullptr && inputHistosWorker.hPos->GetEntries() > 0 ) { inputHistos.hPos->Add( inputHistosWorker.hPos.get() ); }
+    if ( inputHistos.hSize != nullptr && inputHistosWorker.hSize != nullptr && inputHistosWorker.hSize->GetEntries() > 0 ) { inputHistos.hSize->Add( inputHistosWorker.hSize.get() ); }
+    if ( inputHistos.hTime != nullptr && inputHistosWorker.hTime != nullptr && inputHistosWorker.hTime->GetEntries() > 0 ) { inputHistos.hTime->Add( inputHistosWorker.hTime.get() ); }
+    
+    if ( inputHistos.hADC_v_Pos != nullptr && inputHistosWorker.hADC_v_Pos != nullptr && inputHistosWorker.hADC_v_Pos->GetEntries() > 0 ) { inputHistos.hADC_v_Pos->Add( inputHistosWorker.hADC_v_Pos.get() ); }
+    if ( inputHistos.hADC_v_Size != nullptr && inputHistosWorker.hADC_v_Size != nullptr && inputHistosWorker.hADC_v_Size->GetEntries() > 0 ) { inputHistos.hADC_v_Size->Add( inputHistosWorker.hADC_v_Size.get() ); }
+    if ( inputHistos.hADC_v_Time != nullptr && inputHistosWorker.hADC_v_Time != nullptr && inputHistosWorker.hADC_v_Time->GetEntries() > 0 ) { inputHistos.hADC_v_Time->Add( inputHistosWorker.hADC_v_Time.get() ); }
+    if ( inputHistos.hADCMax_v_ADCInt != nullptr && inputHistosWorker.hADCMax_v_ADCInt != nullptr && inputHistosWorker.hADCMax_v_ADCInt->GetEntries() > 0 ) { inputHistos.hADCMax_v_ADCInt->Add( inputHistosWorker.hADCMax_v_ADCInt.get() ); }
+    if ( inputHistos.hSize_v_Pos != nullptr && inputHistosWorker.hSize_v_Pos != nullptr && inputHistosWorker.hSize_v_Pos->GetEntries() > 0 ) { inputHistos.hSize_v_Pos->Add( inputHistosWorker.hSize_v_Pos.get() ); }
+    
+    //Per run histograms
+    for (auto iterHisto = inputHistosWorker.map_hADC_v_EvtNum_by_Run.begin(); iterHisto != inputHistosWorker.map_hADC_v_EvtNum_by_Run.end(); ++iterHisto) {
+        if ( inputHistos.map_hADC_v_EvtNum_by_Run.count( (*iterHisto).first ) > 0 ) { inputHistos.map_hADC_v_EvtNum_by_Run[(*iterHisto).first]->Add( (*iterHisto).second.get() ); }
+    }
+    
+    for (auto iterHisto = inputHistosWorker.map_hTime_v_EvtNum_by_Run.begin(); iterHisto != inputHistosWorker.map_hTime_v_EvtNum_by_Run.end(); ++iterHisto) {
+        if ( inputHistos.map_hTime_v_EvtNum_by_Run.count( (*iterHisto).first ) > 0 ) { inputHistos.map_hTime_v_EvtNum_by_Run[(*iterHisto).first]->Add( (*iterHisto).second.get() ); }
+    }
+    
+    //Run history summaries
+    if ( !inputHistosWorker.storeADC_v_Run.empty() ) { inputHistos.storeADC_v_Run.add( inputHistosWorker.storeADC_v_Run ); }
+    if ( !inputHistosWorker.storeTime_v_Run.empty() ) { inputHistos.storeTime_v_Run.add( inputHistosWorker.storeTime_v_Run ); }
+    
+    return;
+} //End AnalyzeResponseUniformity::mergeHistosWorker() - HistosPhysObj
+
 void AnalyzeResponseUniformity::calcStatistics(SummaryStatistics &inputStatObs, std::multiset<float> &mset_fInputObs, string strObsName){
     //Variable Declaration;
     std::vector<float> vec_fInputObsVariance;
@@ -178,6 +320,101 @@ bool AnalyzeResponseUniformity::isQualityFit(shared_ptr<TF1> fitInput, int iPar)
     return true;
 } //End AnalyzeResponseUniformity::isQualityFit()
 
+//Returns a fit-free estimate of the peak of hInput
+PeakEstimate AnalyzeResponseUniformity::getPeakEstimate(shared_ptr<TH1F> hInput){
+    //Variable Declaration
+    const float fSigma2FWHM = 2. * sqrt( 2. * log( 2. ) );
+    
+    double dEntries;
+    double dHalfMax;
+    double dNum, dDenom;
+    double dProb[2] = {0.1587, 0.8413}, dQuant[2];  //+/- 1 sigma of a gaussian
+    
+    float fDelta;
+    float fPos_Low = -1e12, fPos_High = -1e12;
+    
+    int iMaxBin = 1;
+    int iNBins;
+    
+    vector<double> vec_dSmooth;
+    
+    PeakEstimate retEstimate;
+    
+    if ( hInput == nullptr ) return retEstimate;
+    
+    iNBins      = hInput->GetNbinsX();
+    dEntries    = hInput->Integral(1, iNBins);
+    
+    //Too few entries for a meaningful estimate
+    if ( iNBins < 3 || dEntries < 10 ) return retEstimate;
+    
+    //Smooth the spectrum with a (1,2,3,2,1) kernel, i.e. a small triangular kernel density estimate
+    //------------------------------------------------------
+    vec_dSmooth.assign(iNBins + 2, 0.);
+    for (int i=1; i <= iNBins; ++i) { //Loop Over Bins
+        dNum = dDenom = 0.;
+        
+        for (int j=-2; j <= 2; ++j) {
+            if ( i + j < 1 || i + j > iNBins ) continue;
+            
+            dNum    += ( 3 - std::abs(j) ) * hInput->GetBinContent(i + j);
+            dDenom  += ( 3 - std::abs(j) );
+        }
+        
+        vec_dSmooth[i] = dNum / dDenom;
+        
+        if ( vec_dSmooth[i] > vec_dSmooth[iMaxBin] ) iMaxBin = i;
+    } //End Loop Over Bins
+    
+    //Mode: vertex of the parabola through the maximum and its neighbours
+    //------------------------------------------------------
+    retEstimate.fPkPos = hInput->GetBinCenter(iMaxBin);
+    if ( iMaxBin > 1 && iMaxBin < iNBins ) { //Case: Maximum Not on the Edge
+        dDenom = vec_dSmooth[iMaxBin-1] - 2. * vec_dSmooth[iMaxBin] + vec_dSmooth[iMaxBin+1];
+        
+        if ( dDenom < 0 ) {
+            fDelta = 0.5 * ( vec_dSmooth[iMaxBin-1] - vec_dSmooth[iMaxBin+1] ) / dDenom;
+            
+            if ( std::fabs(fDelta) <= 1. ) retEstimate.fPkPos += fDelta * hInput->GetBinWidth(iMaxBin);
+        }
+    } //End Case: Maximum Not on the Edge
+    
+    //Width: half maximum crossings, linearly interpolated
+    //------------------------------------------------------
+    dHalfMax = 0.5 * vec_dSmooth[iMaxBin];
+    
+    for (int i=iMaxBin; i > 1; --i) { //Loop Over Bins Below the Maximum
+        if ( vec_dSmooth[i-1] < dHalfMax ) {
+            fPos_Low = hInput->GetBinCenter(i-1) + hInput->GetBinWidth(i) * ( dHalfMax - vec_dSmooth[i-1] ) / ( vec_dSmooth[i] - vec_dSmooth[i-1] );
+            break;
+        }
+    } //End Loop Over Bins Below the Maximum
+    
+    for (int i=iMaxBin; i < iNBins; ++i) { //Loop Over Bins Above the Maximum
+        if ( vec_dSmooth[i+1] < dHalfMax ) {
+            fPos_High = hInput->GetBinCenter(i) + hInput->GetBinWidth(i) * ( vec_dSmooth[i] - dHalfMax ) / ( vec_dSmooth[i] - vec_dSmooth[i+1] );
+            break;
+        }
+    } //End Loop Over Bins Above the Maximum
+    
+    if ( fPos_Low > -1e12 && fPos_High > -1e12 ) { //Case: Both Crossings Found
+        retEstimate.fPkWidth = fPos_High - fPos_Low;
+    } //End Case: Both Crossings Found
+    else{ //Case: Peak Runs Off the Histogram, Use Quantiles
+        hInput->GetQuantiles(2, dQuant, dProb);
+        
+        retEstimate.fPkWidth = 0.5 * fSigma2FWHM * ( dQuant[1] - dQuant[0] );
+    } //End Case: Peak Runs Off the Histogram, Use Quantiles
+    
+    //Uncertainties as for a gaussian peak of the same width
+    retEstimate.fPkPosErr   = ( retEstimate.fPkWidth / fSigma2FWHM ) / sqrt( dEntries );
+    retEstimate.fPkWidthErr = retEstimate.fPkWidth / sqrt( 2. * dEntries );
+    
+    retEstimate.bValid = ( retEstimate.fPkPos > 0 && retEstimate.fPkWidth > 0 );
+    
+    return retEstimate;
+} //End AnalyzeResponseUniformity::getPeakEstimate()
+
 TF1 AnalyzeResponseUniformity::getFit(int iEta, int iPhi, int iSlice, InfoFit & setupFit, shared_ptr<TH1F> hInput, TSpectrum &specInput ){
     //Variable Declaration
     float fLimit_Max = hInput->GetBinLowEdge(hInput->GetNbinsX() + 1 );
@@ -19,6 +19,7 @@ using std::vector;
 
 using QualityControl::Timing::getString;
 using QualityControl::Timing::printROOTFileStatus;
+using QualityControl::Timing::printStreamStatus;
 using QualityControl::Timing::HistoSetup;
 using QualityControl::Timing::stofSafe;
 
@@ -43,6 +44,8 @@ AnalyzeResponseUniformityClusters::AnalyzeResponseUniformityClusters(AnalysisSet
 //Loops over all stored clusters in an input DetectorMPGD object and fills histograms for the full detector
 void AnalyzeResponseUniformityClusters::fillHistos(DetectorMPGD & inputDet){
     //Variable Declaration
+    int iSlice;
+    
     std::multimap<int, Cluster> map_clusters;
     vector<int> vec_iEvtList;
     
@@ -85,10 +88,15 @@ void AnalyzeResponseUniformityClusters::fillHistos(DetectorMPGD & inputDet){
                     (*iterEta).second.clustHistos.map_hTime_v_EvtNum_by_Run[iNum_Run]->Fill( (*iterClust).first, (*iterClust).second.iTimeBin );
                 }
                 
-                (*iterEta).second.clustHistos.hADC_v_Pos->Fill( (*iterClust).second.fPos_X, (*iterClust).second.fADC );
-                (*iterEta).second.clustHistos.hADC_v_Size->Fill( (*iterClust).second.iSize, (*iterClust).second.fADC );
-                (*iterEta).second.clustHistos.hADC_v_Time->Fill( (*iterClust).second.iTimeBin, (*iterClust).second.fADC );
-                (*iterEta).second.clustHistos.hSize_v_Pos->Fill( (*iterClust).second.fPos_X, (*iterClust).second.iSize );
+                (*iterEta).second.clustHistos.storeADC_v_Run.fill(iNum_Run, (*iterClust).second.fADC );
+                (*iterEta).second.clustHistos.storeTime_v_Run.fill(iNum_Run, (*iterClust).second.iTimeBin );
+                
+                if ( (*iterEta).second.clustHistos.hADC_v_Pos != nullptr ) { //Case: 2D Histograms Booked
+                    (*iterEta).second.clustHistos.hADC_v_Pos->Fill( (*iterClust).second.fPos_X, (*iterClust).second.fADC );
+                    (*iterEta).second.clustHistos.hADC_v_Size->Fill( (*iterClust).second.iSize, (*iterClust).second.fADC );
+                    (*iterEta).second.clustHistos.hADC_v_Time->Fill( (*iterClust).second.iTimeBin, (*iterClust).second.fADC );
+                    (*iterEta).second.clustHistos.hSize_v_Pos->Fill( (*iterClust).second.fPos_X, (*iterClust).second.iSize );
+                } //End Case: 2D Histograms Booked
                 
                 //Fill iPhi Histograms
                 (*iterPhi).second.clustHistos.hADC->Fill( (*iterClust).second.fADC );
@@ -100,10 +108,26 @@ void AnalyzeResponseUniformityClusters::fillHistos(DetectorMPGD & inputDet){
                     (*iterPhi).second.clustHistos.map_hTime_v_EvtNum_by_Run[iNum_Run]->Fill( (*iterClust).first, (*iterClust).second.iTimeBin );
                 }
                 
-                (*iterPhi).second.clustHistos.hADC_v_Pos->Fill( (*iterClust).second.fPos_X, (*iterClust).second.fADC );
-                (*iterPhi).second.clustHistos.hADC_v_Size->Fill( (*iterClust).second.iSize, (*iterClust).second.fADC );
-                (*iterPhi).second.clustHistos.hADC_v_Time->Fill( (*iterClust).second.iTimeBin, (*iterClust).second.fADC );
-                (*iterPhi).second.clustHistos.hSize_v_Pos->Fill( (*iterClust).second.fPos_X, (*iterClust).second.iSize );
+                (*iterPhi).second.clustHistos.storeADC_v_Run.fill(iNum_Run, (*iterClust).second.fADC );
+                (*iterPhi).second.clustHistos.storeTime_v_Run.fill(iNum_Run, (*iterClust).second.iTimeBin );
+                
+                if ( (*iterPhi).second.clustHistos.hADC_v_Pos != nullptr ) { (*iterPhi).second.clustHistos.hADC_v_Pos->Fill( (*iterClust).second.fPos_X, (*iterClust).second.fADC ); }
+                
+                if ( (*iterPhi).second.clustHistos.hADC_v_Size != nullptr ) { //Case: 2D Histograms Booked
+                    (*iterPhi).second.clustHistos.hADC_v_Size->Fill( (*iterClust).second.iSize, (*iterClust).second.fADC );
+                    (*iterPhi).second.clustHistos.hADC_v_Time->Fill( (*iterClust).second.iTimeBin, (*iterClust).second.fADC );
+                    (*iterPhi).second.clustHistos.hSize_v_Pos->Fill( (*iterClust).second.fPos_X, (*iterClust).second.iSize );
+                } //End Case: 2D Histograms Booked
+                
+                //Fill Slice Histogram - routed directly by position, no projection of hADC_v_Pos needed
+                iSlice = (*iterPhi).second.getSliceByPos( (*iterClust).second.fPos_X );
+                if ( iSlice > 0 ) { //Case: Cluster Inside a Slice
+                    auto iterSlice = (*iterPhi).second.map_slices.find(iSlice);
+                    
+                    if ( iterSlice != (*iterPhi).second.map_slices.end() && (*iterSlice).second.hSlice_ClustADC != nullptr ) {
+                        (*iterSlice).second.hSlice_ClustADC->Fill( (*iterClust).second.fADC );
+                    }
+                } //End Case: Cluster Inside a Slice
             } //End Loop Over Stored Clusters
         } //End Loop Over iPhi Sectors
     } //End Loop Over iEta Sectors
@@ -123,16 +147,32 @@ void AnalyzeResponseUniformityClusters::fitHistos(DetectorMPGD & inputDet){
     
     int iBinMin, iBinMax;	//Bins in histogram encapsulating fMin to fMax
     int iIdxPk, iIdxWidth;	//Position in fit parameter meaning container of the peak and the width parameters
+    int iNSeedsIgnored = 0; //Seeds whose slice range differs from the slice with the same (iEta, iPhi, iSlice)
+    
+    bool bSeeded;           //true -> the fit of this slice starts from a stored fit seed
+    bool bFast      = ( 0 == aSetup.strUniformityFitMode.compare("FAST") );       //true -> slices are not fit, only estimated
+    bool bFastSeed  = ( 0 == aSetup.strUniformityFitMode.compare("FAST_SEED") );  //true -> the estimate seeds the fit
     
     TSpectrum specADC(1,2);    //One peak; 2 sigma away from any other peak
     
+    FitSeed seedSlice;
+    
+    PeakEstimate estSlice;
+    
     vector<float> vec_fFitRange;
     
+    seedsOutput.clear();
+    
+    //Merge/split the slices according to their statistics before fitting
+    if ( aSetup.bUniformityAdaptive ) { setSlicesAdaptive(inputDet); }
+    
     //Loop Over Stored iEta Sectors
     for (auto iterEta = inputDet.map_sectorsEta.begin(); iterEta != inputDet.map_sectorsEta.end(); ++iterEta) { //Loop Over iEta Sectors
+        //Index in the iEta graphs of the first slice of the current iPhi sector
+        int iPointOffset = 0;
         
         //Loop Over Stored iPhi Sectors
-        for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); ++iterPhi) { //Loop Over iPhi Sectors
+        for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); iPointOffset += (*iterPhi).second.map_slices.size(), ++iterPhi) { //Loop Over iPhi Sectors
             
             //Loop Over Stored Slices
             for (auto iterSlice = (*iterPhi).second.map_slices.begin(); iterSlice != (*iterPhi).second.map_slices.end(); ++iterSlice ) { //Loop Over Slices
@@ -143,12 +183,40 @@ void AnalyzeResponseUniformityClusters::fitHistos(DetectorMPGD & inputDet){
                 if ( (*iterSlice).second.hSlice_ClustADC == nullptr ){
                     if ( (*iterPhi).second.clustHistos.hADC_v_Pos == nullptr ) continue;
                     
-                    (*iterSlice).second.hSlice_ClustADC = make_shared<TH1F>( *( (TH1F*) (*iterPhi).second.clustHistos.hADC_v_Pos->ProjectionY( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "Slice" + getString((*iterSlice).first) + "_clustADC").c_str(),(*iterSlice).first,(*iterSlice).first,"") ) );
+                    if ( (*iterSlice).second.iBin_Low < 1 ) { setSliceBins( (*iterSlice).second, (*iterPhi).second.clustHistos.hADC_v_Pos->GetXaxis(), (*iterSlice).first, (*iterSlice).first ); }
+                    
+                    (*iterSlice).second.hSlice_ClustADC = make_shared<TH1F>( *( (TH1F*) (*iterPhi).second.clustHistos.hADC_v_Pos->ProjectionY( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "Slice" + getString((*iterSlice).first) + "_clustADC").c_str(),(*iterSlice).second.iBin_Low,(*iterSlice).second.iBin_High,"") ) );
                 }
                 
                 //Skip this slice if the histogram has zero entries
                 if ( !( (*iterSlice).second.hSlice_ClustADC->GetEntries() > 0) ) continue;
                 
+                //Fit-free estimate of the peak
+                if ( bFast || bFastSeed ) { estSlice = getPeakEstimate( (*iterSlice).second.hSlice_ClustADC ); }
+                
+                if ( bFast ) { //Case: Estimate Only
+                    if ( !estSlice.bValid ) continue;
+                    
+                    int iPoint = std::distance( (*iterPhi).second.map_slices.begin(), iterSlice) + iPointOffset;
+                    
+                    (*iterPhi).second.fNFitSuccess++;
+                    (*iterSlice).second.bFitAccepted = true;
+                    (*iterSlice).second.bEstimate = true;
+                    
+                    //Store Estimate - Peak Position
+                    (*iterEta).second.gEta_ClustADC_Fit_PkPos->SetPoint(iPoint, (*iterSlice).second.fPos_Center, estSlice.fPkPos );
+                    (*iterEta).second.gEta_ClustADC_Fit_PkPos->SetPointError(iPoint, 0.5 * (*iterSlice).second.fWidth, estSlice.fPkPosErr );
+                    
+                    //Store Estimate - Peak Resolution
+                    (*iterEta).second.gEta_ClustADC_Fit_PkRes->SetPoint(iPoint, (*iterSlice).second.fPos_Center, estSlice.fPkWidth / estSlice.fPkPos );
+                    (*iterEta).second.gEta_ClustADC_Fit_PkRes->SetPointError(iPoint, 0.5 * (*iterSlice).second.fWidth, sqrt( pow( estSlice.fPkWidthErr / estSlice.fPkPos, 2) + pow( ( estSlice.fPkPosErr * estSlice.fPkWidth ) / ( estSlice.fPkPos * estSlice.fPkPos), 2 ) ) );
+                    
+                    inputDet.mset_fClustADC_Fit_PkPos.insert( estSlice.fPkPos );
+                    inputDet.mset_fClustADC_Fit_PkRes.insert( estSlice.fPkWidth / estSlice.fPkPos );
+                    
+                    continue;
+                } //End Case: Estimate Only
+                
                 //Find peak & store it's position
                 specADC.Search( (*iterSlice).second.hSlice_ClustADC.get(), 2, "nobackground", 0.5 );
                 dPeakPos = specADC.GetPositionX();
@@ -162,6 +230,57 @@ void AnalyzeResponseUniformityClusters::fitHistos(DetectorMPGD & inputDet){
                     vec_fFitRange.push_back( getParsedInput( (*iterRange), (*iterSlice).second.hSlice_ClustADC, specADC ) );
                 } //End Loop Over Fit Range
                 
+                //Warm start: take the initial values & fit range from the converged fit of this slice in a previous run
+                //Parameters with an energy scale (peak position & widths) and the range follow the expected gain change
+                bSeeded = seedsInput.hasSeed( (*iterEta).first, (*iterPhi).first, (*iterSlice).first );
+                
+                //A seed made with another Uniformity_Granularity or other adaptive slice bounds belongs to another slice
+                if ( bSeeded ) { //Case: Check the Slice Range of the Seed
+                    const FitSeed & seedInput = seedsInput.getSeed( (*iterEta).first, (*iterPhi).first, (*iterSlice).first );
+                    
+                    float fPos_Min = (*iterSlice).second.fPos_Center - 0.5 * (*iterSlice).second.fWidth;
+                    float fPos_Max = (*iterSlice).second.fPos_Center + 0.5 * (*iterSlice).second.fWidth;
+                    float fPos_Tol = 1e-3 * std::fabs( (*iterSlice).second.fWidth );
+                    
+                    if ( !( (*iterSlice).second.fWidth > 0 )
+                        || std::fabs( seedInput.fPos_Min - fPos_Min ) > fPos_Tol
+                        || std::fabs( seedInput.fPos_Max - fPos_Max ) > fPos_Tol ) {
+                        Logger::getInstance().logf(kLogDebug, "AnalyzeResponseUniformityClusters::fitHistos()", "iEta %i iPhi %i slice %i: fit seed ignored; it was made for the slice [%f, %f], this slice is [%f, %f]", (*iterEta).first, (*iterPhi).first, (*iterSlice).first, seedInput.fPos_Min, seedInput.fPos_Max, fPos_Min, fPos_Max);
+                        
+                        bSeeded = false;
+                        ++iNSeedsIgnored;
+                    }
+                } //End Case: Check the Slice Range of the Seed
+                
+                if ( bSeeded ) { //Case: Fit Seed Exists
+                    const FitSeed & seedInput = seedsInput.getSeed( (*iterEta).first, (*iterPhi).first, (*iterSlice).first );
+                    
+                    Logger::getInstance().logf(kLogDebug, "AnalyzeResponseUniformityClusters::fitHistos()", "iEta %i iPhi %i slice %i: starting from fit seed; gain scale = %f", (*iterEta).first, (*iterPhi).first, (*iterSlice).first, aSetup.fFitSeed_GainScale);
+                    
+                    for (int i=0; i < seedInput.vec_fParam.size() && i < (*iterSlice).second.fitSlice_ClustADC->GetNpar(); ++i) { //Loop Over Seeded Parameters
+                        if ( i < aSetup.fitSetup_clustADC.m_vec_strFit_ParamMeaning.size() && isGainScaled( aSetup.fitSetup_clustADC.m_vec_strFit_ParamMeaning[i] ) ) {
+                            (*iterSlice).second.fitSlice_ClustADC->SetParameter(i, aSetup.fFitSeed_GainScale * seedInput.vec_fParam[i] );
+                        }
+                        else{
+                            (*iterSlice).second.fitSlice_ClustADC->SetParameter(i, seedInput.vec_fParam[i] );
+                        }
+                    } //End Loop Over Seeded Parameters
+                    
+                    vec_fFitRange.clear();
+                    vec_fFitRange.push_back( aSetup.fFitSeed_GainScale * seedInput.fRange_Min );
+                    vec_fFitRange.push_back( aSetup.fFitSeed_GainScale * seedInput.fRange_Max );
+                } //End Case: Fit Seed Exists
+                else if ( bFastSeed && estSlice.bValid ) { //Case: Start from the Estimate
+                    for (int i=0; i < aSetup.fitSetup_clustADC.m_vec_strFit_ParamMeaning.size() && i < (*iterSlice).second.fitSlice_ClustADC->GetNpar(); ++i) { //Loop Over Parameter Meanings
+                        const string & strMeaning = aSetup.fitSetup_clustADC.m_vec_strFit_ParamMeaning[i];
+                        
+                        if ( 0 == strMeaning.compare("PEAK") )          (*iterSlice).second.fitSlice_ClustADC->SetParameter(i, estSlice.fPkPos );
+                        else if ( 0 == strMeaning.compare("FWHM") )     (*iterSlice).second.fitSlice_ClustADC->SetParameter(i, estSlice.fPkWidth );
+                        else if ( 0 == strMeaning.compare("HWHM") )     (*iterSlice).second.fitSlice_ClustADC->SetParameter(i, 0.5 * estSlice.fPkWidth );
+                        else if ( 0 == strMeaning.compare("SIGMA") )    (*iterSlice).second.fitSlice_ClustADC->SetParameter(i, estSlice.fPkWidth / ( 2. * sqrt( 2. * log( 2. ) ) ) );
+                    } //End Loop Over Parameter Meanings
+                } //End Case: Start from the Estimate
+                
                 //Perform Fit & Store the Result
                 TFitResult fitRes_ADC;
                 
@@ -183,11 +302,14 @@ void AnalyzeResponseUniformityClusters::fitHistos(DetectorMPGD & inputDet){
                     fitRes_ADC = *((*iterSlice).second.hSlice_ClustADC->Fit( (*iterSlice).second.fitSlice_ClustADC.get(),aSetup.fitSetup_clustADC.m_strFit_Option.c_str(),"", fMin, fMax) );
                 } //End Case: Fit within the user specific range
                 else{ //Case: No range to use
+                    fMin = (*iterSlice).second.hSlice_ClustADC->GetBinLowEdge(1);
+                    fMax = (*iterSlice).second.hSlice_ClustADC->GetBinLowEdge( (*iterSlice).second.hSlice_ClustADC->GetNbinsX() + 1 );
+                    
                     fitRes_ADC = *((*iterSlice).second.hSlice_ClustADC->Fit( (*iterSlice).second.fitSlice_ClustADC.get(),aSetup.fitSetup_clustADC.m_strFit_Option.c_str(),"") );
                 } //End Case: No range to use
                 
                 //Determine which point in the TGraphs this is
-                int iPoint = std::distance( (*iterPhi).second.map_slices.begin(), iterSlice) + aSetup.iUniformityGranularity * std::distance((*iterEta).second.map_sectorsPhi.begin(), iterPhi);
+                int iPoint = std::distance( (*iterPhi).second.map_slices.begin(), iterSlice) + iPointOffset;
                 
                 //Store info from spectrum
                 //Store - Number of Peaks (from spectrum)
@@ -239,6 +361,18 @@ void AnalyzeResponseUniformityClusters::fitHistos(DetectorMPGD & inputDet){
                     (*iterPhi).second.fNFitSuccess++;
                     (*iterSlice).second.bFitAccepted = true;
                     
+                    //Store the converged parameters as the seed for the next run
+                    seedSlice.fPos_Min = (*iterSlice).second.fPos_Center - 0.5 * (*iterSlice).second.fWidth;
+                    seedSlice.fPos_Max = (*iterSlice).second.fPos_Center + 0.5 * (*iterSlice).second.fWidth;
+                    seedSlice.fRange_Min = fMin;
+                    seedSlice.fRange_Max = fMax;
+                    seedSlice.vec_fParam.resize( (*iterSlice).second.fitSlice_ClustADC->GetNpar() );
+                    for (int i=0; i < seedSlice.vec_fParam.size(); ++i) {
+                        seedSlice.vec_fParam[i] = (*iterSlice).second.fitSlice_ClustADC->GetParameter(i);
+                    }
+                    
+                    seedsOutput.setSeed( (*iterEta).first, (*iterPhi).first, (*iterSlice).first, seedSlice );
+                    
                     //Store Fit parameters - NormChi2
                     (*iterEta).second.gEta_ClustADC_Fit_NormChi2->SetPoint(iPoint, (*iterSlice).second.fPos_Center,  fNormChi2  );
                     (*iterEta).second.gEta_ClustADC_Fit_NormChi2->SetPointError(iPoint, 0.5 * (*iterSlice).second.fWidth, 0. );
@@ -265,6 +399,18 @@ void AnalyzeResponseUniformityClusters::fitHistos(DetectorMPGD & inputDet){
         } //End Loop Over iPhi Sectors
     } //End Loop Over iEta Sectors
     
+    if ( iNSeedsIgnored > 0 ) {
+        printClassMethodMsg("AnalyzeResponseUniformityClusters","fitHistos",( getString(iNSeedsIgnored) + " fit seeds ignored; their slice range differs from the current slices (Uniformity_Granularity or adaptive slicing changed?)" ).c_str() );
+    }
+    
+    //Flag graphs holding estimates rather than fit results
+    if ( bFast ) { //Case: Estimate Only
+        for (auto iterEta = inputDet.map_sectorsEta.begin(); iterEta != inputDet.map_sectorsEta.end(); ++iterEta) { //Loop Over iEta Sectors
+            (*iterEta).second.gEta_ClustADC_Fit_PkPos->SetTitle( ( string( (*iterEta).second.gEta_ClustADC_Fit_PkPos->GetTitle() ) + " (Estimate)" ).c_str() );
+            (*iterEta).second.gEta_ClustADC_Fit_PkRes->SetTitle( ( string( (*iterEta).second.gEta_ClustADC_Fit_PkRes->GetTitle() ) + " (Estimate)" ).c_str() );
+        } //End Loop Over iEta Sectors
+    } //End Case: Estimate Only
+    
     //Calculate statistics
     if ( inputDet.mset_fClustADC_Fit_NormChi2.size() > 0 ) { //Check if stored fit positions exist
         calcStatistics( inputDet.statClustADC_Fit_NormChi2, inputDet.mset_fClustADC_Fit_NormChi2, "ResponseFitNormChi2" );
@@ -279,6 +425,117 @@ void AnalyzeResponseUniformityClusters::fitHistos(DetectorMPGD & inputDet){
     return;
 } //End AnalyzeResponseUniformityClusters::fitHistos()
 
+//Redefines the slices of each iPhi sector such that each slice holds at least aSetup.iUniformityMinClusters clusters
+//Starting from the first position bin, bins of hADC_v_Pos are accumulated until the slice has enough clusters; a remainder
+//with too few clusters is merged into the last slice.  With aSetup.iUniformitySplitMax position bins per requested slice
+//this splits well populated slices into at most iUniformitySplitMax pieces and merges sparse neighbouring slices
+void AnalyzeResponseUniformityClusters::setSlicesAdaptive(DetectorMPGD & inputDet){
+    //Variable Declaration
+    double dSum;
+    
+    int iBinStart;
+    int iNBinsX, iNBinsY;
+    int iNSlicesEta;
+    
+    vector<std::pair<int,int> > vec_pairBinRange;   //(first, last) bin of hADC_v_Pos in each slice
+    
+    //Loop Over Stored iEta Sectors
+    for (auto iterEta = inputDet.map_sectorsEta.begin(); iterEta != inputDet.map_sectorsEta.end(); ++iterEta) { //Loop Over iEta Sectors
+        iNSlicesEta = 0;
+        
+        //Loop Over Stored iPhi Sectors
+        for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); ++iterPhi) { //Loop Over iPhi Sectors
+            if ( (*iterPhi).second.clustHistos.hADC_v_Pos == nullptr ) continue;
+            
+            iNBinsX = (*iterPhi).second.clustHistos.hADC_v_Pos->GetNbinsX();
+            iNBinsY = (*iterPhi).second.clustHistos.hADC_v_Pos->GetNbinsY();
+            
+            //Determine the bin range of each slice
+            vec_pairBinRange.clear();
+            
+            dSum = 0;
+            iBinStart = 1;
+            for (int iBinX=1; iBinX <= iNBinsX; ++iBinX) { //Loop Over Position Bins
+                dSum += (*iterPhi).second.clustHistos.hADC_v_Pos->Integral(iBinX, iBinX, 1, iNBinsY);
+                
+                if ( dSum >= aSetup.iUniformityMinClusters ) { //Case: Slice Complete
+                    vec_pairBinRange.push_back( std::make_pair(iBinStart, iBinX) );
+                    
+                    dSum = 0;
+                    iBinStart = iBinX + 1;
+                } //End Case: Slice Complete
+            } //End Loop Over Position Bins
+            
+            if ( iBinStart <= iNBinsX ) { //Case: Remaining Bins
+                if ( vec_pairBinRange.empty() ) {   vec_pairBinRange.push_back( std::make_pair(iBinStart, iNBinsX) ); }
+                else{                               vec_pairBinRange.back().second = iNBinsX; }
+            } //End Case: Remaining Bins
+            
+            //Replace the slices
+            (*iterPhi).second.map_slices.clear();
+            for (int i=0; i < vec_pairBinRange.size(); ++i) { //Loop Over Slices
+                SectorSlice slice;
+                
+                setSliceBins(slice, (*iterPhi).second.clustHistos.hADC_v_Pos->GetXaxis(), vec_pairBinRange[i].first, vec_pairBinRange[i].second);
+                
+                slice.hSlice_ClustADC = make_shared<TH1F>( *( (TH1F*) (*iterPhi).second.clustHistos.hADC_v_Pos->ProjectionY( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "Slice" + getString(i+1) + "_clustADC").c_str(),slice.iBin_Low,slice.iBin_High,"") ) );
+                slice.hSlice_ClustADC->SetDirectory(gROOT);
+                
+                (*iterPhi).second.map_slices[i+1] = slice;
+            } //End Loop Over Slices
+            
+            setSliceLookup( (*iterPhi).second, iNBinsX );
+            
+            iNSlicesEta += (*iterPhi).second.map_slices.size();
+            
+            cout<<"Adaptive slicing (iEta, iPhi) = (" << (*iterEta).first << ", " << (*iterPhi).first << "): " << (*iterPhi).second.map_slices.size() << " slices\n";
+        } //End Loop Over iPhi Sectors
+        
+        //One point per slice in the iEta graphs
+        if ( (*iterEta).second.gEta_ClustADC_Fit_NormChi2 != nullptr ) (*iterEta).second.gEta_ClustADC_Fit_NormChi2->Set(iNSlicesEta);
+        if ( (*iterEta).second.gEta_ClustADC_Fit_PkPos != nullptr ) (*iterEta).second.gEta_ClustADC_Fit_PkPos->Set(iNSlicesEta);
+        if ( (*iterEta).second.gEta_ClustADC_Fit_PkRes != nullptr ) (*iterEta).second.gEta_ClustADC_Fit_PkRes->Set(iNSlicesEta);
+        if ( (*iterEta).second.gEta_ClustADC_Fit_Failures != nullptr ) (*iterEta).second.gEta_ClustADC_Fit_Failures->Set(iNSlicesEta);
+        if ( (*iterEta).second.gEta_ClustADC_Spec_NumPks != nullptr ) (*iterEta).second.gEta_ClustADC_Spec_NumPks->Set(iNSlicesEta);
+        if ( (*iterEta).second.gEta_ClustADC_Spec_PkPos != nullptr ) (*iterEta).second.gEta_ClustADC_Spec_PkPos->Set(iNSlicesEta);
+    } //End Loop Over iEta Sectors
+    
+    return;
+} //End AnalyzeResponseUniformityClusters::setSlicesAdaptive()
+
+//Sets the x-bin range of inputSlice and its position & width from axisPos
+void AnalyzeResponseUniformityClusters::setSliceBins(SectorSlice & inputSlice, TAxis * axisPos, int iBinLow, int iBinHigh){
+    inputSlice.iBin_Low     = iBinLow;
+    inputSlice.iBin_High    = iBinHigh;
+    
+    inputSlice.fPos_Center  = 0.5 * ( axisPos->GetBinLowEdge(iBinLow) + axisPos->GetBinUpEdge(iBinHigh) );
+    inputSlice.fWidth       = axisPos->GetBinUpEdge(iBinHigh) - axisPos->GetBinLowEdge(iBinLow);
+    
+    return;
+} //End AnalyzeResponseUniformityClusters::setSliceBins()
+
+//Sets the position -> slice lookup of inputSector from the bin ranges of its slices
+void AnalyzeResponseUniformityClusters::setSliceLookup(ReadoutSectorPhi & inputSector, int iNPosBins){
+    inputSector.vec_iSliceByPosBin.assign( std::max(iNPosBins, 0), -1 );
+    
+    for (auto iterSlice = inputSector.map_slices.begin(); iterSlice != inputSector.map_slices.end(); ++iterSlice) { //Loop Over Slices
+        for (int iBin = std::max( (*iterSlice).second.iBin_Low, 1); iBin <= std::min( (*iterSlice).second.iBin_High, iNPosBins); ++iBin) {
+            inputSector.vec_iSliceByPosBin[iBin-1] = (*iterSlice).first;
+        }
+    } //End Loop Over Slices
+    
+    return;
+} //End AnalyzeResponseUniformityClusters::setSliceLookup()
+
+//Returns a copy of the 2D histogram strName in dirInput; nullptr if it is not found
+shared_ptr<TH2F> AnalyzeResponseUniformityClusters::getHisto2D(TDirectory * dirInput, const std::string & strName){
+    TH2F *hTemp = (TH2F*) dirInput->Get( strName.c_str() );
+    
+    if (hTemp == nullptr) return nullptr;
+    
+    return make_shared<TH2F>( *hTemp );
+} //End AnalyzeResponseUniformityClusters::getHisto2D()
+
 //Loops through the detector and initializes all cluster graphs
 void AnalyzeResponseUniformityClusters::initGraphsClusters(DetectorMPGD & inputDet){
     //Variable Declaration
@@ -331,16 +588,25 @@ void AnalyzeResponseUniformityClusters::initHistosClusters(DetectorMPGD & inputD
         (*iterEta).second.clustHistos.hTime = make_shared<TH1F>(getHistogram((*iterEta).first, -1, aSetup.histoSetup_clustTime ) );
         
         //Initialize iEta Histograms - 2D
-        (*iterEta).second.clustHistos.hADC_v_Pos = make_shared<TH2F>( getHistogram2D((*iterEta).first, -1, aSetup.histoSetup_clustPos, aSetup.histoSetup_clustADC ) );
-        (*iterEta).second.clustHistos.hADC_v_Size = make_shared<TH2F>( getHistogram2D((*iterEta).first, -1, aSetup.histoSetup_clustSize, aSetup.histoSetup_clustADC ) );
-        (*iterEta).second.clustHistos.hADC_v_Time = make_shared<TH2F>( getHistogram2D((*iterEta).first, -1, aSetup.histoSetup_clustTime, aSetup.histoSetup_clustADC ) );
-        (*iterEta).second.clustHistos.hSize_v_Pos = make_shared<TH2F>( getHistogram2D((*iterEta).first, -1, aSetup.histoSetup_clustPos, aSetup.histoSetup_clustSize ) );
+        if ( aSetup.bUniformityHistos2D ) { //Case: 2D Histograms Requested
+            (*iterEta).second.clustHistos.hADC_v_Pos = make_shared<TH2F>( getHistogram2D((*iterEta).first, -1, aSetup.histoSetup_clustPos, aSetup.histoSetup_clustADC ) );
+            (*iterEta).second.clustHistos.hADC_v_Size = make_shared<TH2F>( getHistogram2D((*iterEta).first, -1, aSetup.histoSetup_clustSize, aSetup.histoSetup_clustADC ) );
+            (*iterEta).second.clustHistos.hADC_v_Time = make_shared<TH2F>( getHistogram2D((*iterEta).first, -1, aSetup.histoSetup_clustTime, aSetup.histoSetup_clustADC ) );
+            (*iterEta).second.clustHistos.hSize_v_Pos = make_shared<TH2F>( getHistogram2D((*iterEta).first, -1, aSetup.histoSetup_clustPos, aSetup.histoSetup_clustSize ) );
+        } //End Case: 2D Histograms Requested
+        
+        //Initialize iEta Run History Summaries
+        (*iterEta).second.clustHistos.storeADC_v_Run = RunHistoryStore( aSetup.iRunHistory_NBins, aSetup.iRunHistory_SketchBins, aSetup.histoSetup_clustADC.fHisto_xLower, aSetup.histoSetup_clustADC.fHisto_xUpper );
+        (*iterEta).second.clustHistos.storeTime_v_Run = RunHistoryStore( aSetup.iRunHistory_NBins, aSetup.histoSetup_clustTime.iHisto_nBins, aSetup.histoSetup_clustTime.fHisto_xLower, aSetup.histoSetup_clustTime.fHisto_xUpper );
         
         //Loop Over Stored iPhi Sectors
         for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); ++iterPhi) { //Loop Over iPhi Sectors
             //Special case for Cluster Position, the number of bins here should be factor 3 less than requested (eta case)
             Timing::HistoSetup setupClustPosPhi	= aSetup.histoSetup_clustPos;
             setupClustPosPhi.iHisto_nBins		= aSetup.iUniformityGranularity;
+            
+            //Adaptive slicing needs a finer position binning to be able to split slices
+            if ( aSetup.bUniformityAdaptive ) { setupClustPosPhi.iHisto_nBins *= std::max(aSetup.iUniformitySplitMax, 1); }
             setupClustPosPhi.fHisto_xLower		= (*iterPhi).second.fPos_Xlow;
             setupClustPosPhi.fHisto_xUpper 		= (*iterPhi).second.fPos_Xhigh;
             
@@ -351,23 +617,42 @@ void AnalyzeResponseUniformityClusters::initHistosClusters(DetectorMPGD & inputD
             (*iterPhi).second.clustHistos.hTime = make_shared<TH1F>(getHistogram( (*iterEta).first, (*iterPhi).first, aSetup.histoSetup_clustTime ) );
             
             //Initialize iPhi Histograms - 2D
-            (*iterPhi).second.clustHistos.hADC_v_Pos = make_shared<TH2F>( getHistogram2D( (*iterEta).first, (*iterPhi).first, setupClustPosPhi, aSetup.histoSetup_clustADC ) );
-            (*iterPhi).second.clustHistos.hADC_v_Size = make_shared<TH2F>( getHistogram2D( (*iterEta).first, (*iterPhi).first, aSetup.histoSetup_clustSize, aSetup.histoSetup_clustADC ) );
-            (*iterPhi).second.clustHistos.hADC_v_Time = make_shared<TH2F>( getHistogram2D( (*iterEta).first, (*iterPhi).first, aSetup.histoSetup_clustTime, aSetup.histoSetup_clustADC ) );
-            (*iterPhi).second.clustHistos.hSize_v_Pos = make_shared<TH2F>( getHistogram2D( (*iterEta).first, (*iterPhi).first, setupClustPosPhi, aSetup.histoSetup_clustSize ) );
+            //Adaptive slicing redefines the slices from hADC_v_Pos so it is always booked in that case
+            if ( aSetup.bUniformityHistos2D || aSetup.bUniformityAdaptive ) {
+                (*iterPhi).second.clustHistos.hADC_v_Pos = make_shared<TH2F>( getHistogram2D( (*iterEta).first, (*iterPhi).first, setupClustPosPhi, aSetup.histoSetup_clustADC ) );
+            }
+            if ( aSetup.bUniformityHistos2D ) { //Case: 2D Histograms Requested
+                (*iterPhi).second.clustHistos.hADC_v_Size = make_shared<TH2F>( getHistogram2D( (*iterEta).first, (*iterPhi).first, aSetup.histoSetup_clustSize, aSetup.histoSetup_clustADC ) );
+                (*iterPhi).second.clustHistos.hADC_v_Time = make_shared<TH2F>( getHistogram2D( (*iterEta).first, (*iterPhi).first, aSetup.histoSetup_clustTime, aSetup.histoSetup_clustADC ) );
+                (*iterPhi).second.clustHistos.hSize_v_Pos = make_shared<TH2F>( getHistogram2D( (*iterEta).first, (*iterPhi).first, setupClustPosPhi, aSetup.histoSetup_clustSize ) );
+            } //End Case: 2D Histograms Requested
+            
+            //Initialize iPhi Run History Summaries
+            (*iterPhi).second.clustHistos.storeADC_v_Run = RunHistoryStore( aSetup.iRunHistory_NBins, aSetup.iRunHistory_SketchBins, aSetup.histoSetup_clustADC.fHisto_xLower, aSetup.histoSetup_clustADC.fHisto_xUpper );
+            (*iterPhi).second.clustHistos.storeTime_v_Run = RunHistoryStore( aSetup.iRunHistory_NBins, aSetup.histoSetup_clustTime.iHisto_nBins, aSetup.histoSetup_clustTime.fHisto_xLower, aSetup.histoSetup_clustTime.fHisto_xUpper );
             
             //Setup the Slices
+            //Each slice covers iNBinsSlice position bins (more than one only for adaptive slicing)
+            TAxis axisPosPhi( setupClustPosPhi.iHisto_nBins, setupClustPosPhi.fHisto_xLower, setupClustPosPhi.fHisto_xUpper );
+            
+            int iNBinsSlice = setupClustPosPhi.iHisto_nBins / aSetup.iUniformityGranularity;
             for (int i=1; i<= aSetup.iUniformityGranularity; ++i) { //Loop Over Slices
                 //Create the slice
                 SectorSlice slice;
                 
                 //Store position information for this slice
-                slice.fPos_Center = (*iterPhi).second.clustHistos.hADC_v_Pos->GetXaxis()->GetBinCenter(i);
-                slice.fWidth = (*iterPhi).second.clustHistos.hADC_v_Pos->GetXaxis()->GetBinWidth(i);
+                setSliceBins(slice, &axisPosPhi, (i-1) * iNBinsSlice + 1, i * iNBinsSlice);
+                
+                //Book the slice histogram, filled directly in fillHistos()
+                slice.hSlice_ClustADC = make_shared<TH1F>( getHistogram( (*iterEta).first, (*iterPhi).first, aSetup.histoSetup_clustADC ) );
+                slice.hSlice_ClustADC->SetName( getNameByIndex( (*iterEta).first, (*iterPhi).first, i, "h", "clustADC" ).c_str() );
                 
                 //Store the slice
                 (*iterPhi).second.map_slices[i] = slice;
             } //End Loop Over Slices
+            
+            //Position -> slice lookup used by fillHistos()
+            setSliceLookup( (*iterPhi).second, setupClustPosPhi.iHisto_nBins );
         } //End Loop Over iPhi Sectors
     } //End Loop Over iEta Sectors
     
@@ -507,10 +792,10 @@ void AnalyzeResponseUniformityClusters::loadHistosFromFile(std::string & strInpu
         (*iterEta).second.clustHistos.hPos = make_shared<TH1F>( *((TH1F*) dir_SectorEta->Get( ("h_iEta" + getString( (*iterEta).first ) +  "_clustPos").c_str() ) ) );
         (*iterEta).second.clustHistos.hSize = make_shared<TH1F>( *((TH1F*) dir_SectorEta->Get( ("h_iEta" + getString( (*iterEta).first ) +  "_clustSize").c_str() ) ) );
         (*iterEta).second.clustHistos.hTime = make_shared<TH1F>( *((TH1F*) dir_SectorEta->Get( ("h_iEta" + getString( (*iterEta).first ) +  "_clustTime").c_str() ) ) );
-        (*iterEta).second.clustHistos.hADC_v_Pos    = make_shared<TH2F>( *((TH2F*) dir_SectorEta->Get( ("h_iEta" + getString( (*iterEta).first ) +  "_clustADC_v_clustPos").c_str() ) ) );
-        (*iterEta).second.clustHistos.hADC_v_Size   = make_shared<TH2F>( *((TH2F*) dir_SectorEta->Get( ("h_iEta" + getString( (*iterEta).first ) +  "_clustADC_v_clustSize").c_str() ) ) );
-        (*iterEta).second.clustHistos.hADC_v_Time   = make_shared<TH2F>( *((TH2F*) dir_SectorEta->Get( ("h_iEta" + getString( (*iterEta).first ) +  "_clustADC_v_clustTime").c_str() ) ) );
-        (*iterEta).second.clustHistos.hSize_v_Pos   = make_shared<TH2F>( *((TH2F*) dir_SectorEta->Get( ("h_iEta" + getString( (*iterEta).first ) +  "_clustSize_v_clustPos").c_str() ) ) );
+        (*iterEta).second.clustHistos.hADC_v_Pos    = getHisto2D( dir_SectorEta, ("h_iEta" + getString( (*iterEta).first ) +  "_clustADC_v_clustPos") );
+        (*iterEta).second.clustHistos.hADC_v_Size   = getHisto2D( dir_SectorEta, ("h_iEta" + getString( (*iterEta).first ) +  "_clustADC_v_clustSize") );
+        (*iterEta).second.clustHistos.hADC_v_Time   = getHisto2D( dir_SectorEta, ("h_iEta" + getString( (*iterEta).first ) +  "_clustADC_v_clustTime") );
+        (*iterEta).second.clustHistos.hSize_v_Pos   = getHisto2D( dir_SectorEta, ("h_iEta" + getString( (*iterEta).first ) +  "_clustSize_v_clustPos") );
         
         //Loop Over Stored iPhi Sectors within this iEta Sector
         for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); ++iterPhi) { //Loop Over Stored iPhi Sectors
@@ -529,13 +814,37 @@ void AnalyzeResponseUniformityClusters::loadHistosFromFile(std::string & strInpu
             (*iterPhi).second.clustHistos.hMulti = make_shared<TH1F>( *((TH1F*) dir_SectorPhi->Get( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "_clustMulti").c_str() ) ) );	    
             (*iterPhi).second.clustHistos.hSize = make_shared<TH1F>( *((TH1F*) dir_SectorPhi->Get( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "_clustSize").c_str() ) ) );
             (*iterPhi).second.clustHistos.hTime = make_shared<TH1F>( *((TH1F*) dir_SectorPhi->Get( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "_clustTime").c_str() ) ) );
-            (*iterPhi).second.clustHistos.hADC_v_Pos    = make_shared<TH2F>( *((TH2F*) dir_SectorPhi->Get( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "_clustADC_v_clustPos").c_str() ) ) );
-            (*iterPhi).second.clustHistos.hADC_v_Size   = make_shared<TH2F>( *((TH2F*) dir_SectorPhi->Get( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "_clustADC_v_clustSize").c_str() ) ) );
-            (*iterPhi).second.clustHistos.hADC_v_Time   = make_shared<TH2F>( *((TH2F*) dir_SectorPhi->Get( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "_clustADC_v_clustTime").c_str() ) ) );
-            (*iterPhi).second.clustHistos.hSize_v_Pos    = make_shared<TH2F>( *((TH2F*) dir_SectorPhi->Get( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "_clustSize_v_clustPos").c_str() ) ) );
+            (*iterPhi).second.clustHistos.hADC_v_Pos    = getHisto2D( dir_SectorPhi, ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "_clustADC_v_clustPos") );
+            (*iterPhi).second.clustHistos.hADC_v_Size   = getHisto2D( dir_SectorPhi, ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "_clustADC_v_clustSize") );
+            (*iterPhi).second.clustHistos.hADC_v_Time   = getHisto2D( dir_SectorPhi, ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "_clustADC_v_clustTime") );
+            (*iterPhi).second.clustHistos.hSize_v_Pos    = getHisto2D( dir_SectorPhi, ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "_clustSize_v_clustPos") );
             
             //Check to see if 2D histo retrieved successfully
-            if ( (*iterPhi).second.clustHistos.hADC_v_Pos == nullptr) continue;
+            //If not (2D histograms were not booked) the slices were filled directly, load them from the file (Option 1 below)
+            if ( (*iterPhi).second.clustHistos.hADC_v_Pos == nullptr) { //Case: No 2D Histogram
+                TAxis axisPosPhi( aSetup.iUniformityGranularity, (*iterPhi).second.fPos_Xlow, (*iterPhi).second.fPos_Xhigh );
+                
+                for (int i=1; i <= aSetup.iUniformityGranularity; ++i ) { //Loop Over Slices
+                    TDirectory *dir_Slice = dir_SectorPhi->GetDirectory( ( "Slice" + getString(i) ).c_str(), false, "GetDirectory" );
+                    
+                    if (dir_Slice == nullptr) continue;
+                    
+                    TH1F *hSliceTemp = (TH1F*) dir_Slice->Get( getNameByIndex( (*iterEta).first, (*iterPhi).first, i, "h", "clustADC" ).c_str() );
+                    
+                    if (hSliceTemp == nullptr) continue;
+                    
+                    SectorSlice slice;
+                    
+                    setSliceBins(slice, &axisPosPhi, i, i);
+                    
+                    slice.hSlice_ClustADC = make_shared<TH1F>( *hSliceTemp );
+                    slice.hSlice_ClustADC->SetDirectory(gROOT);
+                    
+                    (*iterPhi).second.map_slices[i] = slice;
+                } //End Loop Over Slices
+                
+                continue;
+            } //End Case: No 2D Histogram
             
             //Set to Global Directory - ReadoutSectorPhi Level
             //-------------------------------------
@@ -549,21 +858,22 @@ void AnalyzeResponseUniformityClusters::loadHistosFromFile(std::string & strInpu
             //      Option 1: Load slices from the file (slower?)
             //      Option 2: project out from ReadoutSectorPhi::clustHistos::hADC_v_Pos
             //Implemented Option 2; faster many large number of I/O operations??
+            //The stored histogram may have a finer position binning than the slices (adaptive slicing); each slice covers iNBinsSlice bins
+            int iNBinsSlice = std::max( (*iterPhi).second.clustHistos.hADC_v_Pos->GetNbinsX() / aSetup.iUniformityGranularity, 1);
             for (int i=1; i <= aSetup.iUniformityGranularity; ++i ) { //Loop Over Slices
                 //Set Histograms - Slice Level
                 //-------------------------------------
                 //Creat the slice
                 SectorSlice slice;
                 
-                slice.hSlice_ClustADC = make_shared<TH1F>( *( (TH1F*) (*iterPhi).second.clustHistos.hADC_v_Pos->ProjectionY( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "Slice" + getString(i) + "_clustADC").c_str(),i,i,"") ) );
+                //Store position information for this slice
+                setSliceBins(slice, (*iterPhi).second.clustHistos.hADC_v_Pos->GetXaxis(), (i-1) * iNBinsSlice + 1, i * iNBinsSlice);
+                
+                slice.hSlice_ClustADC = make_shared<TH1F>( *( (TH1F*) (*iterPhi).second.clustHistos.hADC_v_Pos->ProjectionY( ("h_iEta" + getString( (*iterEta).first ) + "iPhi" + getString( (*iterPhi).first ) + "Slice" + getString(i) + "_clustADC").c_str(),slice.iBin_Low,slice.iBin_High,"") ) );
                 
                 //Make sure to set this histo to the global directory
                 slice.hSlice_ClustADC->SetDirectory(gROOT);
                 
-                //Store position information for this slice
-                slice.fPos_Center = (*iterPhi).second.clustHistos.hADC_v_Pos->GetXaxis()->GetBinCenter(i);
-                slice.fWidth = (*iterPhi).second.clustHistos.hADC_v_Pos->GetXaxis()->GetBinWidth(i);
-                
                 //Store the slice
                 (*iterPhi).second.map_slices[i] = slice;
             } //End Loop Over Slices
@@ -681,10 +991,10 @@ void AnalyzeResponseUniformityClusters::storeHistos( TFile * file_InputRootFile,
         (*iterEta).second.clustHistos.hPos->Write();
         (*iterEta).second.clustHistos.hSize->Write();
         (*iterEta).second.clustHistos.hTime->Write();
-        (*iterEta).second.clustHistos.hADC_v_Pos->Write();
-        (*iterEta).second.clustHistos.hADC_v_Size->Write();
-        (*iterEta).second.clustHistos.hADC_v_Time->Write();
-        (*iterEta).second.clustHistos.hSize_v_Pos->Write();
+        if ( (*iterEta).second.clustHistos.hADC_v_Pos != nullptr ) (*iterEta).second.clustHistos.hADC_v_Pos->Write();
+        if ( (*iterEta).second.clustHistos.hADC_v_Size != nullptr ) (*iterEta).second.clustHistos.hADC_v_Size->Write();
+        if ( (*iterEta).second.clustHistos.hADC_v_Time != nullptr ) (*iterEta).second.clustHistos.hADC_v_Time->Write();
+        if ( (*iterEta).second.clustHistos.hSize_v_Pos != nullptr ) (*iterEta).second.clustHistos.hSize_v_Pos->Write();
         
         auto iterHistoTime = (*iterEta).second.clustHistos.map_hTime_v_EvtNum_by_Run.begin();
         for(auto iterHistoADC = (*iterEta).second.clustHistos.map_hADC_v_EvtNum_by_Run.begin(); iterHistoADC != (*iterEta).second.clustHistos.map_hADC_v_EvtNum_by_Run.end(); ++iterHistoADC){
@@ -696,6 +1006,17 @@ void AnalyzeResponseUniformityClusters::storeHistos( TFile * file_InputRootFile,
             ++iterHistoTime;
         }
         
+        //Run History Summaries
+        if ( !(*iterEta).second.clustHistos.storeADC_v_Run.empty() ) { //Case: Run History Summaries Filled
+            dir_RunHistory_Eta_ADC->cd();
+            (*iterEta).second.clustHistos.storeADC_v_Run.getHisto2D( getNameByIndex( (*iterEta).first, -1, -1, "h", "clustADC_v_RunHistory" ), "Cluster ADC" ).Write();
+            (*iterEta).second.clustHistos.storeADC_v_Run.getGraphMedian( getNameByIndex( (*iterEta).first, -1, -1, "g", "clustADC_v_RunHistory_Median" ) ).Write();
+            
+            dir_RunHistory_Eta_Time->cd();
+            (*iterEta).second.clustHistos.storeTime_v_Run.getHisto2D( getNameByIndex( (*iterEta).first, -1, -1, "h", "clustTime_v_RunHistory" ), "Cluster Time" ).Write();
+            (*iterEta).second.clustHistos.storeTime_v_Run.getGraphMedian( getNameByIndex( (*iterEta).first, -1, -1, "g", "clustTime_v_RunHistory_Median" ) ).Write();
+        } //End Case: Run History Summaries Filled
+        
         //Loop Over Stored iPhi Sectors within this iEta Sector
         for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); ++iterPhi) { //Loop Over Stored iPhi Sectors
             //Get Directory
@@ -731,10 +1052,10 @@ void AnalyzeResponseUniformityClusters::storeHistos( TFile * file_InputRootFile,
             (*iterPhi).second.clustHistos.hMulti->Write();
             (*iterPhi).second.clustHistos.hSize->Write();
             (*iterPhi).second.clustHistos.hTime->Write();
-            (*iterPhi).second.clustHistos.hADC_v_Pos->Write();
-            (*iterPhi).second.clustHistos.hADC_v_Size->Write();
-            (*iterPhi).second.clustHistos.hADC_v_Time->Write();
-            (*iterPhi).second.clustHistos.hSize_v_Pos->Write();
+            if ( (*iterPhi).second.clustHistos.hADC_v_Pos != nullptr ) (*iterPhi).second.clustHistos.hADC_v_Pos->Write();
+            if ( (*iterPhi).second.clustHistos.hADC_v_Size != nullptr ) (*iterPhi).second.clustHistos.hADC_v_Size->Write();
+            if ( (*iterPhi).second.clustHistos.hADC_v_Time != nullptr ) (*iterPhi).second.clustHistos.hADC_v_Time->Write();
+            if ( (*iterPhi).second.clustHistos.hSize_v_Pos != nullptr ) (*iterPhi).second.clustHistos.hSize_v_Pos->Write();
             
             iterHistoTime = (*iterPhi).second.clustHistos.map_hTime_v_EvtNum_by_Run.begin();
             for(auto iterHistoADC = (*iterPhi).second.clustHistos.map_hADC_v_EvtNum_by_Run.begin(); iterHistoADC != (*iterPhi).second.clustHistos.map_hADC_v_EvtNum_by_Run.end(); ++iterHistoADC){
@@ -745,6 +1066,17 @@ void AnalyzeResponseUniformityClusters::storeHistos( TFile * file_InputRootFile,
                 (*iterHistoTime).second->Write();
                 ++iterHistoTime;
             }
+            
+            //Run History Summaries
+            if ( !(*iterPhi).second.clustHistos.storeADC_v_Run.empty() ) { //Case: Run History Summaries Filled
+                dir_RunHistory_Phi_ADC->cd();
+                (*iterPhi).second.clustHistos.storeADC_v_Run.getHisto2D( getNameByIndex( (*iterEta).first, (*iterPhi).first, -1, "h", "clustADC_v_RunHistory" ), "Cluster ADC" ).Write();
+                (*iterPhi).second.clustHistos.storeADC_v_Run.getGraphMedian( getNameByIndex( (*iterEta).first, (*iterPhi).first, -1, "g", "clustADC_v_RunHistory_Median" ) ).Write();
+                
+                dir_RunHistory_Phi_Time->cd();
+                (*iterPhi).second.clustHistos.storeTime_v_Run.getHisto2D( getNameByIndex( (*iterEta).first, (*iterPhi).first, -1, "h", "clustTime_v_RunHistory" ), "Cluster Time" ).Write();
+                (*iterPhi).second.clustHistos.storeTime_v_Run.getGraphMedian( getNameByIndex( (*iterEta).first, (*iterPhi).first, -1, "g", "clustTime_v_RunHistory_Median" ) ).Write();
+            } //End Case: Run History Summaries Filled
         } //End Loop Over Stored iPhi Sectors
     } //End Loop Over Stored iEta Sectors
     
@@ -837,7 +1169,23 @@ void AnalyzeResponseUniformityClusters::storeFits( TFile * file_InputRootFile, D
             //-------------------------------------
             dir_SectorPhi->cd();
             
-            //No Fits defined at this level - yet
+            //Effective slice boundaries from adaptive slicing; bin content is the number of clusters in the slice
+            if ( aSetup.bUniformityAdaptive && (*iterPhi).second.map_slices.size() > 0 ) { //Case: Adaptive Slicing
+                vector<double> vec_dEdges;
+                
+                for (auto iterSlice = (*iterPhi).second.map_slices.begin(); iterSlice != (*iterPhi).second.map_slices.end(); ++iterSlice ) {
+                    vec_dEdges.push_back( (*iterSlice).second.fPos_Center - 0.5 * (*iterSlice).second.fWidth );
+                }
+                vec_dEdges.push_back( (*(*iterPhi).second.map_slices.rbegin()).second.fPos_Center + 0.5 * (*(*iterPhi).second.map_slices.rbegin()).second.fWidth );
+                
+                TH1F hSliceBounds( getNameByIndex( (*iterEta).first, (*iterPhi).first, -1, "h", "clustSliceBounds" ).c_str(), ";Position #left(mm#right);Clusters", vec_dEdges.size() - 1, vec_dEdges.data() );
+                
+                for (auto iterSlice = (*iterPhi).second.map_slices.begin(); iterSlice != (*iterPhi).second.map_slices.end(); ++iterSlice ) {
+                    if ( (*iterSlice).second.hSlice_ClustADC != nullptr ) { hSliceBounds.SetBinContent( std::distance( (*iterPhi).second.map_slices.begin(), iterSlice ) + 1, (*iterSlice).second.hSlice_ClustADC->GetEntries() ); }
+                }
+                
+                hSliceBounds.Write();
+            } //End Case: Adaptive Slicing
             
             //Slices
             //Now that all clusters have been analyzed we extract the slices
@@ -865,3 +1213,100 @@ void AnalyzeResponseUniformityClusters::storeFits( TFile * file_InputRootFile, D
     
     return;
 } //End storeFits()
+
+//Writes the converged parameters of the slice fits accepted by fitHistos(); can be read back by loadFitSeeds()
+void AnalyzeResponseUniformityClusters::printFitSeeds(string & strOutputTextFileName){
+    //Variable Declaration
+    std::fstream file_Seeds;
+    
+    //Setup output file
+    //------------------------------------------------------
+    file_Seeds.open( strOutputTextFileName.c_str(), std::fstream::out );
+    
+    if (!file_Seeds.is_open()) { //Case: Output file not opened
+        perror( ("AnalyzeResponseUniformityClusters::printFitSeeds() - error while opening file: " + strOutputTextFileName).c_str() );
+        printStreamStatus(file_Seeds);
+        
+        cout<<"\tFit seeds are being skipped!\n";
+        
+        return;
+    } //End Case: Output file not opened
+    
+    //The slice range is compared by loadFitSeeds() users, keep full float precision
+    file_Seeds.precision(9);
+    
+    file_Seeds<<"#iEta\tiPhi\tiSlice\tPos_Min\tPos_Max\tRange_Min\tRange_Max\tParameters...\n";
+    
+    for (auto iterSeed = seedsOutput.map_seeds.begin(); iterSeed != seedsOutput.map_seeds.end(); ++iterSeed) { //Loop Over Seeds
+        file_Seeds<<std::get<0>( (*iterSeed).first )<<"\t"<<std::get<1>( (*iterSeed).first )<<"\t"<<std::get<2>( (*iterSeed).first );
+        file_Seeds<<"\t"<<(*iterSeed).second.fPos_Min<<"\t"<<(*iterSeed).second.fPos_Max;
+        file_Seeds<<"\t"<<(*iterSeed).second.fRange_Min<<"\t"<<(*iterSeed).second.fRange_Max;
+        
+        for (auto iterParam = (*iterSeed).second.vec_fParam.begin(); iterParam != (*iterSeed).second.vec_fParam.end(); ++iterParam) {
+            file_Seeds<<"\t"<<(*iterParam);
+        }
+        
+        file_Seeds<<endl;
+    } //End Loop Over Seeds
+    
+    file_Seeds.close();
+    
+    return;
+} //End AnalyzeResponseUniformityClusters::printFitSeeds()
+
+//true -> a fit parameter with meaning strParamMeaning scales with the detector gain
+bool AnalyzeResponseUniformityClusters::isGainScaled(const std::string & strParamMeaning){
+    return ( 0 == strParamMeaning.compare("PEAK")
+            || 0 == strParamMeaning.compare("FWHM")
+            || 0 == strParamMeaning.compare("HWHM")
+            || 0 == strParamMeaning.compare("SIGMA") );
+} //End AnalyzeResponseUniformityClusters::isGainScaled()
+
+//Loads fit seeds written by AnalyzeResponseUniformityClusters::printFitSeeds()
+//Each line is "iEta iPhi iSlice Pos_Min Pos_Max Range_Min Range_Max Param0 Param1 ..."; lines starting with '#' are ignored
+FitSeedStore QualityControl::Uniformity::loadFitSeeds(string & strInputTextFileName){
+    //Variable Declaration
+    int iEta, iPhi, iSlice;
+    
+    float fParam;
+    
+    string strLine;
+    
+    std::ifstream file_Seeds;
+    
+    FitSeed seedSlice;
+    FitSeedStore retSeeds;
+    
+    //Open input file
+    //------------------------------------------------------
+    file_Seeds.open( strInputTextFileName.c_str() );
+    
+    if (!file_Seeds.is_open()) { //Case: Input file not opened
+        perror( ("Uniformity::loadFitSeeds() - error while opening file: " + strInputTextFileName).c_str() );
+        printStreamStatus(file_Seeds);
+        
+        cout<<"\tSlice fits will not be seeded!\n";
+        
+        return retSeeds;
+    } //End Case: Input file not opened
+    
+    while ( std::getline(file_Seeds, strLine) ) { //Loop Over Input File
+        if ( strLine.empty() || 0 == strLine.compare(0,1,"#") ) continue;
+        
+        std::istringstream streamLine(strLine);
+        
+        if ( !(streamLine >> iEta >> iPhi >> iSlice >> seedSlice.fPos_Min >> seedSlice.fPos_Max >> seedSlice.fRange_Min >> seedSlice.fRange_Max) ) { //Case: Line Not Understood
+            printClassMethodMsg("Uniformity","loadFitSeeds",("\tLine not understood: " + strLine).c_str() );
+            continue;
+        } //End Case: Line Not Understood
+        
+        seedSlice.vec_fParam.clear();
+        while ( streamLine >> fParam ) { seedSlice.vec_fParam.push_back(fParam); }
+        
+        retSeeds.setSeed(iEta, iPhi, iSlice, seedSlice);
+    } //End Loop Over Input File
+    
+    file_Seeds.close();
+    
+    return retSeeds;
+} //End Uniformity::loadFitSeeds()
@@ -0,0 +1,306 @@
+//
+//  AnalyzeStripHealth.cpp
+//
+//
+//
+//
+
+#include "AnalyzeStripHealth.h"
+
+using std::cout;
+using std::endl;
+using std::map;
+using std::string;
+using std::vector;
+
+using QualityControl::Timing::getString;
+using QualityControl::Timing::printStreamStatus;
+
+using namespace QualityControl::Uniformity;
+
+//Default Constructor
+AnalyzeStripHealth::AnalyzeStripHealth(){
+    bVerboseMode = false;
+    iNum_RunsAccumulated = 0;
+} //End Default Constructor
+
+//Adds the hits stored in inputDet (assumed to be from a single run) to the per strip statistics
+//For each iEta sector the median strip occupancy of this run is taken as the expected occupancy of every strip
+//  Dead: the probability to observe the strip occupancy given the median is below aSetup.fStripHealth_PVal_Dead
+//        (the run is only conclusive if a strip with zero hits would fail this test)
+//  Hot:  the strip occupancy is more than aSetup.fStripHealth_NSigma_Hot sigma and a factor 2 above the median
+void AnalyzeStripHealth::accumulateRun(DetectorMPGD & inputDet){
+    //Variable Declaration
+    int iNStrips;
+
+    double dMedian;
+    double dDelta;
+    double dADC;
+
+    vector<long> vec_lOccupancy;
+    vector<long> vec_lSorted;
+
+    //Loop Over Stored iEta Sectors
+    //------------------------------------------------------
+    for (auto iterEta = inputDet.map_sectorsEta.begin(); iterEta != inputDet.map_sectorsEta.end(); ++iterEta) { //Loop Over iEta Sectors
+        //Determine the number of strips in this sector
+        iNStrips = 0;
+        for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); ++iterPhi) {
+            iNStrips = std::max(iNStrips, (*iterPhi).second.iStripNum_Max);
+        }
+        iNStrips = std::min(iNStrips, iStripMask_NStrips);
+
+        if (iNStrips <= 0) continue;
+
+        vector<StripHealthStats> & vec_stats = map_stripStats[(*iterEta).first];
+        if ( vec_stats.size() < iNStrips ) { vec_stats.resize(iNStrips); }
+
+        //Count the hits on each strip & accumulate the ADC
+        vec_lOccupancy.assign(iNStrips, 0);
+        for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); ++iterPhi) { //Loop Over iPhi Sectors
+            for (auto iterHit = (*iterPhi).second.map_hits.begin(); iterHit != (*iterPhi).second.map_hits.end(); ++iterHit) { //Loop Over Stored Hits
+                if ( (*iterHit).second.iStripNum < 0 || (*iterHit).second.iStripNum >= iNStrips ) continue;
+
+                StripHealthStats & stats = vec_stats[(*iterHit).second.iStripNum];
+
+                ++vec_lOccupancy[(*iterHit).second.iStripNum];
+
+                //Welford update of the ADC at the max time bin
+                dADC    = (*iterHit).second.vec_sADC[(*iterHit).second.iTimeBin];
+                dDelta  = dADC - stats.dADC_Mean;
+                stats.dADC_Mean += dDelta / (stats.lOccupancy + vec_lOccupancy[(*iterHit).second.iStripNum]);
+                stats.dADC_M2   += dDelta * (dADC - stats.dADC_Mean);
+            } //End Loop Over Stored Hits
+        } //End Loop Over iPhi Sectors
+
+        //Determine the median occupancy of the sector; masked strips have no hits by construction and are left out
+        vec_lSorted.clear();
+        for (int i=0; i < iNStrips; ++i) {
+            if ( !maskStrips.isMasked( (*iterEta).first, i ) ) vec_lSorted.push_back( vec_lOccupancy[i] );
+        }
+
+        if ( vec_lSorted.empty() ) continue;
+
+        std::nth_element(vec_lSorted.begin(), vec_lSorted.begin() + vec_lSorted.size() / 2, vec_lSorted.end() );
+        dMedian = vec_lSorted[vec_lSorted.size() / 2];
+
+        //Test each strip against the median
+        for (int i=0; i < iNStrips; ++i) { //Loop Over Strips
+            if ( maskStrips.isMasked( (*iterEta).first, i ) ) continue;
+
+            StripHealthStats & stats = vec_stats[i];
+
+            stats.lOccupancy    += vec_lOccupancy[i];
+            stats.dExpected     += dMedian;
+
+            //Dead strip test
+            if ( getPoissonCDF(0, dMedian) < aSetup.fStripHealth_PVal_Dead ) { //Case: Run is Conclusive
+                ++stats.iNRuns_Conclusive;
+
+                if ( getPoissonCDF(vec_lOccupancy[i], dMedian) < aSetup.fStripHealth_PVal_Dead ) { ++stats.iNRuns_Dead; }
+            } //End Case: Run is Conclusive
+
+            //Hot strip test
+            if ( dMedian > 0 && vec_lOccupancy[i] > 2. * dMedian && ( vec_lOccupancy[i] - dMedian ) > aSetup.fStripHealth_NSigma_Hot * sqrt(dMedian) ) { ++stats.iNRuns_Hot; }
+        } //End Loop Over Strips
+    } //End Loop Over iEta Sectors
+
+    ++iNum_RunsAccumulated;
+
+    return;
+} //End AnalyzeStripHealth::accumulateRun()
+
+//Returns the status of a strip based on all runs accumulated so far
+StripHealthStatus AnalyzeStripHealth::getStatus(const StripHealthStats & inputStats){
+    //Hot in the majority of runs?
+    if ( 2 * inputStats.iNRuns_Hot > iNum_RunsAccumulated ) { return kStrip_Hot; }
+
+    //Not enough statistics to say anything
+    if ( inputStats.iNRuns_Conclusive == 0 ) { return kStrip_Unknown; }
+
+    //Dead in every run, or only in some of them?
+    if ( inputStats.iNRuns_Dead == inputStats.iNRuns_Conclusive ) { return kStrip_Dead; }
+    if ( inputStats.iNRuns_Dead > 0 ) { return kStrip_Intermittent; }
+
+    return kStrip_Healthy;
+} //End AnalyzeStripHealth::getStatus()
+
+//Returns the status of strip iStrip of sector iEta
+StripHealthStatus AnalyzeStripHealth::getStatus(int iEta, int iStrip){
+    if ( maskStrips.isMasked(iEta, iStrip) ) { return kStrip_Masked; }
+
+    return getStatus( map_stripStats[iEta][iStrip] );
+} //End AnalyzeStripHealth::getStatus()
+
+//Returns a mask where every dead, hot, intermittent, or already masked strip is set
+StripMask AnalyzeStripHealth::getStripMask(){
+    //Variable Declaration
+    StripHealthStatus status;
+
+    StripMask retMask;
+
+    for (auto iterEta = map_stripStats.begin(); iterEta != map_stripStats.end(); ++iterEta) { //Loop Over iEta Sectors
+        for (int i=0; i < (*iterEta).second.size(); ++i) { //Loop Over Strips
+            status = getStatus( (*iterEta).first, i );
+
+            if ( kStrip_Dead == status || kStrip_Hot == status || kStrip_Intermittent == status || kStrip_Masked == status ) {
+                retMask.setMasked( (*iterEta).first, i );
+            }
+        } //End Loop Over Strips
+    } //End Loop Over iEta Sectors
+
+    return retMask;
+} //End AnalyzeStripHealth::getStripMask()
+
+//Returns the poisson probability of observing lObs or fewer counts given an expectation dMean
+//Only the lower tail is needed by the dead strip test; lObs >= dMean returns 1
+//Evaluated in log space since exp(-dMean) underflows for large dMean
+double AnalyzeStripHealth::getPoissonCDF(long lObs, double dMean){
+    //Variable Declaration
+    double dLogTerm_Max;
+    double dSum = 0.;
+    double dTerm = 1.;
+
+    if ( !(dMean > 0) || lObs >= dMean ) { return 1.; }
+
+    //Terms increase with k below the mean; the largest is k = lObs
+    dLogTerm_Max = -dMean + lObs * log(dMean) - lgamma(lObs + 1.);
+
+    for (long k=lObs; k >= 0 && dTerm > 1e-16; --k) { //Loop Over Terms
+        dSum += dTerm;
+        dTerm *= k / dMean; //Ratio of term k-1 to term k
+    } //End Loop Over Terms
+
+    return exp(dLogTerm_Max) * dSum;
+} //End AnalyzeStripHealth::getPoissonCDF()
+
+//Returns a string describing the input status
+string AnalyzeStripHealth::getStatusName(StripHealthStatus inputStatus){
+    switch (inputStatus) {
+        case kStrip_Healthy:        return "HEALTHY";
+        case kStrip_Dead:           return "DEAD";
+        case kStrip_Hot:            return "HOT";
+        case kStrip_Intermittent:   return "INTERMITTENT";
+        case kStrip_Masked:         return "MASKED";
+        default:                    return "UNKNOWN";
+    }
+} //End AnalyzeStripHealth::getStatusName()
+
+//Writes the per strip statistics & status of every strip
+void AnalyzeStripHealth::printHealthReport(string & strOutputTextFileName){
+    //Variable Declaration
+    std::fstream file_Report;
+
+    //Setup output file
+    //------------------------------------------------------
+    file_Report.open( strOutputTextFileName.c_str(), std::fstream::out );
+
+    if (!file_Report.is_open()) { //Case: Output file not opened
+        perror( ("AnalyzeStripHealth::printHealthReport() - error while opening file: " + strOutputTextFileName).c_str() );
+        printStreamStatus(file_Report);
+
+        cout<<"\tStrip health report is being skipped!\n";
+
+        return;
+    } //End Case: Output file not opened
+
+    file_Report<<"#Runs = "<<iNum_RunsAccumulated<<endl;
+    file_Report<<"#StripHealth_PVal_Dead = "<<aSetup.fStripHealth_PVal_Dead<<endl;
+    file_Report<<"#StripHealth_NSigma_Hot = "<<aSetup.fStripHealth_NSigma_Hot<<endl;
+    file_Report<<"#iEta\tiPhi\tiStrip\tStrip\tStatus\tOccupancy\tExpected\tNRuns_Dead\tNRuns_Hot\tNRuns_Conclusive\tADC_Mean\tADC_RMS\n";
+
+    for (auto iterEta = map_stripStats.begin(); iterEta != map_stripStats.end(); ++iterEta) { //Loop Over iEta Sectors
+        for (int i=0; i < (*iterEta).second.size(); ++i) { //Loop Over Strips
+            StripHealthStats & stats = (*iterEta).second[i];
+
+            file_Report<<(*iterEta).first<<"\t"<<getPhiSectorVal(i+1, 128)<<"\t"<<getPhiStripNum(i+1, 128)<<"\t"<<i<<"\t";
+            file_Report<<getStatusName( getStatus( (*iterEta).first, i ) )<<"\t";
+            file_Report<<stats.lOccupancy<<"\t"<<stats.dExpected<<"\t";
+            file_Report<<stats.iNRuns_Dead<<"\t"<<stats.iNRuns_Hot<<"\t"<<stats.iNRuns_Conclusive<<"\t";
+            file_Report<<stats.dADC_Mean<<"\t"<<( (stats.lOccupancy > 1) ? sqrt( stats.dADC_M2 / (stats.lOccupancy - 1) ) : 0. )<<endl;
+        } //End Loop Over Strips
+    } //End Loop Over iEta Sectors
+
+    file_Report.close();
+
+    return;
+} //End AnalyzeStripHealth::printHealthReport()
+
+//Writes the list of masked strips; can be read back by loadStripMask()
+void AnalyzeStripHealth::printStripMask(string & strOutputTextFileName){
+    //Variable Declaration
+    StripHealthStatus status;
+
+    std::fstream file_Mask;
+
+    //Setup output file
+    //------------------------------------------------------
+    file_Mask.open( strOutputTextFileName.c_str(), std::fstream::out );
+
+    if (!file_Mask.is_open()) { //Case: Output file not opened
+        perror( ("AnalyzeStripHealth::printStripMask() - error while opening file: " + strOutputTextFileName).c_str() );
+        printStreamStatus(file_Mask);
+
+        cout<<"\tStrip mask is being skipped!\n";
+
+        return;
+    } //End Case: Output file not opened
+
+    file_Mask<<"#iEta\tStrip\tStatus\n";
+
+    for (auto iterEta = map_stripStats.begin(); iterEta != map_stripStats.end(); ++iterEta) { //Loop Over iEta Sectors
+        for (int i=0; i < (*iterEta).second.size(); ++i) { //Loop Over Strips
+            status = getStatus( (*iterEta).first, i );
+
+            //Strips of the input mask are kept, the new mask can replace the old one
+            if ( kStrip_Dead == status || kStrip_Hot == status || kStrip_Intermittent == status || kStrip_Masked == status ) {
+                file_Mask<<(*iterEta).first<<"\t"<<i<<"\t"<<getStatusName(status)<<endl;
+            }
+        } //End Loop Over Strips
+    } //End Loop Over iEta Sectors
+
+    file_Mask.close();
+
+    return;
+} //End AnalyzeStripHealth::printStripMask()
+
+//Loads a strip mask written by AnalyzeStripHealth::printStripMask()
+//Each line is "iEta Strip [Status]"; lines starting with '#' are ignored
+StripMask QualityControl::Uniformity::loadStripMask(string & strInputTextFileName){
+    //Variable Declaration
+    int iEta, iStrip;
+
+    string strLine;
+
+    std::ifstream file_Mask;
+
+    StripMask retMask;
+
+    //Open input file
+    //------------------------------------------------------
+    file_Mask.open( strInputTextFileName.c_str() );
+
+    if (!file_Mask.is_open()) { //Case: Input file not opened
+        perror( ("Uniformity::loadStripMask() - error while opening file: " + strInputTextFileName).c_str() );
+        printStreamStatus(file_Mask);
+
+        cout<<"\tNo strips will be masked!\n";
+
+        return retMask;
+    } //End Case: Input file not opened
+
+    while ( std::getline(file_Mask, strLine) ) { //Loop Over Input File
+        if ( strLine.empty() || 0 == strLine.compare(0,1,"#") ) continue;
+
+        if ( 2 == sscanf(strLine.c_str(), "%i %i", &iEta, &iStrip) ) {
+            retMask.setMasked(iEta, iStrip);
+        }
+        else{
+            printClassMethodMsg("Uniformity","loadStripMask",("\tLine not understood: " + strLine).c_str() );
+        }
+    } //End Loop Over Input File
+
+    file_Mask.close();
+
+    return retMask;
+} //End Uniformity::loadStripMask()
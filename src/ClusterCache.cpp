@@ -0,0 +1,383 @@
+//
+//  ClusterCache.cpp
+//  
+//
+//
+//
+
+#include "ClusterCache.h"
+
+//C++ Includes
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+//POSIX Includes
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+using namespace QualityControl::Uniformity;
+
+//Default Constructor
+ClusterCacheWriter::ClusterCacheWriter(){
+    bWriteSuccess = true;
+    
+    file_Output = NULL;
+} //End Default Constructor
+
+//Appends one event holding iNClusters clusters
+void ClusterCacheWriter::addEvent(const ClusterCacheRecord * ptr_Clusters, int iNClusters){
+    if ( file_Output == NULL || !bWriteSuccess ) return;
+    
+    //Index of this event's first cluster
+    uint64_t ulFirst = vec_ulEvtOffset.empty() ? 0 : vec_ulEvtOffset.back();
+    
+    //A short write (e.g. disk full) is reported by close(), which then deletes the file
+    if ( iNClusters > 0 && fwrite(ptr_Clusters, sizeof(ClusterCacheRecord), iNClusters, file_Output) != (size_t)iNClusters ) {
+        bWriteSuccess = false;
+        
+        return;
+    }
+    
+    //vec_ulEvtOffset holds the start of each event followed by the running total
+    if ( vec_ulEvtOffset.empty() ) { vec_ulEvtOffset.push_back(0); }
+    vec_ulEvtOffset.push_back( ulFirst + (iNClusters > 0 ? iNClusters : 0) );
+    
+    return;
+} //End ClusterCacheWriter::addEvent()
+
+//Writes the event index & the final header, then closes the file
+bool ClusterCacheWriter::close(){
+    if ( file_Output == NULL ) return true;
+    
+    //Variable Declaration
+    ClusterCacheHeader header;
+    
+    if ( vec_ulEvtOffset.empty() ) { vec_ulEvtOffset.push_back(0); }
+    
+    //Event index follows the records
+    bWriteSuccess = bWriteSuccess && ( fwrite(vec_ulEvtOffset.data(), sizeof(uint64_t), vec_ulEvtOffset.size(), file_Output) == vec_ulEvtOffset.size() );
+    
+    //Final header
+    memcpy(header.cMagic, strClusterCache_Magic, sizeof(header.cMagic) );
+    header.uiVersion    = uiClusterCache_Version;
+    header.uiRecordSize = sizeof(ClusterCacheRecord);
+    header.ulNEvents    = vec_ulEvtOffset.size() - 1;
+    header.ulNClusters  = vec_ulEvtOffset.back();
+    
+    bWriteSuccess = bWriteSuccess && ( fseek(file_Output, 0, SEEK_SET) == 0 );
+    bWriteSuccess = bWriteSuccess && ( fwrite(&header, sizeof(header), 1, file_Output) == 1 );
+    bWriteSuccess = ( fclose(file_Output) == 0 ) && bWriteSuccess;
+    
+    //The file is written under a temporary name so an interrupted job never leaves a truncated cache behind
+    if ( bWriteSuccess ) {
+        std::rename( ( strFile_Output + ".part" ).c_str(), strFile_Output.c_str() );
+    }
+    else{
+        perror( ("ClusterCacheWriter::close() - error while writing file: " + strFile_Output ).c_str() );
+        std::remove( ( strFile_Output + ".part" ).c_str() );
+    }
+    
+    file_Output = NULL;
+    vec_ulEvtOffset.clear();
+    
+    return bWriteSuccess;
+} //End ClusterCacheWriter::close()
+
+//Opens strOutputFileName for writing
+bool ClusterCacheWriter::open(std::string strOutputFileName){
+    //Variable Declaration
+    ClusterCacheHeader header;
+    
+    close();
+    
+    strFile_Output = strOutputFileName;
+    
+    bWriteSuccess = true;
+    
+    file_Output = fopen( ( strFile_Output + ".part" ).c_str(), "wb");
+    
+    if ( file_Output == NULL ) {
+        perror( ("ClusterCacheWriter::open() - error while opening file: " + strFile_Output ).c_str() );
+        
+        return false;
+    }
+    
+    //Placeholder header, completed by close()
+    memset(&header, 0, sizeof(header) );
+    if ( fwrite(&header, sizeof(header), 1, file_Output) != 1 ) {
+        perror( ("ClusterCacheWriter::open() - error while writing file: " + strFile_Output ).c_str() );
+        fclose(file_Output);
+        std::remove( ( strFile_Output + ".part" ).c_str() );
+        file_Output = NULL;
+        
+        return false;
+    }
+    
+    vec_ulEvtOffset.clear();
+    
+    return true;
+} //End ClusterCacheWriter::open()
+
+//Default Constructor
+ClusterCacheReader::ClusterCacheReader(){
+    iFileSize = 0;
+    
+    ptr_Map = NULL;
+    
+    ptr_Header = NULL;
+    ptr_Records = NULL;
+    ptr_EvtOffset = NULL;
+} //End Default Constructor
+
+//Unmaps the file
+void ClusterCacheReader::close(){
+    if ( ptr_Map != NULL ) { munmap(ptr_Map, iFileSize); }
+    
+    iFileSize = 0;
+    
+    ptr_Map = NULL;
+    
+    ptr_Header = NULL;
+    ptr_Records = NULL;
+    ptr_EvtOffset = NULL;
+    
+    return;
+} //End ClusterCacheReader::close()
+
+//Memory maps strInputFileName and checks its header & size
+bool ClusterCacheReader::open(std::string strInputFileName){
+    //Variable Declaration
+    int iFileDesc;
+    
+    size_t iExpectedSize;
+    
+    struct stat statFile;
+    
+    const ClusterCacheHeader * ptr_TestHeader = NULL;
+    
+    close();
+    
+    iFileDesc = ::open(strInputFileName.c_str(), O_RDONLY);
+    
+    if ( iFileDesc < 0 ) {
+        perror( ("ClusterCacheReader::open() - error while opening file: " + strInputFileName ).c_str() );
+        
+        return false;
+    }
+    
+    if ( fstat(iFileDesc, &statFile) != 0 || statFile.st_size < (off_t)sizeof(ClusterCacheHeader) ) {
+        cout<<"ClusterCacheReader::open() - " << strInputFileName << " is too small to be a cluster cache\n";
+        ::close(iFileDesc);
+        
+        return false;
+    }
+    
+    iFileSize = statFile.st_size;
+    
+    ptr_Map = mmap(NULL, iFileSize, PROT_READ, MAP_PRIVATE, iFileDesc, 0);
+    
+    //The mapping stays valid after the descriptor is closed
+    ::close(iFileDesc);
+    
+    if ( ptr_Map == MAP_FAILED ) {
+        perror( ("ClusterCacheReader::open() - error while mapping file: " + strInputFileName ).c_str() );
+        ptr_Map = NULL;
+        iFileSize = 0;
+        
+        return false;
+    }
+    
+    //Check the header & the file size
+    ptr_TestHeader = (const ClusterCacheHeader *) ptr_Map;
+    
+    iExpectedSize = sizeof(ClusterCacheHeader) + ptr_TestHeader->ulNClusters * sizeof(ClusterCacheRecord) + ( ptr_TestHeader->ulNEvents + 1 ) * sizeof(uint64_t);
+    
+    if ( memcmp(ptr_TestHeader->cMagic, strClusterCache_Magic, sizeof(strClusterCache_Magic) ) != 0
+        || ptr_TestHeader->uiVersion != uiClusterCache_Version
+        || ptr_TestHeader->uiRecordSize != sizeof(ClusterCacheRecord)
+        || iExpectedSize != iFileSize ) { //Case: Not a Valid Cluster Cache
+        cout<<"ClusterCacheReader::open() - " << strInputFileName << " is not a valid cluster cache (version " << uiClusterCache_Version << ")\n";
+        close();
+        
+        return false;
+    } //End Case: Not a Valid Cluster Cache
+    
+    ptr_Header      = ptr_TestHeader;
+    ptr_Records     = (const ClusterCacheRecord *) ( (const char *) ptr_Map + sizeof(ClusterCacheHeader) );
+    ptr_EvtOffset   = (const uint64_t *) ( ptr_Records + ptr_Header->ulNClusters );
+    
+    //Events are read sequentially
+    madvise(ptr_Map, iFileSize, MADV_SEQUENTIAL);
+    
+    return true;
+} //End ClusterCacheReader::open()
+
+//Converts the TCluster tree of an amoreSRS/framework output file into a cluster cache
+bool QualityControl::Uniformity::convertClusterTree(TTree * tree_Clusters, std::string strOutputFileName){
+    //Variable Declaration
+    bool bHasDetID = false;
+    
+    Int_t iClustMulti = 0, iClustMulti_Max = 1;
+    
+    vector<Int_t> vec_iClustSize, vec_iClustTimeBin, vec_iClustDetID;
+    
+    vector<Float_t> vec_fClustPos_X, vec_fClustPos_Y, vec_fClustADC;
+    
+    vector<ClusterCacheRecord> vec_Records;
+    
+    ClusterCacheWriter writerCache;
+    
+    TBranch * branch_Multi = NULL;
+    
+    if ( tree_Clusters == nullptr ) return false;
+    
+    branch_Multi = tree_Clusters->GetBranch("nclust");
+    
+    if ( branch_Multi == nullptr ) return false;
+    
+    //Our branch addresses are only valid in this function; the caller's are put back on return
+    TreeBranchState stateCaller(tree_Clusters);
+    
+    //Size the buffers from the largest multiplicity of the tree, only the nclust branch is read
+    //------------------------------------------------------
+    tree_Clusters->SetBranchStatus("*",0);
+    tree_Clusters->SetBranchStatus("nclust",1);
+    tree_Clusters->SetBranchAddress("nclust", &iClustMulti);
+    
+    for (Long64_t i=0; i < tree_Clusters->GetEntries(); ++i) { //Loop Over Events
+        branch_Multi->GetEntry(i);
+        
+        iClustMulti_Max = std::max(iClustMulti_Max, iClustMulti);
+    } //End Loop Over Events
+    
+    vec_iClustSize.resize(iClustMulti_Max);
+    vec_iClustTimeBin.resize(iClustMulti_Max);
+    vec_iClustDetID.resize(iClustMulti_Max);
+    vec_fClustPos_X.resize(iClustMulti_Max);
+    vec_fClustPos_Y.resize(iClustMulti_Max);
+    vec_fClustADC.resize(iClustMulti_Max);
+    
+    if ( !writerCache.open(strOutputFileName) ) return false;
+    
+    cout<<"QualityControl::Uniformity::convertClusterTree() - Writing cluster cache " << strOutputFileName << endl;
+    
+    //Initialize Tree Branch Address to retrieve the cluster information
+    //------------------------------------------------------
+    bHasDetID = ( tree_Clusters->GetBranch("detID") != nullptr );
+    
+    tree_Clusters->SetBranchStatus("*",1);
+    tree_Clusters->SetBranchAddress("clustPos",vec_fClustPos_X.data());
+    tree_Clusters->SetBranchAddress("clustSize",vec_iClustSize.data());
+    tree_Clusters->SetBranchAddress("clustADCs",vec_fClustADC.data());
+    tree_Clusters->SetBranchAddress("clustTimebin",vec_iClustTimeBin.data());
+    tree_Clusters->SetBranchAddress("planeID",vec_fClustPos_Y.data());
+    if (bHasDetID) { tree_Clusters->SetBranchAddress("detID",vec_iClustDetID.data()); }
+    
+    //Copy every event
+    //------------------------------------------------------
+    for (Long64_t i=0; i < tree_Clusters->GetEntries(); ++i) { //Loop Over Events
+        tree_Clusters->GetEntry(i);
+        
+        if ( iClustMulti < 0 ) iClustMulti = 0;
+        
+        vec_Records.resize(iClustMulti);
+        
+        for (int j=0; j < iClustMulti; ++j) { //Loop Over Clusters
+            vec_Records[j].fPlaneID     = vec_fClustPos_Y[j];
+            vec_Records[j].fPos         = vec_fClustPos_X[j];
+            vec_Records[j].fADC         = vec_fClustADC[j];
+            vec_Records[j].iSize        = vec_iClustSize[j];
+            vec_Records[j].iTimeBin     = vec_iClustTimeBin[j];
+            vec_Records[j].iDetID       = bHasDetID ? vec_iClustDetID[j] : 0;
+        } //End Loop Over Clusters
+        
+        writerCache.addEvent(vec_Records.data(), iClustMulti);
+    } //End Loop Over Events
+    
+    return writerCache.close();
+} //End QualityControl::Uniformity::convertClusterTree()
+
+//Saves the branch statuses & addresses of inputTree
+TreeBranchState::TreeBranchState(TTree * inputTree){
+    tree_Input = inputTree;
+    
+    if ( tree_Input == nullptr ) return;
+    
+    TObjArray * list_Branches = tree_Input->GetListOfBranches();
+    
+    for (int i=0; i < list_Branches->GetEntriesFast(); ++i) { //Loop Over Branches
+        TBranch * branch = (TBranch *) list_Branches->At(i);
+        
+        vec_Branches.push_back(branch);
+        vec_ptrAddress.push_back( branch->GetAddress() );
+        vec_bStatus.push_back( tree_Input->GetBranchStatus( branch->GetName() ) );
+    } //End Loop Over Branches
+} //End Constructor
+
+//Restores the branch statuses & addresses of tree_Input
+TreeBranchState::~TreeBranchState(){
+    for (unsigned int i=0; i < vec_Branches.size(); ++i) { //Loop Over Branches
+        tree_Input->SetBranchStatus( vec_Branches[i]->GetName(), vec_bStatus[i] );
+        
+        if ( vec_ptrAddress[i] != NULL ) { tree_Input->SetBranchAddress( vec_Branches[i]->GetName(), (void *) vec_ptrAddress[i] ); }
+        else { tree_Input->ResetBranchAddress( vec_Branches[i] ); }
+    } //End Loop Over Branches
+} //End Destructor
+
+//Concatenates the events of the caches in vec_strInputFileNames, in order, into strOutputFileName
+bool QualityControl::Uniformity::mergeClusterCaches(const std::vector<std::string> & vec_strInputFileNames, std::string strOutputFileName){
+    //Variable Declaration
+    vector<ClusterCacheReader> vec_readerCache(vec_strInputFileNames.size() );
+    
+    ClusterCacheWriter writerCache;
+    
+    //All inputs are checked first, the output is never left with a part of the events
+    for (unsigned int i=0; i < vec_strInputFileNames.size(); ++i) { //Loop Over Input Caches
+        if ( !vec_readerCache[i].open(vec_strInputFileNames[i]) ) {
+            cout<<"QualityControl::Uniformity::mergeClusterCaches() - cannot read " << vec_strInputFileNames[i] << ", " << strOutputFileName << " not written" << endl;
+            
+            return false;
+        }
+    } //End Loop Over Input Caches
+    
+    if ( !writerCache.open(strOutputFileName) ) return false;
+    
+    for (unsigned int i=0; i < vec_readerCache.size(); ++i) { //Loop Over Input Caches
+        for (int iEvt=0; iEvt < vec_readerCache[i].getNumEvents(); ++iEvt) { //Loop Over Events
+            writerCache.addEvent(vec_readerCache[i].getClusters(iEvt), vec_readerCache[i].getNumClusters(iEvt) );
+        } //End Loop Over Events
+    } //End Loop Over Input Caches
+    
+    return writerCache.close();
+} //End QualityControl::Uniformity::mergeClusterCaches()
+
+//Returns the name of the cluster cache belonging to strInputRootFileName
+std::string QualityControl::Uniformity::getClusterCacheName(std::string strInputRootFileName){
+    if ( strInputRootFileName.rfind(".root") != string::npos ) {
+        strInputRootFileName.erase( strInputRootFileName.rfind(".root") );
+    }
+    
+    return strInputRootFileName + strClusterCache_Ext;
+} //End QualityControl::Uniformity::getClusterCacheName()
+
+//Returns true if strCacheFileName exists and is not older than strInputRootFileName
+bool QualityControl::Uniformity::isClusterCacheCurrent(std::string strCacheFileName, std::string strInputRootFileName){
+    //Variable Declaration
+    struct stat statCache, statRoot;
+    
+    if ( stat(strCacheFileName.c_str(), &statCache) != 0 ) return false;
+    
+    //No ROOT file to compare against, trust the cache
+    if ( stat(strInputRootFileName.c_str(), &statRoot) != 0 ) return true;
+    
+    return ( statCache.st_mtime >= statRoot.st_mtime );
+} //End QualityControl::Uniformity::isClusterCacheCurrent()
@@ -0,0 +1,259 @@
+//
+//  ComparisonInput.cpp
+//  
+//
+//
+//
+
+#include "ComparisonInput.h"
+
+using std::cout;
+using std::endl;
+using std::make_shared;
+using std::map;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+using QualityControl::Timing::getString;
+using QualityControl::Timing::printROOTFileStatus;
+
+using namespace QualityControl::Uniformity;
+
+//Default Constructor
+ComparisonInput::ComparisonInput(){
+    m_iCacheSize = 256;
+    m_iNCacheHits = m_iNCacheMisses = 0;
+    m_iNThreads = 1;
+} //End Default Constructor
+
+//Closes all input files and wipes the cache & the key index
+void ComparisonInput::close(){
+    for (int i=0; i < m_vec_fileInput.size(); ++i) { //Loop Over Input Files
+        if ( m_vec_fileInput[i] != nullptr ) {
+            m_vec_fileInput[i]->Close();
+            delete m_vec_fileInput[i];
+            m_vec_fileInput[i] = nullptr;
+        }
+    } //End Loop Over Input Files
+    
+    for (int i=0; i < m_vec_map_strIndex.size(); ++i) { m_vec_map_strIndex[i].clear(); }
+    
+    m_list_cache.clear();
+    m_map_cacheIdx.clear();
+    
+    return;
+} //End ComparisonInput::close()
+
+//Reads every histogram in vec_strPaths from every input file in vec_iFiles which is not cached yet
+void ComparisonInput::prefetch(std::vector<int> & vec_iFiles, std::vector<std::string> & vec_strPaths){
+    //TFile does not manage objects
+    TH1::AddDirectory(kFALSE);
+    
+    //Variable Declaration
+    int iNThreads = m_iNThreads;
+    
+    vector<std::thread> vec_threads;
+    
+    if ( vec_iFiles.size() == 0 || vec_strPaths.size() == 0 ) return;
+    
+    //The cache must hold everything prefetched, otherwise the first histograms are dropped before they are asked for
+    if ( m_iCacheSize < (int)( vec_iFiles.size() * vec_strPaths.size() ) ) { m_iCacheSize = vec_iFiles.size() * vec_strPaths.size(); }
+    
+    //Never start more threads than files
+    if ( iNThreads > (int)vec_iFiles.size() ) { iNThreads = vec_iFiles.size(); }
+    
+    //Serial Case
+    //------------------------------------------------------
+    if ( iNThreads <= 1 ) { //Case: Serial Reading
+        for (int i=0; i < vec_iFiles.size(); ++i) {
+            prefetchFile(vec_iFiles[i], vec_strPaths);
+        }
+        
+        return;
+    } //End Case: Serial Reading
+    
+    //Parallel Case: files are dealt round-robin to the threads
+    //------------------------------------------------------
+    ROOT::EnableThreadSafety();
+    
+    for (int iThread=0; iThread < iNThreads; ++iThread) { //Loop Over Threads
+        vec_threads.push_back( std::thread( [this, iThread, iNThreads, &vec_iFiles, &vec_strPaths](){
+            for (int i=iThread; i < vec_iFiles.size(); i+=iNThreads) {
+                prefetchFile(vec_iFiles[i], vec_strPaths);
+            }
+        } ) );
+    } //End Loop Over Threads
+    
+    for (int iThread=0; iThread < vec_threads.size(); ++iThread) {
+        vec_threads[iThread].join();
+    }
+    
+    return;
+} //End ComparisonInput::prefetch()
+
+//Returns a copy of the histogram found at strPath in input file iFile
+shared_ptr<TH1F> ComparisonInput::getHisto(int iFile, std::string strPath){
+    //TFile does not manage objects
+    TH1::AddDirectory(kFALSE);
+    
+    //Variable Declaration
+    ComparisonKey keyHisto = std::make_pair(iFile, strPath);
+    
+    shared_ptr<TH1F> hCached = getFromCache(keyHisto);
+    
+    if ( hCached == nullptr ) { //Case: Not Cached, Read from File
+        hCached = readHisto(iFile, strPath);
+        
+        if ( hCached == nullptr ) return hCached;
+        
+        addToCache(keyHisto, hCached);
+    } //End Case: Not Cached, Read from File
+    
+    //Callers modify the histogram (name, style, normalization); never hand out the cached object
+    return make_shared<TH1F>( *hCached );
+} //End ComparisonInput::getHisto()
+
+//Adds inputHisto to the cache and drops the least recently used histograms beyond m_iCacheSize
+void ComparisonInput::addToCache(ComparisonKey & inputKey, std::shared_ptr<TH1F> inputHisto){
+    std::lock_guard<std::mutex> lock(m_mutex_cache);
+    
+    //Another thread may have cached it in the meantime
+    if ( m_map_cacheIdx.count(inputKey) > 0 ) return;
+    
+    m_list_cache.push_front( std::make_pair(inputKey, inputHisto) );
+    m_map_cacheIdx[inputKey] = m_list_cache.begin();
+    
+    //Drop the least recently used histograms
+    while ( m_list_cache.size() > m_iCacheSize ) {
+        m_map_cacheIdx.erase( m_list_cache.back().first );
+        m_list_cache.pop_back();
+    }
+    
+    return;
+} //End ComparisonInput::addToCache()
+
+//Recursively adds the path (key) and class name (value) of every object in dir_Input to map_strIndex
+void ComparisonInput::indexDirectory(TDirectory * dir_Input, std::string strPrefix, std::map<std::string, std::string> & map_strIndex){
+    //Variable Declaration
+    TClass *class_Obj = NULL;
+    
+    TKey *key = NULL;
+    
+    TIter iterKey( dir_Input->GetListOfKeys() );
+    
+    while ( ( key = (TKey*) iterKey() ) ) { //Loop Over Keys
+        string strPath = strPrefix + key->GetName();
+        
+        class_Obj = gROOT->GetClass( key->GetClassName() );
+        
+        if ( class_Obj != nullptr && class_Obj->InheritsFrom("TDirectory") ) { //Case: Sub-Directory
+            TDirectory *dir_Sub = dir_Input->GetDirectory( key->GetName() );
+            
+            if ( dir_Sub != nullptr ) { indexDirectory(dir_Sub, strPath + "/", map_strIndex); }
+        } //End Case: Sub-Directory
+        else{ //Case: Object
+            map_strIndex[strPath] = key->GetClassName();
+        } //End Case: Object
+    } //End Loop Over Keys
+    
+    return;
+} //End ComparisonInput::indexDirectory()
+
+//Opens input file iFile & builds its key index if this has not been done yet
+bool ComparisonInput::openFile(int iFile){
+    if ( iFile < 0 || iFile >= m_vec_fileInput.size() ) return false;
+    
+    if ( m_vec_fileInput[iFile] != nullptr ) return true;
+    
+    //Variable Declaration
+    TFile * file_Input = new TFile(m_vec_strFileList[iFile].c_str(), "READ","",1);
+    
+    //Check if File Failed to Open Correctly
+    //------------------------------------------------------
+    if ( !file_Input->IsOpen() || file_Input->IsZombie()  ) {
+        printClassMethodMsg("ComparisonInput","openFile",("Error: File I/O for " + m_vec_strFileList[iFile]).c_str() );
+        printROOTFileStatus(file_Input);
+        printClassMethodMsg("ComparisonInput","openFile", "\tPlease cross check input file name, option, and the execution directory\n" );
+        
+        delete file_Input;
+        
+        return false;
+    } //End Check if File Failed to Open Correctly
+    
+    //Build the key index once
+    //------------------------------------------------------
+    indexDirectory(file_Input, "", m_vec_map_strIndex[iFile]);
+    
+    m_vec_fileInput[iFile] = file_Input;
+    
+    return true;
+} //End ComparisonInput::openFile()
+
+//Reads all histograms in vec_strPaths from input file iFile into the cache
+void ComparisonInput::prefetchFile(int iFile, std::vector<std::string> & vec_strPaths){
+    //Variable Declaration
+    shared_ptr<TH1F> hObs;
+    
+    for (int i=0; i < vec_strPaths.size(); ++i) { //Loop Over Requested Paths
+        ComparisonKey keyHisto = std::make_pair(iFile, vec_strPaths[i]);
+        
+        if ( getFromCache(keyHisto) != nullptr ) continue;
+        
+        hObs = readHisto(iFile, vec_strPaths[i]);
+        
+        if ( hObs != nullptr ) { addToCache(keyHisto, hObs); }
+    } //End Loop Over Requested Paths
+    
+    return;
+} //End ComparisonInput::prefetchFile()
+
+//Returns the cached histogram for inputKey (and marks it as most recently used)
+shared_ptr<TH1F> ComparisonInput::getFromCache(ComparisonKey & inputKey){
+    std::lock_guard<std::mutex> lock(m_mutex_cache);
+    
+    //Variable Declaration
+    auto iterIdx = m_map_cacheIdx.find(inputKey);
+    
+    if ( iterIdx == m_map_cacheIdx.end() ) { //Case: Cache Miss
+        ++m_iNCacheMisses;
+        return shared_ptr<TH1F>();
+    } //End Case: Cache Miss
+    
+    //Case: Cache Hit, move to the front
+    ++m_iNCacheHits;
+    m_list_cache.splice( m_list_cache.begin(), m_list_cache, (*iterIdx).second );
+    
+    return (*iterIdx).second->second;
+} //End ComparisonInput::getFromCache()
+
+//Reads the histogram at strPath from input file iFile
+shared_ptr<TH1F> ComparisonInput::readHisto(int iFile, std::string & strPath){
+    //Variable Declaration
+    shared_ptr<TH1F> ret_hObs;
+    
+    TClass *class_Obj = NULL;
+    
+    if ( !openFile(iFile) ) return ret_hObs;
+    
+    //Use the key index instead of letting ROOT walk the directories for a missing object
+    auto iterIdx = m_vec_map_strIndex[iFile].find(strPath);
+    
+    if ( iterIdx == m_vec_map_strIndex[iFile].end() ) { //Case: Not in File
+        printClassMethodMsg("ComparisonInput","readHisto",( "Did not find " + strPath + " in " + m_vec_strFileList[iFile] ).c_str() );
+        
+        return ret_hObs;
+    } //End Case: Not in File
+    
+    class_Obj = gROOT->GetClass( (*iterIdx).second.c_str() );
+    
+    if ( class_Obj == nullptr || !class_Obj->InheritsFrom("TH1F") ) { //Case: Not a TH1F
+        printClassMethodMsg("ComparisonInput","readHisto",( strPath + " in " + m_vec_strFileList[iFile] + " is not a TH1F" ).c_str() );
+        
+        return ret_hObs;
+    } //End Case: Not a TH1F
+    
+    ret_hObs = shared_ptr<TH1F>( (TH1F*) m_vec_fileInput[iFile]->Get( strPath.c_str() ) );
+    
+    return ret_hObs;
+} //End ComparisonInput::readHisto()
@@ -207,6 +207,22 @@ float DetectorMPGD::getEtaPos(int iEta){
     } //End Case: iEta Value does not exist
 } //End DetectorMPGD::getEtaPos()
 
+//Returns the iEta sector matching an input Y position; -1 if no match
+//Uses the same +/- 10% window as setHit() & setCluster()
+int DetectorMPGD::getEtaIdx(float fInputPos_Y){
+    float fEtaLim_Low, fEtaLim_High;
+    
+    for (auto iterEta = map_sectorsEta.begin(); iterEta != map_sectorsEta.end(); ++iterEta) { //Loop Over iEta Sectors
+        //Setup Evaluation Limits
+        fEtaLim_Low = (*iterEta).second.fPos_Y - fabs(0.1 * (*iterEta).second.fPos_Y);
+        fEtaLim_High = (*iterEta).second.fPos_Y + fabs(0.1 * (*iterEta).second.fPos_Y);
+        
+        if ( fEtaLim_Low < fInputPos_Y && fInputPos_Y < fEtaLim_High ) return (*iterEta).first;
+    } //End Loop Over iEta Sectors
+    
+    return -1;
+} //End DetectorMPGD::getEtaIdx()
+
 //Returns the width of an iEta sector
 float DetectorMPGD::getEtaWidth(int iEta){
     if (map_sectorsEta.count(iEta)) { //Case: iEta Value Exists, return width
@@ -254,6 +270,22 @@ ReadoutSectorPhi DetectorMPGD::getPhiSector(int iEta, int iPhi){
     return retSector;
 } //End getPhiSector
 
+//Returns the strip number of an input X position in sector iEta; -1 if no match
+//Strips are assumed to be uniformly distributed over the width of each iPhi sector
+int DetectorMPGD::getStripNum(int iEta, float fInputPos_X){
+    auto iterEta = map_sectorsEta.find(iEta);
+    
+    if (iterEta == map_sectorsEta.end() ) return -1;
+    
+    for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); ++iterPhi) { //Loop Over map_sectorsPhi
+        if ( (*iterPhi).second.fPos_Xlow <= fInputPos_X && fInputPos_X < (*iterPhi).second.fPos_Xhigh ) { //Case: Matching Phi Sector Found!
+            return (*iterPhi).second.iStripNum_Min + (int)( ( (*iterPhi).second.iStripNum_Max - (*iterPhi).second.iStripNum_Min ) * (fInputPos_X - (*iterPhi).second.fPos_Xlow) / ( (*iterPhi).second.fPos_Xhigh - (*iterPhi).second.fPos_Xlow ) );
+        } //End Case: Matching Phi Sector Found!
+    } //End Loop Over map_sectorsPhi
+    
+    return -1;
+} //End DetectorMPGD::getStripNum()
+
 //Sets a cluster
 void DetectorMPGD::setCluster(int iNum_Evt, Cluster &inputCluster){
     //Check if the DetectorMPGD is initialized!
@@ -0,0 +1,346 @@
+//
+//  EventIndex.cpp
+//  
+//
+//
+//
+
+#include "EventIndex.h"
+
+//C++ Includes
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <sys/stat.h>
+
+//Framework Includes
+#include "ClusterCache.h"
+
+using std::cout;
+using std::endl;
+using std::map;
+using std::string;
+using std::vector;
+
+using namespace QualityControl::Uniformity;
+
+namespace {
+    //Multiplicity of one plane in one event, collected while the trees are read
+    struct PlaneCount{
+        int iEvt;
+        float fPlaneID;
+        int iNClusters;
+        int iNHits;
+    };
+
+    //Saturates at the largest value the index can store
+    uint16_t clampCount(int iCount){ return (uint16_t) std::min(iCount, 65535); }
+
+    //Largest value of the multiplicity branch strBranchName over the tree (at least 1), only that branch is read
+    int getMaxMultiplicity(TTree * inputTree, const char * strBranchName, Int_t & iMulti){
+        int iMulti_Max = 1;
+
+        TBranch * branch_Multi = inputTree->GetBranch(strBranchName);
+
+        if ( branch_Multi == nullptr ) return iMulti_Max;
+
+        inputTree->SetBranchStatus("*",0);
+        inputTree->SetBranchStatus(strBranchName,1);
+        inputTree->SetBranchAddress(strBranchName, &iMulti);
+
+        for (Long64_t i=0; i < inputTree->GetEntries(); ++i) {
+            branch_Multi->GetEntry(i);
+
+            iMulti_Max = std::max(iMulti_Max, (int)iMulti);
+        }
+
+        return iMulti_Max;
+    }
+} //End anonymous namespace
+
+//Default Constructor
+EventIndex::EventIndex(){
+    uiFlags = 0;
+} //End Default Constructor
+
+//Builds the index from the TCluster and/or THit trees of file_InputRootFile
+bool EventIndex::build(TFile * file_InputRootFile){
+    //Variable Declaration
+    Int_t iMulti = 0;
+
+    vector<Float_t> vec_fClustADC, vec_fPlaneID_Branch;  //Branch buffers; the plane table is the member vec_fPlaneID
+
+    Long64_t iNEvt_Clust = 0, iNEvt_Hit = 0;
+
+    map<float, int> map_PlaneCount;  //planeID -> count, for the current event
+    map<float, int> map_PlaneIdx;    //planeID -> index in vec_fPlaneID
+
+    vector<PlaneCount> vec_Counts;
+
+    TTree *tree_Clusters = NULL, *tree_Hits = NULL;
+
+    clear();
+
+    if ( file_InputRootFile == nullptr || !file_InputRootFile->IsOpen() || file_InputRootFile->IsZombie() ) return false;
+
+    tree_Clusters   = (TTree*) file_InputRootFile->Get("TCluster");
+    tree_Hits       = (TTree*) file_InputRootFile->Get("THit");
+
+    if ( tree_Clusters == nullptr && tree_Hits == nullptr ) return false;
+
+    if ( tree_Clusters != nullptr ) { uiFlags |= uiEventIndex_HasClusters; iNEvt_Clust = tree_Clusters->GetEntries(); }
+    if ( tree_Hits != nullptr ) { uiFlags |= uiEventIndex_HasHits; iNEvt_Hit = tree_Hits->GetEntries(); }
+
+    cout<<"QualityControl::Uniformity::EventIndex::build() - Indexing " << file_InputRootFile->GetName() << endl;
+
+    vec_Records.resize( std::max(iNEvt_Clust, iNEvt_Hit) );
+    memset(vec_Records.data(), 0, vec_Records.size() * sizeof(EventIndexRecord) );
+
+    //Clusters; only the multiplicity, planeID & ADC branches are read
+    //------------------------------------------------------
+    if ( tree_Clusters != nullptr ) { //Case: Cluster Tree Present
+        //The caller may already have set its branch addresses (e.g. SelectorCluster), they are put back at the end of this block
+        TreeBranchState stateCaller(tree_Clusters);
+
+        //Buffers sized from the largest multiplicity of the tree
+        int iMulti_Max = getMaxMultiplicity(tree_Clusters, "nclust", iMulti);
+        vec_fPlaneID_Branch.resize(iMulti_Max);
+        vec_fClustADC.resize(iMulti_Max);
+
+        tree_Clusters->SetBranchStatus("planeID",1);
+        tree_Clusters->SetBranchStatus("clustADCs",1);
+
+        tree_Clusters->SetBranchAddress("planeID", vec_fPlaneID_Branch.data());
+        tree_Clusters->SetBranchAddress("clustADCs", vec_fClustADC.data());
+
+        for (Long64_t i=0; i < iNEvt_Clust; ++i) { //Loop Over Events
+            tree_Clusters->GetEntry(i);
+
+            if ( iMulti < 0 ) iMulti = 0;
+
+            EventIndexRecord & record = vec_Records[i];
+
+            record.iNClusters = iMulti;
+
+            map_PlaneCount.clear();
+            for (int j=0; j < iMulti; ++j) { //Loop Over Clusters
+                record.fClustADC_Sum += vec_fClustADC[j];
+                record.fClustADC_Max = std::max(record.fClustADC_Max, vec_fClustADC[j]);
+
+                ++map_PlaneCount[vec_fPlaneID_Branch[j]];
+            } //End Loop Over Clusters
+
+            for (auto iterPlane = map_PlaneCount.begin(); iterPlane != map_PlaneCount.end(); ++iterPlane) {
+                vec_Counts.push_back( { (int)i, (*iterPlane).first, (*iterPlane).second, 0 } );
+            }
+        } //End Loop Over Events
+    } //End Case: Cluster Tree Present
+
+    //Hits; only the multiplicity & planeID branches are read
+    //------------------------------------------------------
+    if ( tree_Hits != nullptr ) { //Case: Hit Tree Present
+        TreeBranchState stateCaller(tree_Hits);
+
+        int iMulti_Max = getMaxMultiplicity(tree_Hits, "nch", iMulti);
+        vec_fPlaneID_Branch.resize(iMulti_Max);
+
+        tree_Hits->SetBranchStatus("planeID",1);
+
+        tree_Hits->SetBranchAddress("planeID", vec_fPlaneID_Branch.data());
+
+        for (Long64_t i=0; i < iNEvt_Hit; ++i) { //Loop Over Events
+            tree_Hits->GetEntry(i);
+
+            if ( iMulti < 0 ) iMulti = 0;
+
+            vec_Records[i].iNHits = iMulti;
+
+            map_PlaneCount.clear();
+            for (int j=0; j < iMulti; ++j) { ++map_PlaneCount[vec_fPlaneID_Branch[j]]; }
+
+            for (auto iterPlane = map_PlaneCount.begin(); iterPlane != map_PlaneCount.end(); ++iterPlane) {
+                vec_Counts.push_back( { (int)i, (*iterPlane).first, 0, (*iterPlane).second } );
+            }
+        } //End Loop Over Events
+    } //End Case: Hit Tree Present
+
+    //Assign plane indices (in increasing planeID) & fill the per plane multiplicities
+    //------------------------------------------------------
+    for (auto iterCount = vec_Counts.begin(); iterCount != vec_Counts.end(); ++iterCount) { map_PlaneIdx[(*iterCount).fPlaneID] = 0; }
+
+    for (auto iterPlane = map_PlaneIdx.begin(); iterPlane != map_PlaneIdx.end(); ++iterPlane) {
+        (*iterPlane).second = vec_fPlaneID.size();
+        vec_fPlaneID.push_back( (*iterPlane).first );
+    }
+
+    vec_usPlaneClusters.assign( vec_Records.size() * vec_fPlaneID.size(), 0 );
+    vec_usPlaneHits.assign( vec_Records.size() * vec_fPlaneID.size(), 0 );
+
+    for (auto iterCount = vec_Counts.begin(); iterCount != vec_Counts.end(); ++iterCount) { //Loop Over Plane Counts
+        size_t iPos = (size_t)(*iterCount).iEvt * vec_fPlaneID.size() + map_PlaneIdx[(*iterCount).fPlaneID];
+
+        if ( (*iterCount).iNClusters > 0 ) { vec_usPlaneClusters[iPos] = clampCount( (*iterCount).iNClusters ); }
+        if ( (*iterCount).iNHits > 0 ) { vec_usPlaneHits[iPos] = clampCount( (*iterCount).iNHits ); }
+    } //End Loop Over Plane Counts
+
+    return true;
+} //End EventIndex::build()
+
+//Clears the index
+void EventIndex::clear(){
+    uiFlags = 0;
+
+    vec_fPlaneID.clear();
+    vec_usPlaneClusters.clear();
+    vec_usPlaneHits.clear();
+    vec_Records.clear();
+
+    return;
+} //End EventIndex::clear()
+
+//Returns the index of the plane whose planeID is fPlaneID; -1 if there is no such plane
+int EventIndex::getPlaneIdx(float fPlaneID) const{
+    auto iterPlane = std::lower_bound(vec_fPlaneID.begin(), vec_fPlaneID.end(), fPlaneID);
+
+    if ( iterPlane == vec_fPlaneID.end() || (*iterPlane) != fPlaneID ) return -1;
+
+    return (int) std::distance(vec_fPlaneID.begin(), iterPlane);
+} //End EventIndex::getPlaneIdx()
+
+//Reads strInputFileName
+bool EventIndex::read(std::string strInputFileName){
+    //Variable Declaration
+    bool bReadSuccess = true;
+
+    size_t iNEvt, iNPlanes;
+
+    EventIndexHeader header;
+
+    FILE * file_Input = NULL;
+
+    struct stat statFile;
+
+    clear();
+
+    file_Input = fopen( strInputFileName.c_str(), "rb");
+
+    if ( file_Input == NULL ) return false;
+
+    if ( fread(&header, sizeof(header), 1, file_Input) != 1
+        || memcmp(header.cMagic, strEventIndex_Magic, sizeof(strEventIndex_Magic) ) != 0
+        || header.uiVersion != uiEventIndex_Version
+        || header.uiRecordSize != sizeof(EventIndexRecord) ) { //Case: Not a Valid Event Index
+        cout<<"EventIndex::read() - " << strInputFileName << " is not a valid event index (version " << uiEventIndex_Version << ")\n";
+        fclose(file_Input);
+
+        return false;
+    } //End Case: Not a Valid Event Index
+
+    iNEvt       = header.ulNEvents;
+    iNPlanes    = header.uiNPlanes;
+
+    //The size must be exactly the one the header describes; anything else (e.g. a file written with a wrong plane count) is rebuilt
+    if ( fstat(fileno(file_Input), &statFile) != 0
+        || (uint64_t)statFile.st_size != sizeof(header) + iNPlanes * sizeof(float) + iNEvt * sizeof(EventIndexRecord) + 2 * iNEvt * iNPlanes * sizeof(uint16_t) ) { //Case: Size Mismatch
+        cout<<"EventIndex::read() - " << strInputFileName << " size does not match its header, ignored\n";
+        fclose(file_Input);
+
+        return false;
+    } //End Case: Size Mismatch
+
+    vec_fPlaneID.resize(iNPlanes);
+    vec_Records.resize(iNEvt);
+    vec_usPlaneClusters.resize(iNEvt * iNPlanes);
+    vec_usPlaneHits.resize(iNEvt * iNPlanes);
+
+    bReadSuccess = bReadSuccess && ( fread(vec_fPlaneID.data(), sizeof(float), iNPlanes, file_Input) == iNPlanes );
+    bReadSuccess = bReadSuccess && ( fread(vec_Records.data(), sizeof(EventIndexRecord), iNEvt, file_Input) == iNEvt );
+    bReadSuccess = bReadSuccess && ( fread(vec_usPlaneClusters.data(), sizeof(uint16_t), iNEvt * iNPlanes, file_Input) == iNEvt * iNPlanes );
+    bReadSuccess = bReadSuccess && ( fread(vec_usPlaneHits.data(), sizeof(uint16_t), iNEvt * iNPlanes, file_Input) == iNEvt * iNPlanes );
+
+    fclose(file_Input);
+
+    if ( !bReadSuccess ) {
+        cout<<"EventIndex::read() - " << strInputFileName << " is truncated\n";
+        clear();
+
+        return false;
+    }
+
+    uiFlags = header.uiFlags;
+
+    return true;
+} //End EventIndex::read()
+
+//Writes the index to strOutputFileName
+bool EventIndex::write(std::string strOutputFileName){
+    //Variable Declaration
+    bool bWriteSuccess = true;
+
+    EventIndexHeader header;
+
+    FILE * file_Output = NULL;
+
+    //The file is written under a temporary name so an interrupted job never leaves a truncated index behind
+    file_Output = fopen( ( strOutputFileName + ".part" ).c_str(), "wb");
+
+    if ( file_Output == NULL ) {
+        perror( ("EventIndex::write() - error while opening file: " + strOutputFileName ).c_str() );
+
+        return false;
+    }
+
+    memcpy(header.cMagic, strEventIndex_Magic, sizeof(header.cMagic) );
+    header.uiVersion    = uiEventIndex_Version;
+    header.uiFlags      = uiFlags;
+    header.ulNEvents    = vec_Records.size();
+    header.uiNPlanes    = vec_fPlaneID.size();
+    header.uiRecordSize = sizeof(EventIndexRecord);
+
+    bWriteSuccess = bWriteSuccess && ( fwrite(&header, sizeof(header), 1, file_Output) == 1 );
+    bWriteSuccess = bWriteSuccess && ( fwrite(vec_fPlaneID.data(), sizeof(float), vec_fPlaneID.size(), file_Output) == vec_fPlaneID.size() );
+    bWriteSuccess = bWriteSuccess && ( fwrite(vec_Records.data(), sizeof(EventIndexRecord), vec_Records.size(), file_Output) == vec_Records.size() );
+    bWriteSuccess = bWriteSuccess && ( fwrite(vec_usPlaneClusters.data(), sizeof(uint16_t), vec_usPlaneClusters.size(), file_Output) == vec_usPlaneClusters.size() );
+    bWriteSuccess = bWriteSuccess && ( fwrite(vec_usPlaneHits.data(), sizeof(uint16_t), vec_usPlaneHits.size(), file_Output) == vec_usPlaneHits.size() );
+    bWriteSuccess = ( fclose(file_Output) == 0 ) && bWriteSuccess;
+
+    if ( bWriteSuccess ) {
+        std::rename( ( strOutputFileName + ".part" ).c_str(), strOutputFileName.c_str() );
+    }
+    else{
+        perror( ("EventIndex::write() - error while writing file: " + strOutputFileName ).c_str() );
+        std::remove( ( strOutputFileName + ".part" ).c_str() );
+    }
+
+    return bWriteSuccess;
+} //End EventIndex::write()
+
+//Returns the name of the event index belonging to strInputRootFileName
+std::string QualityControl::Uniformity::getEventIndexName(std::string strInputRootFileName){
+    if ( strInputRootFileName.rfind(".root") != string::npos ) {
+        strInputRootFileName.erase( strInputRootFileName.rfind(".root") );
+    }
+
+    return strInputRootFileName + strEventIndex_Ext;
+} //End QualityControl::Uniformity::getEventIndexName()
+
+//Loads the event index belonging to file_InputRootFile into inputIndex, (re)building it if needed
+bool QualityControl::Uniformity::loadEventIndex(TFile * file_InputRootFile, EventIndex & inputIndex, bool bNeedClusters, bool bNeedHits){
+    //Variable Declaration
+    string strFileName  = file_InputRootFile->GetName();
+    string strIndexName = getEventIndexName( strFileName );
+
+    //Same staleness rule as the cluster cache: the sidecar must not be older than the ROOT file
+    if ( isClusterCacheCurrent(strIndexName, strFileName) && inputIndex.read(strIndexName) ) { //Case: Index on Disk
+        if ( ( !bNeedClusters || inputIndex.hasClusters() ) && ( !bNeedHits || inputIndex.hasHits() ) ) return true;
+    } //End Case: Index on Disk
+
+    if ( !inputIndex.build(file_InputRootFile) ) return false;
+
+    //Failing to write the index only costs a rebuild next time
+    inputIndex.write(strIndexName);
+
+    return ( ( !bNeedClusters || inputIndex.hasClusters() ) && ( !bNeedHits || inputIndex.hasHits() ) );
+} //End QualityControl::Uniformity::loadEventIndex()
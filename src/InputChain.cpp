@@ -0,0 +1,190 @@
+//
+//  InputChain.cpp
+//  
+//
+//
+//
+
+#include "InputChain.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+using namespace QualityControl::Timing;
+using namespace QualityControl::Uniformity;
+
+//Default Constructor
+InputChain::InputChain(){
+    iNThreads = 1;
+    llCacheSize = 30000000;
+} //End Default Constructor
+
+//Set the input files at construction
+InputChain::InputChain(std::vector<std::string> vec_strInputFiles){
+    iNThreads = 1;
+    llCacheSize = 30000000;
+
+    vec_strFiles = vec_strInputFiles;
+} //End Constructor
+
+//Forgets the files & the entries found by open()
+void InputChain::close(){
+    map_llEntries.clear();
+
+    return;
+} //End InputChain::close()
+
+//Visits all input files, in parallel if iNThreads > 1, and records the entries of each tree in vec_strTreeNames
+bool InputChain::open(std::vector<std::string> vec_strTreeNames){
+    //Variable Declaration
+    bool bFoundFile = false;
+
+    int iNThreadsUsed = iNThreads;
+
+    vector<std::thread> vec_threads;
+
+    map_llEntries.clear();
+
+    if ( vec_strFiles.size() == 0 ) return false;
+
+    //Entries are -1 until found; each thread only writes the entries of its own files
+    for (int i=0; i < vec_strTreeNames.size(); ++i) {
+        map_llEntries[vec_strTreeNames[i]].assign(vec_strFiles.size(), -1);
+    }
+
+    //Never start more threads than files
+    if ( iNThreadsUsed > (int)vec_strFiles.size() ) { iNThreadsUsed = vec_strFiles.size(); }
+
+    if ( iNThreadsUsed <= 1 ) { //Case: Serial Opening
+        for (int i=0; i < vec_strFiles.size(); ++i) {
+            openFile(i, vec_strTreeNames);
+        }
+    } //End Case: Serial Opening
+    else{ //Case: Parallel Opening, files are dealt round-robin to the threads
+        ROOT::EnableThreadSafety();
+
+        for (int iThread=0; iThread < iNThreadsUsed; ++iThread) { //Loop Over Threads
+            vec_threads.push_back( std::thread( [this, iThread, iNThreadsUsed, &vec_strTreeNames](){
+                for (int i=iThread; i < vec_strFiles.size(); i+=iNThreadsUsed) {
+                    openFile(i, vec_strTreeNames);
+                }
+            } ) );
+        } //End Loop Over Threads
+
+        for (int iThread=0; iThread < vec_threads.size(); ++iThread) {
+            vec_threads[iThread].join();
+        }
+    } //End Case: Parallel Opening
+
+    //Did we find anything?
+    for (auto iterTree = map_llEntries.begin(); iterTree != map_llEntries.end(); ++iterTree) { //Loop Over Trees
+        for (int i=0; i < (*iterTree).second.size(); ++i) {
+            if ( (*iterTree).second[i] >= 0 ) { bFoundFile = true; }
+        }
+    } //End Loop Over Trees
+
+    if ( !bFoundFile ) {
+        printClassMethodMsg("InputChain","open","no input file could be opened");
+    }
+
+    return bFoundFile;
+} //End InputChain::open()
+
+//Asks the kernel to read ahead file iFile & records the entries of each requested tree
+void InputChain::openFile(int iFile, std::vector<std::string> & vec_strTreeNames){
+    //Variable Declaration
+    int iFileDesc;
+
+    TFile *file_Input = NULL;
+
+    TTree *tree_Input = NULL;
+
+    //Read ahead; the chain reaches this file later
+#ifdef POSIX_FADV_WILLNEED
+    iFileDesc = ::open( vec_strFiles[iFile].c_str(), O_RDONLY );
+
+    if ( iFileDesc >= 0 ) {
+        posix_fadvise(iFileDesc, 0, 0, POSIX_FADV_WILLNEED);
+        ::close(iFileDesc);
+    }
+#endif
+
+    //Record the entries of each tree
+    file_Input = TFile::Open( vec_strFiles[iFile].c_str(), "READ" );
+
+    if ( file_Input == nullptr || !file_Input->IsOpen() || file_Input->IsZombie() ) { //Case: failed to load ROOT file
+        perror( ("Uniformity::InputChain::openFile() - error while opening file: " + vec_strFiles[iFile] ).c_str() );
+        if ( file_Input != nullptr ) { Timing::printROOTFileStatus(file_Input); delete file_Input; }
+        std::cout << "Skipping!!!\n";
+
+        return;
+    } //End Case: failed to load ROOT file
+
+    for (int i=0; i < vec_strTreeNames.size(); ++i) { //Loop Over Requested Trees
+        tree_Input = (TTree*) file_Input->Get( vec_strTreeNames[i].c_str() );
+
+        if ( nullptr == tree_Input ) continue;
+
+        //Called from the worker threads; at() only looks up the vectors open() created
+        map_llEntries.at(vec_strTreeNames[i])[iFile] = tree_Input->GetEntries();
+    } //End Loop Over Requested Trees
+
+    file_Input->Close();
+    delete file_Input;
+
+    return;
+} //End InputChain::openFile()
+
+//Returns a TChain of the tree strTreeName over all input files
+TChain * InputChain::getChain(std::string strTreeName){
+    //Variable Declaration
+    int iNFilesAdded = 0;
+
+    TChain *chain_Ret = NULL;
+
+    if ( map_llEntries.count(strTreeName) == 0 ) { //Case: Tree Not Requested in open()
+        printClassMethodMsg("InputChain","getChain",("tree " + strTreeName + " was not requested in open(); Exiting!!!").c_str() );
+
+        return chain_Ret;
+    } //End Case: Tree Not Requested in open()
+
+    chain_Ret = new TChain( strTreeName.c_str() );
+
+    for (int i=0; i < vec_strFiles.size(); ++i) { //Loop Over Input Files
+        //File missing, or it lacks the tree; nothing to chain
+        if ( map_llEntries[strTreeName][i] < 0 ) continue;
+
+        //Giving the entries avoids the chain opening the file here
+        chain_Ret->Add( vec_strFiles[i].c_str(), map_llEntries[strTreeName][i] );
+
+        ++iNFilesAdded;
+    } //End Loop Over Input Files
+
+    if ( iNFilesAdded == 0 ) { //Case: No File Has the Tree
+        printClassMethodMsg("InputChain","getChain",("no input file has tree " + strTreeName + "; Exiting!!!").c_str() );
+
+        delete chain_Ret;
+
+        return NULL;
+    } //End Case: No File Has the Tree
+
+    chain_Ret->SetCacheSize(llCacheSize);
+
+    return chain_Ret;
+} //End InputChain::getChain()
+
+//Returns the total number of entries of strTreeName over all input files
+long long InputChain::getNumEntries(std::string strTreeName){
+    //Variable Declaration
+    long long llRetEntries = 0;
+
+    if ( map_llEntries.count(strTreeName) == 0 ) return 0;
+
+    for (int i=0; i < map_llEntries[strTreeName].size(); ++i) {
+        if ( map_llEntries[strTreeName][i] > 0 ) { llRetEntries += map_llEntries[strTreeName][i]; }
+    }
+
+    return llRetEntries;
+} //End InputChain::getNumEntries()
@@ -13,21 +13,47 @@ using namespace QualityControl::Uniformity;
 //Sets the analysis setup in all classes
 void Interface::initialize(AnalysisSetupUniformity inputAnaSetup, RunSetup inputRunSetup){
     
+    //Variable Declaration
+    FitSeedStore seedsFit;
+    
+    StripMask maskStrips;
+    
     aSetup = inputAnaSetup;
     rSetup = inputRunSetup;
     
+    //Load the strip mask (if any)
+    if ( aSetup.strFile_StripMask.length() > 0 ) { //Case: Strip Mask Requested
+        maskStrips = loadStripMask(aSetup.strFile_StripMask);
+        
+        printClassMethodMsg("Interface","initialize",( "Masking " + QualityControl::Timing::getString( maskStrips.getNumMasked() ) + " strips from " + aSetup.strFile_StripMask ).c_str() );
+    } //End Case: Strip Mask Requested
+    
     //Initialize Hit Related Items
     if (rSetup.bAnaStep_Hits) {
         hitSelector.setAnalysisParameters(aSetup);
+        hitSelector.setStripMask(maskStrips);
         
         hitAnalyzer.setAnalysisParameters(aSetup);
+        
+        stripHealth.setAnalysisParameters(aSetup);
+        stripHealth.setStripMask(maskStrips);
     } //End Case: Hits Desired
     
     //Initialize Cluster Related Items
     if (rSetup.bAnaStep_Clusters) {
         clustSelector.setAnalysisParameters(aSetup);
+        clustSelector.setStripMask(maskStrips);
         
         clustAnalyzer.setAnalysisParameters(aSetup);
+        
+        //Load the fit seeds (if any)
+        if ( aSetup.strFile_FitSeed.length() > 0 ) { //Case: Fit Seeds Requested
+            seedsFit = loadFitSeeds(aSetup.strFile_FitSeed);
+            
+            printClassMethodMsg("Interface","initialize",( "Loaded " + QualityControl::Timing::getString( (int)seedsFit.map_seeds.size() ) + " slice fit seeds from " + aSetup.strFile_FitSeed ).c_str() );
+            
+            clustAnalyzer.setFitSeeds(seedsFit);
+        } //End Case: Fit Seeds Requested
     }
     
     return;
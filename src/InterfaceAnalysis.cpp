@@ -19,6 +19,10 @@ using namespace QualityControl::Uniformity;
 InterfaceAnalysis::InterfaceAnalysis(){
     //bInitialized = false;
     bVerboseMode = false;
+    
+    bRunHistory = true;
+    
+    iNRunHistory = 0;
 } //End Default Constructor
 
 //Performs the analysis on the detMPGD object defined by rSetup and aSetup on the input files stored in vec_pairedRunList
@@ -44,11 +48,16 @@ void InterfaceAnalysis::analyzeInputAmoreSRS(){
     TH1::AddDirectory(kFALSE);
     
     //Variable Declaration
+    bool bChained;  //true -> this run is spread over several files
+    
+    InputChain chainInput;
     
     ReadoutSectorEta etaSector;
     
     string strTempRunName;
     
+    TChain *chain_Clusters, *chain_Hits;
+    
     TFile *file_ROOTInput, *file_ROOTOutput_All, *file_ROOTOutput_Single;
     
     //Debugging
@@ -93,23 +102,52 @@ void InterfaceAnalysis::analyzeInputAmoreSRS(){
     //Debugging
     //cout<<"InterfaceAnalysis::analyzeInputAmoreSRS(): detMPGD.getName() = " << detMPGD.getName() << endl;
     
+    //Memory budget: start with everything kept
+    bRunHistory = true;
+    iNRunHistory = 0;
+    
     //Loop over input files
     //------------------------------------------------------
     for (int i=0; i < vec_pairedRunList.size(); ++i) { //Loop over vec_pairedRunList
         //Wipe physics objects from previous file (prevent double counting)
         detMPGD.resetPhysObj();
         
-        //Open this run's root file & check to see if data file opened successfully
+        //Open this run's root file(s) & check to see if data file opened successfully
         //------------------------------------------------------
-        file_ROOTInput = new TFile(vec_pairedRunList[i].second.c_str(),"READ","",1);
+        bChained = ( vec_pairedRunList[i].second.find(",") != string::npos );
         
-        if ( !file_ROOTInput->IsOpen() || file_ROOTInput->IsZombie() ) { //Case: failed to load ROOT file
-            perror( ("InterfaceAnalysis::analyzeInputAmoreSRS() - error while opening file: " + vec_pairedRunList[i].second ).c_str() );
-            Timing::printROOTFileStatus(file_ROOTInput);
-            std::cout << "Skipping!!!\n";
+        file_ROOTInput = NULL;
+        chain_Clusters = chain_Hits = NULL;
+        
+        if ( bChained ) { //Case: Run spread over several files, read them as one chain
+            chainInput.setInputFiles( Timing::getCharSeparatedList(vec_pairedRunList[i].second, ',') );
+            chainInput.setNThreads(rSetup.iInputChain_NThreads);
             
-            continue;
-        } //End Case: failed to load ROOT file
+            if ( !chainInput.open( {"TCluster", "THit"} ) ) { //Case: failed to load any file
+                perror( ("InterfaceAnalysis::analyzeInputAmoreSRS() - error while opening files: " + vec_pairedRunList[i].second ).c_str() );
+                std::cout << "Skipping!!!\n";
+                
+                continue;
+            } //End Case: failed to load any file
+            
+            if ( rSetup.bAnaStep_Clusters ) { chain_Clusters = chainInput.getChain("TCluster"); }
+            if ( rSetup.bAnaStep_Hits ) { chain_Hits = chainInput.getChain("THit"); }
+            
+            if (bVerboseMode) {
+                cout<<"Run " << vec_pairedRunList[i].first << " chained over " << chainInput.getNumFiles() << " files" << endl;
+            }
+        } //End Case: Run spread over several files, read them as one chain
+        else{ //Case: Single File
+            file_ROOTInput = new TFile(vec_pairedRunList[i].second.c_str(),"READ","",1);
+            
+            if ( !file_ROOTInput->IsOpen() || file_ROOTInput->IsZombie() ) { //Case: failed to load ROOT file
+                perror( ("InterfaceAnalysis::analyzeInputAmoreSRS() - error while opening file: " + vec_pairedRunList[i].second ).c_str() );
+                Timing::printROOTFileStatus(file_ROOTInput);
+                std::cout << "Skipping!!!\n";
+                
+                continue;
+            } //End Case: failed to load ROOT file
+        } //End Case: Single File
         
         //Debugging
         //cout<<"InterfaceAnalysis::analyzeInputAmoreSRS(): Pre Hit Ana detMPGD.getName() = " << detMPGD.getName() << endl;
@@ -118,35 +156,39 @@ void InterfaceAnalysis::analyzeInputAmoreSRS(){
         //------------------------------------------------------
         //Force the hit analysis if the user requested cluster reconstruction
         if ( rSetup.bAnaStep_Hits ) { //Case: Hit Analysis
-            //Hit Selection
-            hitSelector.setRunNum(vec_pairedRunList[i].first);
-            hitSelector.setHits(file_ROOTInput, detMPGD, aSetup);
-            
-            if (bVerboseMode) { //Print Number of Selected Hits to User
-                cout<<vec_pairedRunList[i].second << " has " << detMPGD.getHits().size() << " hits passing selection" << endl;
-            } //End Print Number of Selected Hits to User
-            
             //Load the required input parameters
             if (i == 0) { hitAnalyzer.setAnalysisParameters(aSetup); } //Fixed for all runs
             
             if (i == 0 || rSetup.bMultiOutput) { hitAnalyzer.initHistosHits(detMPGD); }
             
-            //Hit Analysis
+            hitSelector.setRunNum(vec_pairedRunList[i].first);
             hitAnalyzer.setRunNum(vec_pairedRunList[i].first);
-            hitAnalyzer.fillHistos(detMPGD);
+            
+            if ( rSetup.iAna_NThreads > 1 ) { //Case: Hit Selection & Analysis Split Over Threads
+                fillHistosParallel(false, vec_pairedRunList[i].second, chainInput, bChained);
+            } //End Case: Hit Selection & Analysis Split Over Threads
+            else{ //Case: Hit Selection & Analysis in Series
+                //Hit Selection
+                if ( bChained ) { //Case: Chained Input
+                    if ( chain_Hits != nullptr ) { hitSelector.setHits(chain_Hits, detMPGD, aSetup); }
+                } //End Case: Chained Input
+                else{ hitSelector.setHits(file_ROOTInput, detMPGD, aSetup); }
+                
+                //Hit Analysis
+                hitAnalyzer.fillHistos(detMPGD);
+            } //End Case: Hit Selection & Analysis in Series
+            
+            if (bVerboseMode) { //Print Number of Selected Hits to User
+                cout<<vec_pairedRunList[i].second << " has " << detMPGD.getHits().size() << " hits passing selection" << endl;
+            } //End Print Number of Selected Hits to User
+            
+            //Strip Health; parameters & input strip mask set in initialize()
+            stripHealth.accumulateRun(detMPGD);
         } //End Case: Hit Analysis
         
         //Cluster Analysis
         //------------------------------------------------------
         if ( rSetup.bAnaStep_Clusters ) { //Case: Cluster Analysis
-            //Cluster Selection
-            clustSelector.setRunNum(vec_pairedRunList[i].first);
-            clustSelector.setClusters(file_ROOTInput, detMPGD, aSetup);
-            
-            if (bVerboseMode) { //Print Number of Selected Clusters to User
-                cout<<vec_pairedRunList[i].second << " has " << detMPGD.getClusters().size() << " clusters passing selection" << endl;
-            } //End Print Number of Selected Clusters to User
-            
             //Load the required input parameters
             if (i == 0) { clustAnalyzer.setAnalysisParameters(aSetup); } //Fixed for all runs
             
@@ -156,19 +198,44 @@ void InterfaceAnalysis::analyzeInputAmoreSRS(){
                 clustAnalyzer.initHistosClusters(detMPGD);
             }
             
-            //Initialize the cluster histograms specific to this run
-            clustAnalyzer.initHistosClustersByRun(vec_pairedRunList[i].first, detMPGD);
+            //Initialize the cluster histograms specific to this run (unless not requested or dropped to stay within the memory budget)
+            //The fixed size run history summaries are always filled
+            if (bRunHistory && aSetup.bRunHistory_Full) {
+                clustAnalyzer.initHistosClustersByRun(vec_pairedRunList[i].first, detMPGD);
+                ++iNRunHistory;
+            }
             
-            //Cluster Analysis
+            clustSelector.setRunNum(vec_pairedRunList[i].first);
             clustAnalyzer.setRunNum(vec_pairedRunList[i].first);
-            clustAnalyzer.fillHistos(detMPGD);
+            
+            if ( rSetup.iAna_NThreads > 1 ) { //Case: Cluster Selection & Analysis Split Over Threads
+                fillHistosParallel(true, vec_pairedRunList[i].second, chainInput, bChained);
+            } //End Case: Cluster Selection & Analysis Split Over Threads
+            else{ //Case: Cluster Selection & Analysis in Series
+                //Cluster Selection
+                if ( bChained ) { //Case: Chained Input
+                    if ( chain_Clusters != nullptr ) { clustSelector.setClusters(chain_Clusters, detMPGD, aSetup); }
+                } //End Case: Chained Input
+                else{ clustSelector.setClusters(file_ROOTInput, detMPGD, aSetup); }
+                
+                //Cluster Analysis
+                clustAnalyzer.fillHistos(detMPGD);
+            } //End Case: Cluster Selection & Analysis in Series
+            
+            if (bVerboseMode) { //Print Number of Selected Clusters to User
+                cout<<vec_pairedRunList[i].second << " has " << detMPGD.getClusters().size() << " clusters passing selection" << endl;
+            } //End Print Number of Selected Clusters to User
         } //End Case: Cluster Analysis
         
+        //Memory accounting & budget
+        //------------------------------------------------------
+        checkMemory(i);
+        
         //User requests multiple output files?
         //------------------------------------------------------
         if (rSetup.bMultiOutput) { //Case: User wants one output file per input file
-            //Setup the name of the output file
-            strTempRunName = vec_pairedRunList[i].second;
+            //Setup the name of the output file; chained runs are named after their first file
+            strTempRunName = vec_pairedRunList[i].second.substr(0, vec_pairedRunList[i].second.find(",") );
             
             if ( strTempRunName.find("dataTree.root") != string::npos ){
                 strTempRunName.erase(strTempRunName.find("dataTree.root"), strTempRunName.length() - strTempRunName.find("dataTree.root") );
@@ -189,9 +256,8 @@ void InterfaceAnalysis::analyzeInputAmoreSRS(){
                 Timing::printROOTFileStatus(file_ROOTOutput_Single);
                 std::cout << "Skipping!!!\n";
                 
-                //Close the file & delete pointer before the next iter
-                file_ROOTInput->Close();
-                delete file_ROOTInput;
+                //Close the file(s) & delete pointer before the next iter
+                closeInputAmoreSRS(file_ROOTInput, chain_Clusters, chain_Hits);
                 
                 //Move to next iteration
                 continue;
@@ -205,10 +271,9 @@ void InterfaceAnalysis::analyzeInputAmoreSRS(){
             delete file_ROOTOutput_Single;
         } //End Case: User wants one output file per input file
         
-        //Close the file & delete pointer before the next iter
+        //Close the file(s) & delete pointer before the next iter
         //------------------------------------------------------
-        file_ROOTInput->Close();
-        delete file_ROOTInput;
+        closeInputAmoreSRS(file_ROOTInput, chain_Clusters, chain_Hits);
     } //End Loop over vec_pairedRunList
     
     //Debugging
@@ -327,6 +392,220 @@ void InterfaceAnalysis::analyzeInputFrmwrk(){
     return;
 } //End InterfaceAnalysis::analyzeInputFrmwrk()
 
+//Closes the input of one run of analyzeInputAmoreSRS(); either the TFile or the chains
+void InterfaceAnalysis::closeInputAmoreSRS(TFile * file_ROOTInput, TChain * chain_Clusters, TChain * chain_Hits){
+    if ( file_ROOTInput != nullptr ) { //Case: Single File
+        file_ROOTInput->Close();
+        delete file_ROOTInput;
+    } //End Case: Single File
+    
+    //The chains own the files they opened
+    if ( chain_Clusters != nullptr ) { delete chain_Clusters; }
+    if ( chain_Hits != nullptr ) { delete chain_Hits; }
+    
+    return;
+} //End InterfaceAnalysis::closeInputAmoreSRS()
+
+//Splits the selection & histogram filling of the hits (bClusters false) or clusters (bClusters true) of one run over rSetup.iAna_NThreads threads
+void InterfaceAnalysis::fillHistosParallel(bool bClusters, std::string strInputFile, InputChain & chainInput, bool bChained){
+    //Variable Declaration
+    int iNThreads = rSetup.iAna_NThreads;
+    int iNEntries = 0;
+    int iNEvtPerThread;
+    
+    string strTreeName = ( bClusters ? "TCluster" : "THit" );
+    
+    std::pair<int,int> pair_iEvtRange;
+    
+    std::vector<AnalyzeResponseUniformityClusters> vec_clustAnalyzer;
+    std::vector<AnalyzeResponseUniformityHits> vec_hitAnalyzer;
+    std::vector<DetectorMPGD> vec_detWorker;
+    std::vector<SelectorCluster> vec_clustSelector;
+    std::vector<SelectorHit> vec_hitSelector;
+    std::vector<TChain *> vec_chainWorker;
+    std::vector<std::thread> vec_threads;
+    
+    TFile *file_Input = NULL;
+    
+    TTree *tree_Input = NULL;
+    
+    //Determine the event range of the run; the event index & cluster cache are (re)built here, once, before the threads read them
+    //------------------------------------------------------
+    if ( bChained ) { //Case: Chained Input
+        iNEntries = chainInput.getNumEntries(strTreeName);
+    } //End Case: Chained Input
+    else{ //Case: Single File
+        file_Input = new TFile(strInputFile.c_str(),"READ","",1);
+        
+        if ( !file_Input->IsOpen() || file_Input->IsZombie() ) { //Case: failed to load ROOT file
+            perror( ("InterfaceAnalysis::fillHistosParallel() - error while opening file: " + strInputFile ).c_str() );
+            Timing::printROOTFileStatus(file_Input);
+            std::cout << "Skipping!!!\n";
+            
+            delete file_Input;
+            
+            return;
+        } //End Case: failed to load ROOT file
+        
+        tree_Input = (TTree*) file_Input->Get( strTreeName.c_str() );
+        
+        if ( nullptr != tree_Input ) { //Case: Tree Found
+            iNEntries = tree_Input->GetEntries();
+            
+            if ( aSetup.bEventIndex_Use ) { //Case: Use Event Index
+                EventIndex indexEvt;
+                
+                loadEventIndex(file_Input, indexEvt, bClusters, !bClusters);
+            } //End Case: Use Event Index
+            
+            if ( bClusters && aSetup.bClusterCache_Use ) { //Case: Use Cluster Cache
+                string strCacheName = getClusterCacheName( strInputFile );
+                
+                if ( !isClusterCacheCurrent(strCacheName, strInputFile) ) { convertClusterTree(tree_Input, strCacheName); }
+            } //End Case: Use Cluster Cache
+        } //End Case: Tree Found
+        
+        file_Input->Close();
+        delete file_Input;
+    } //End Case: Single File
+    
+    pair_iEvtRange = getEventRange( aSetup.iEvt_First, aSetup.iEvt_Total, iNEntries );
+    
+    if ( !( pair_iEvtRange.second > pair_iEvtRange.first ) ) { //Case: Nothing to Analyze
+        printClassMethodMsg("InterfaceAnalysis","fillHistosParallel",("no " + strTreeName + " entries to analyze in " + strInputFile).c_str() );
+        
+        return;
+    } //End Case: Nothing to Analyze
+    
+    //Never start more threads than events
+    if ( iNThreads > ( pair_iEvtRange.second - pair_iEvtRange.first ) ) { iNThreads = pair_iEvtRange.second - pair_iEvtRange.first; }
+    
+    iNEvtPerThread = ( pair_iEvtRange.second - pair_iEvtRange.first + iNThreads - 1 ) / iNThreads;
+    
+    //Copies for each thread; ROOT objects (histograms, chains) are created here and not in the threads
+    //------------------------------------------------------
+    vec_detWorker.reserve(iNThreads);
+    vec_clustAnalyzer.reserve(iNThreads);
+    vec_hitAnalyzer.reserve(iNThreads);
+    
+    for (int iThread=0; iThread < iNThreads; ++iThread) { //Loop Over Threads
+        vec_detWorker.push_back(detMPGD);
+        
+        if ( bClusters ) { //Case: Clusters
+            clustAnalyzer.initHistosWorker( vec_detWorker.back() );
+            
+            vec_clustAnalyzer.push_back(clustAnalyzer);
+            vec_clustSelector.push_back(clustSelector);
+        } //End Case: Clusters
+        else{ //Case: Hits
+            hitAnalyzer.initHistosWorker( vec_detWorker.back() );
+            
+            vec_hitAnalyzer.push_back(hitAnalyzer);
+            vec_hitSelector.push_back(hitSelector);
+        } //End Case: Hits
+        
+        vec_chainWorker.push_back( bChained ? chainInput.getChain(strTreeName) : NULL );
+    } //End Loop Over Threads
+    
+    //Each thread selects & fills its part of the event range
+    //------------------------------------------------------
+    ROOT::EnableThreadSafety();
+    
+    for (int iThread=0; iThread < iNThreads; ++iThread) { //Loop Over Threads
+        vec_threads.push_back( std::thread( [&, iThread](){
+            //Variable Declaration
+            AnalysisSetupUniformity aSetupWorker = aSetup;
+            
+            TFile *file_Worker = NULL;
+            
+            aSetupWorker.iEvt_First = pair_iEvtRange.first + iThread * iNEvtPerThread;
+            aSetupWorker.iEvt_Total = std::min(iNEvtPerThread, pair_iEvtRange.second - aSetupWorker.iEvt_First);
+            
+            if ( !( aSetupWorker.iEvt_Total > 0 ) ) return;
+            
+            //Each thread has its own reader
+            if ( !bChained ) { file_Worker = new TFile(strInputFile.c_str(),"READ","",1); }
+            
+            if ( bClusters ) { //Case: Clusters
+                if ( bChained ) { //Case: Chained Input
+                    if ( vec_chainWorker[iThread] != nullptr ) { vec_clustSelector[iThread].setClusters(vec_chainWorker[iThread], vec_detWorker[iThread], aSetupWorker); }
+                } //End Case: Chained Input
+                else{ vec_clustSelector[iThread].setClusters(file_Worker, vec_detWorker[iThread], aSetupWorker); }
+                
+                vec_clustAnalyzer[iThread].fillHistos( vec_detWorker[iThread] );
+            } //End Case: Clusters
+            else{ //Case: Hits
+                if ( bChained ) { //Case: Chained Input
+                    if ( vec_chainWorker[iThread] != nullptr ) { vec_hitSelector[iThread].setHits(vec_chainWorker[iThread], vec_detWorker[iThread], aSetupWorker); }
+                } //End Case: Chained Input
+                else{ vec_hitSelector[iThread].setHits(file_Worker, vec_detWorker[iThread], aSetupWorker); }
+                
+                vec_hitAnalyzer[iThread].fillHistos( vec_detWorker[iThread] );
+            } //End Case: Hits
+            
+            if ( file_Worker != nullptr ) {
+                file_Worker->Close();
+                delete file_Worker;
+            }
+        } ) );
+    } //End Loop Over Threads
+    
+    for (int iThread=0; iThread < vec_threads.size(); ++iThread) {
+        vec_threads[iThread].join();
+    }
+    
+    //Merge the copies, in thread order, before any fitting
+    //------------------------------------------------------
+    for (int iThread=0; iThread < iNThreads; ++iThread) { //Loop Over Threads
+        if ( bClusters ) { clustAnalyzer.mergeHistosWorker(detMPGD, vec_detWorker[iThread]); }
+        else{ hitAnalyzer.mergeHistosWorker(detMPGD, vec_detWorker[iThread]); }
+        
+        if ( vec_chainWorker[iThread] != nullptr ) { delete vec_chainWorker[iThread]; }
+    } //End Loop Over Threads
+    
+    return;
+} //End InterfaceAnalysis::fillHistosParallel()
+
+//Estimates the memory held by detMPGD after the iRunIdx'th input file & enforces the memory budget
+void InterfaceAnalysis::checkMemory(int iRunIdx){
+    //Variable Declaration
+    float fBudget = aSetup.fMemory_Budget * 1024. * 1024.;  //MB -> bytes
+    float fProjected;
+    
+    int iNRunsLeft = vec_pairedRunList.size() - iRunIdx - 1;
+    
+    MemoryReport memReport;
+    
+    if ( !aSetup.bMemory_Report && !(aSetup.fMemory_Budget > 0) ) return;
+    
+    memReport.accumulate(detMPGD);
+    
+    if (aSetup.bMemory_Report) {
+        cout<<"InterfaceAnalysis::checkMemory() - after " << vec_pairedRunList[iRunIdx].second << endl;
+        memReport.printReport();
+    }
+    
+    if ( !(aSetup.fMemory_Budget > 0) ) return;
+    
+    //Lazy mode: the per run histories are the only objects growing with the number of input files
+    if ( bRunHistory && iNRunHistory > 0 ) { //Case: Run Histories Booked
+        fProjected = memReport.getBytesTotal() + iNRunsLeft * ( (float) memReport.getBytes(strMemCat_RunHistory) / iNRunHistory );
+        
+        if ( fProjected > fBudget ) {
+            printClassMethodMsg("InterfaceAnalysis","checkMemory", ("Projected memory " + Timing::getString( fProjected / ( 1024. * 1024. ) ) + " MB exceeds Memory_Budget; run histories will not be booked for the remaining input files").c_str() );
+            bRunHistory = false;
+        }
+    } //End Case: Run Histories Booked
+    
+    //Nothing else is released: the clusters & hits of each input file are already reset when the next file is read,
+    //and they peak during the selection, before this check; only warn
+    if ( memReport.getBytesTotal() > fBudget ) { //Case: Over Budget
+        printClassMethodMsg("InterfaceAnalysis","checkMemory", ("Warning!!! Memory " + Timing::getString( memReport.getBytesTotal() / ( 1024. * 1024. ) ) + " MB exceeds Memory_Budget; consider Uniformity_Histos2D = 'false' or a coarser Uniformity_Granularity").c_str() );
+    } //End Case: Over Budget
+    
+    return;
+} //End InterfaceAnalysis::checkMemory()
+
 void InterfaceAnalysis::storeResults(TFile * file_Results, string strFileName){
     //Variable Declaration
     map<string,string> map_clust_ObsAndDrawOpt; //Cluster observables & draw option
@@ -361,6 +640,16 @@ void InterfaceAnalysis::storeResults(TFile * file_Results, string strFileName){
         //Store Dead Strip List
         cout<<"<<<<<<<< Making Dead Strip List >>>>>>>>\n";
         hitAnalyzer.findDeadStrips(detMPGD, strTempRunName);
+        
+        //Store Strip Health Report & Strip Mask (accumulated over all runs analyzed so far)
+        cout<<"<<<<<<<< Making Strip Health Report & Strip Mask >>>>>>>>\n";
+        if ( strTempRunName.find("_DeadStripList.txt") != string::npos ) { strTempRunName.erase( strTempRunName.find("_DeadStripList.txt") ); }
+        
+        string strFile_Report   = strTempRunName + "_StripHealth.txt";
+        string strFile_Mask     = strTempRunName + "_StripMask.txt";
+        
+        stripHealth.printHealthReport(strFile_Report);
+        stripHealth.printStripMask(strFile_Mask);
     } //End Case: Hits
     
     cout<<"<<<<<<<< Storing Cluster Histograms >>>>>>>>\n";
@@ -375,16 +664,30 @@ void InterfaceAnalysis::storeResults(TFile * file_Results, string strFileName){
             
             cout<<"<<<<<<<< Storing Cluster Fits >>>>>>>>\n";
             clustAnalyzer.storeFits(file_Results, detMPGD);
+            
+            //Store the converged fits; given as FitSeed_File they seed the fits of the next run in a series
+            strTempRunName = strFileName;
+            if ( strTempRunName.find(".root") != string::npos ) { strTempRunName.erase( strTempRunName.find(".root") ); }
+            strTempRunName = strTempRunName + "_FitSeeds.txt";
+            
+            cout<<"<<<<<<<< Storing Cluster Fit Seeds >>>>>>>>\n";
+            clustAnalyzer.printFitSeeds(strTempRunName);
         } //End Case: Cluster Analysis
     } //End Case: Fitting Stored Distributions
     
     //Visualize Results
+    //Each summary canvas is an independent job; the render pool runs them in rSetup.iVisPlots_NWorkers processes
+    //and writes them to file_Results in the order they are added here
     //------------------------------------------------------
     if ( rSetup.bAnaStep_Visualize ) { //Case: Visualize Output
+        VisualizeRenderPool renderPool;
+        
         visualizeUni.setAnalysisParameters(aSetup);
         visualizeUni.setAutoSaveCanvas( rSetup.bVisPlots_AutoSaving );
         visualizeUni.setDetector(detMPGD);
         
+        bool bPhiLines = rSetup.bVisPlots_PhiLines;
+        
         if (rSetup.bAnaStep_Hits) { //Case: Hit Analysis
             cout<<"<<<<<<<< Making Hit Summary Plots >>>>>>>>\n";
             
@@ -392,8 +695,8 @@ void InterfaceAnalysis::storeResults(TFile * file_Results, string strFileName){
             map_hit_ObsAndDrawOpt["HitMulti"]="E1";
             map_hit_ObsAndDrawOpt["HitTime"]="E1";
             
-            visualizeUni.storeCanvasHistoSegmented(file_Results, "HitPos", "E1", rSetup.bVisPlots_PhiLines);
-            visualizeUni.storeListOfCanvasesHistoSegmented(file_Results, map_hit_ObsAndDrawOpt, false);
+            renderPool.addJob("HitPos", [this, bPhiLines](TFile * file_Out){ visualizeUni.storeCanvasHistoSegmented(file_Out, "HitPos", "E1", bPhiLines); } );
+            renderPool.addJob("HitObs", [this, map_hit_ObsAndDrawOpt](TFile * file_Out) mutable { visualizeUni.storeListOfCanvasesHistoSegmented(file_Out, map_hit_ObsAndDrawOpt, false); } );
         } //End Case: Hit Analysis
         
         if (rSetup.bAnaStep_Clusters) { //Case: Cluster Analysis
@@ -404,16 +707,16 @@ void InterfaceAnalysis::storeResults(TFile * file_Results, string strFileName){
             map_clust_ObsAndDrawOpt["ClustSize"]="E1";
             map_clust_ObsAndDrawOpt["ClustTime"]="E1";
             
-            visualizeUni.storeCanvasHistoSegmented(file_Results, "ClustPos", "E1", rSetup.bVisPlots_PhiLines);
-            visualizeUni.storeListOfCanvasesHistoSegmented(file_Results, map_clust_ObsAndDrawOpt, false);
+            renderPool.addJob("ClustPos", [this, bPhiLines](TFile * file_Out){ visualizeUni.storeCanvasHistoSegmented(file_Out, "ClustPos", "E1", bPhiLines); } );
+            renderPool.addJob("ClustObs", [this, map_clust_ObsAndDrawOpt](TFile * file_Out) mutable { visualizeUni.storeListOfCanvasesHistoSegmented(file_Out, map_clust_ObsAndDrawOpt, false); } );
             
             if( !rSetup.bInputFromFrmwrk ) {
                 cout<<"<<<<<<<< Making Cluster Run History Summary Plots >>>>>>>>\n";
                 
-                visualizeUni.storeCanvasHisto2DHistorySegmented(file_Results, "HistoryClustADC", "COLZ", true); //Eta Level
-                visualizeUni.storeCanvasHisto2DHistorySegmented(file_Results, "HistoryClustADC", "COLZ", false); //Phi Level
-                visualizeUni.storeCanvasHisto2DHistorySegmented(file_Results, "HistoryClustTime", "COLZ", true); //Eta Level
-                visualizeUni.storeCanvasHisto2DHistorySegmented(file_Results, "HistoryClustTime", "COLZ", false); //Phi Level
+                renderPool.addJob("HistoryClustADC_Eta", [this](TFile * file_Out){ visualizeUni.storeCanvasHisto2DHistorySegmented(file_Out, "HistoryClustADC", "COLZ", true); } ); //Eta Level
+                renderPool.addJob("HistoryClustADC_Phi", [this](TFile * file_Out){ visualizeUni.storeCanvasHisto2DHistorySegmented(file_Out, "HistoryClustADC", "COLZ", false); } ); //Phi Level
+                renderPool.addJob("HistoryClustTime_Eta", [this](TFile * file_Out){ visualizeUni.storeCanvasHisto2DHistorySegmented(file_Out, "HistoryClustTime", "COLZ", true); } ); //Eta Level
+                renderPool.addJob("HistoryClustTime_Phi", [this](TFile * file_Out){ visualizeUni.storeCanvasHisto2DHistorySegmented(file_Out, "HistoryClustTime", "COLZ", false); } ); //Phi Level
             }
             
             if (rSetup.bAnaStep_Fitting) { //Case: Fitting
@@ -423,19 +726,22 @@ void InterfaceAnalysis::storeResults(TFile * file_Results, string strFileName){
                 map_res_ObsAndDrawOpt["ResponseFitPkPos"]="APE1";
                 map_res_ObsAndDrawOpt["ResponseFitPkRes"]="APE1";
                 
-                visualizeUni.storeCanvasData(file_Results, "ResponseFitChi2", "E1",false);
-                visualizeUni.storeCanvasData(file_Results, "ResponseFitPkPos", "E1",false);
-                visualizeUni.storeCanvasData(file_Results, "ResponseFitPkPos", "E1",true);
-                visualizeUni.storeCanvasData(file_Results, "ResponseFitPkRes", "E1",false);
-                visualizeUni.storeCanvasFits(file_Results, "COLZTEXT");
+                renderPool.addJob("DataChi2", [this](TFile * file_Out){ visualizeUni.storeCanvasData(file_Out, "ResponseFitChi2", "E1",false); } );
+                renderPool.addJob("DataPkPos", [this](TFile * file_Out){ visualizeUni.storeCanvasData(file_Out, "ResponseFitPkPos", "E1",false); } );
+                renderPool.addJob("DataPkPosShifted", [this](TFile * file_Out){ visualizeUni.storeCanvasData(file_Out, "ResponseFitPkPos", "E1",true); } );
+                renderPool.addJob("DataPkRes", [this](TFile * file_Out){ visualizeUni.storeCanvasData(file_Out, "ResponseFitPkRes", "E1",false); } );
+                renderPool.addJob("Fits", [this](TFile * file_Out){ visualizeUni.storeCanvasFits(file_Out, "COLZTEXT"); } );
                 
-                visualizeUni.storeListOfCanvasesGraph(file_Results,map_res_ObsAndDrawOpt, rSetup.bVisPlots_PhiLines);
-                visualizeUni.storeCanvasGraph2D(file_Results,"ResponseFitPkPos","TRI2Z",false);
-                visualizeUni.storeCanvasGraph2D(file_Results,"ResponseFitPkPos","TRI2Z",true);	//Normalized version
-                visualizeUni.storeCanvasGraph2D(file_Results,"ResponseFitPkRes","TRI2Z",false);
-                visualizeUni.storeCanvasGraph2D(file_Results,"ResponseFitPkRes","TRI2Z",true);	//Normalized version
+                renderPool.addJob("ResObs", [this, map_res_ObsAndDrawOpt, bPhiLines](TFile * file_Out) mutable { visualizeUni.storeListOfCanvasesGraph(file_Out, map_res_ObsAndDrawOpt, bPhiLines); } );
+                renderPool.addJob("Graph2DPkPos", [this](TFile * file_Out){ visualizeUni.storeCanvasGraph2D(file_Out,"ResponseFitPkPos","TRI2Z",false); } );
+                renderPool.addJob("Graph2DPkPosNorm", [this](TFile * file_Out){ visualizeUni.storeCanvasGraph2D(file_Out,"ResponseFitPkPos","TRI2Z",true); } );	//Normalized version
+                renderPool.addJob("Graph2DPkRes", [this](TFile * file_Out){ visualizeUni.storeCanvasGraph2D(file_Out,"ResponseFitPkRes","TRI2Z",false); } );
+                renderPool.addJob("Graph2DPkResNorm", [this](TFile * file_Out){ visualizeUni.storeCanvasGraph2D(file_Out,"ResponseFitPkRes","TRI2Z",true); } );	//Normalized version
             } //End Case: Fitting
         } //End Case: Cluster Analysis
+        
+        //Render & store all canvases
+        renderPool.render(file_Results, rSetup.iVisPlots_NWorkers);
     } //End Case: Visualize Output
     
     return;
@@ -130,7 +130,7 @@ void InterfaceRun::analyzeAmoreSRSRunClustersOnly(string strInputRun){
         tree_Clusters->GetEntry(i);
         
         //Output to the user some message that we are still running
-        if (i % 1000 == 0) cout<< i <<" Events Analyzed\n";
+        if (i % 1000 == 0) Logger::getInstance().logf(kLogInfo, "InterfaceRun::analyzeAmoreSRSRunClustersOnly()", "%i Events Analyzed", i);
         
         //Event Level Selection
         //------------------------------------------------------
@@ -328,7 +328,7 @@ void InterfaceRun::analyzeAmoreSRSRunHitsOnly(string strInputRun){
         tree_Hits->GetEntry(i);
         
         //Output to the user some message that we are still running
-        if (i % 1000 == 0) cout<< i <<" Events Analyzed\n";
+        if (i % 1000 == 0) Logger::getInstance().logf(kLogInfo, "InterfaceRun::analyzeAmoreSRSRunHitsOnly()", "%i Events Analyzed", i);
         
         //Event Level Selection
         //------------------------------------------------------
@@ -600,7 +600,7 @@ void InterfaceRun::analyzeAmoreSRSRunFullNoReReco(string strInputRun){
         tree_Clusters->GetEntry(i);
         
         //Output to the user some message that we are still running
-        if (i % 1000 == 0) cout<< i <<" Events Analyzed\n";
+        if (i % 1000 == 0) Logger::getInstance().logf(kLogInfo, "InterfaceRun::analyzeAmoreSRSRunFullNoReReco()", "%i Events Analyzed", i);
         
         //Event Level Selection
         //------------------------------------------------------
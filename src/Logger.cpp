@@ -0,0 +1,227 @@
+//
+//  Logger.cpp
+//
+//
+//
+//
+
+#include "Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdarg>
+
+using std::string;
+
+using namespace QualityControl::Uniformity;
+
+//Names printed in front of each line, indexed by LogLevel
+static const char * strLogLevelNames[] = {"DEBUG", "INFO", "WARNING", "ERROR", "SILENT"};
+
+//Default Constructor
+Logger::Logger(){
+    iThreshold.store(kLogInfo);
+
+    for (int i=0; i < iMaxCounters; ++i) { arr_lCounters[i].store(0); }
+
+    fLinesPerSec = 1.;
+    iBurst = 10;
+} //End Default Constructor
+
+//Returns the logger of the process
+Logger & Logger::getInstance(){
+    static Logger logger;
+
+    return logger;
+} //End Logger::getInstance()
+
+//Increments the counter strCategory by lIncrement
+void Logger::count(const std::string & strCategory, long lIncrement){
+    count( registerCounter(strCategory), lIncrement );
+
+    return;
+} //End Logger::count()
+
+//Prints strMsg under strCategory if eLevel passes the threshold & the category is not over its rate
+void Logger::log(LogLevel eLevel, const std::string & strCategory, const std::string & strMsg){
+    if ( !isEnabled(eLevel) ) return;
+
+    std::lock_guard<std::mutex> lock(mutexLog);
+
+    CategoryState & stateCategory = map_CategoryStates[strCategory];
+
+    if ( !acquire(stateCategory) ) { //Case: Over the Rate
+        stateCategory.lSuppressed++;
+        stateCategory.lSuppressedTotal++;
+
+        return;
+    } //End Case: Over the Rate
+
+    write(eLevel, strCategory, strMsg, stateCategory.lSuppressed);
+    stateCategory.lSuppressed = 0;
+
+    return;
+} //End Logger::log()
+
+//printf-like version of log()
+void Logger::logf(LogLevel eLevel, const std::string & strCategory, const char * cFormat, ...){
+    if ( !isEnabled(eLevel) ) return;
+
+    //Variable Declaration
+    char cBuffer[1024];
+
+    va_list args;
+    va_start(args, cFormat);
+    vsnprintf(cBuffer, sizeof(cBuffer), cFormat, args);
+    va_end(args);
+
+    log(eLevel, strCategory, string(cBuffer) );
+
+    return;
+} //End Logger::logf()
+
+//true -> the category may print one more line now (token bucket of iBurst lines refilled at fLinesPerSec)
+bool Logger::acquire(CategoryState & inputState){
+    if ( !(fLinesPerSec > 0) ) return true;
+
+    std::chrono::steady_clock::time_point timeNow = std::chrono::steady_clock::now();
+
+    if ( inputState.dTokens < 0 ) { //Case: First Line of the Category
+        inputState.dTokens = iBurst;
+    } //End Case: First Line of the Category
+    else{ //Case: Refill
+        double dElapsed = std::chrono::duration<double>(timeNow - inputState.timeLast).count();
+
+        inputState.dTokens = std::min( (double)iBurst, inputState.dTokens + dElapsed * fLinesPerSec );
+    } //End Case: Refill
+
+    inputState.timeLast = timeNow;
+
+    if ( inputState.dTokens < 1. ) return false;
+
+    inputState.dTokens -= 1.;
+
+    return true;
+} //End Logger::acquire()
+
+//Prints the counters & the number of suppressed lines of each category
+void Logger::printSummary(){
+    std::lock_guard<std::mutex> lock(mutexLog);
+
+    std::ostream & streamOut = fileLog.is_open() ? (std::ostream &)fileLog : std::cout;
+
+    if ( !map_CounterIdx.empty() ) { //Case: Counters
+        streamOut<<"=======================================================================\n";
+        streamOut<<"Logger Counters\n";
+
+        for (auto iterCounter = map_CounterIdx.begin(); iterCounter != map_CounterIdx.end(); ++iterCounter) {
+            streamOut<<(*iterCounter).first<<"\t"<<arr_lCounters[(*iterCounter).second].load()<<std::endl;
+        }
+    } //End Case: Counters
+
+    bool bHeader = false;
+    for (auto iterCat = map_CategoryStates.begin(); iterCat != map_CategoryStates.end(); ++iterCat) { //Loop Over Categories
+        if ( !( (*iterCat).second.lSuppressedTotal > 0 ) ) continue;
+
+        if ( !bHeader ) {
+            streamOut<<"=======================================================================\n";
+            streamOut<<"Logger Suppressed Lines\n";
+            bHeader = true;
+        }
+
+        streamOut<<(*iterCat).first<<"\t"<<(*iterCat).second.lSuppressedTotal<<std::endl;
+    } //End Loop Over Categories
+
+    if ( !map_CounterIdx.empty() || bHeader ) streamOut<<"=======================================================================\n";
+
+    return;
+} //End Logger::printSummary()
+
+//Returns the counter strCategory
+long Logger::getCount(const std::string & strCategory){
+    std::lock_guard<std::mutex> lock(mutexLog);
+
+    auto iterCounter = map_CounterIdx.find(strCategory);
+
+    return ( iterCounter != map_CounterIdx.end() ) ? arr_lCounters[(*iterCounter).second].load() : 0;
+} //End Logger::getCount()
+
+//Returns the handle of the counter strCategory, registering it on first use
+int Logger::registerCounter(const std::string & strCategory){
+    std::lock_guard<std::mutex> lock(mutexLog);
+
+    auto iterCounter = map_CounterIdx.find(strCategory);
+
+    if ( iterCounter != map_CounterIdx.end() ) return (*iterCounter).second;
+
+    if ( (int)map_CounterIdx.size() >= iMaxCounters ) {
+        printf("Logger::registerCounter() - no room for counter %s, it will not be counted\n", strCategory.c_str() );
+
+        return -1;
+    }
+
+    int iCounter = map_CounterIdx.size();
+
+    map_CounterIdx[strCategory] = iCounter;
+
+    return iCounter;
+} //End Logger::registerCounter()
+
+//Sets the level from its name
+void Logger::setLevel(std::string strLevel){
+    std::transform(strLevel.begin(), strLevel.end(), strLevel.begin(), ::toupper);
+
+    for (int i=kLogDebug; i <= kLogSilent; ++i) {
+        if ( strLevel == strLogLevelNames[i] ) {
+            setLevel( (LogLevel)i );
+
+            return;
+        }
+    }
+
+    printf("Logger::setLevel() - level %s not recognized, level unchanged\n", strLevel.c_str() );
+
+    return;
+} //End Logger::setLevel()
+
+//Lines go to strFileName (appended), an empty name goes back to std::cout
+void Logger::setLogFile(std::string strFileName){
+    std::lock_guard<std::mutex> lock(mutexLog);
+
+    if ( fileLog.is_open() ) fileLog.close();
+
+    if ( strFileName.empty() ) return;
+
+    fileLog.open(strFileName.c_str(), std::ios::out | std::ios::app);
+
+    if ( !fileLog.is_open() ) {
+        printf("Logger::setLogFile() - log file %s could not be opened, logging to std::cout\n", strFileName.c_str() );
+    }
+
+    return;
+} //End Logger::setLogFile()
+
+//Each category prints a burst of iBurstInput lines, then fLinesPerSecInput lines per second
+void Logger::setRateLimit(float fLinesPerSecInput, int iBurstInput){
+    std::lock_guard<std::mutex> lock(mutexLog);
+
+    fLinesPerSec = fLinesPerSecInput;
+    iBurst = std::max(iBurstInput, 1);
+
+    return;
+} //End Logger::setRateLimit()
+
+//Writes one line
+void Logger::write(LogLevel eLevel, const std::string & strCategory, const std::string & strMsg, long lSuppressed){
+    std::ostream & streamOut = fileLog.is_open() ? (std::ostream &)fileLog : std::cout;
+
+    streamOut<<"["<<strLogLevelNames[eLevel]<<"] "<<strCategory<<" - "<<strMsg;
+
+    if (lSuppressed > 0) streamOut<<" ("<<lSuppressed<<" similar lines suppressed)";
+
+    streamOut<<"\n";
+
+    //Errors are flushed right away, a crash should not lose them
+    if (eLevel >= kLogWarning) streamOut.flush();
+
+    return;
+} //End Logger::write()
@@ -0,0 +1,186 @@
+//
+//  MemoryReport.cpp
+//  
+//
+//
+//
+
+#include "MemoryReport.h"
+
+using std::cout;
+using std::endl;
+using std::map;
+using std::string;
+
+using namespace QualityControl::Uniformity;
+
+//Bytes of one node of a std::map/multimap beyond its value (colour, parent, left & right)
+const long lMapNodeOverhead = 32;
+
+//Default Constructor
+MemoryReport::MemoryReport(){
+
+} //End Default Constructor
+
+//Adds the objects held by inputDet to the report
+void MemoryReport::accumulate(DetectorMPGD & inputDet){
+    //Detector Level
+    add(strMemCat_Histos1D, getBytes( inputDet.hMulti_Clust.get() ) );
+    add(strMemCat_Histos1D, getBytes( inputDet.hMulti_Hit.get() ) );
+
+    //Loop Over Stored iEta Sectors
+    for (auto iterEta = inputDet.map_sectorsEta.begin(); iterEta != inputDet.map_sectorsEta.end(); ++iterEta) { //Loop Over iEta Sectors
+        accumulate( (*iterEta).second.clustHistos );
+        accumulate( (*iterEta).second.hitHistos );
+
+        add(strMemCat_Graphs, getBytes( (*iterEta).second.gEta_ClustADC_Fit_NormChi2.get() ) );
+        add(strMemCat_Graphs, getBytes( (*iterEta).second.gEta_ClustADC_Fit_PkPos.get() ) );
+        add(strMemCat_Graphs, getBytes( (*iterEta).second.gEta_ClustADC_Fit_PkRes.get() ) );
+        add(strMemCat_Graphs, getBytes( (*iterEta).second.gEta_ClustADC_Fit_Failures.get() ) );
+        add(strMemCat_Graphs, getBytes( (*iterEta).second.gEta_ClustADC_Spec_NumPks.get() ) );
+        add(strMemCat_Graphs, getBytes( (*iterEta).second.gEta_ClustADC_Spec_PkPos.get() ) );
+
+        //Loop Over Stored iPhi Sectors
+        for (auto iterPhi = (*iterEta).second.map_sectorsPhi.begin(); iterPhi != (*iterEta).second.map_sectorsPhi.end(); ++iterPhi) { //Loop Over iPhi Sectors
+            accumulate( (*iterPhi).second.clustHistos );
+            accumulate( (*iterPhi).second.hitHistos );
+
+            //Loop Over Stored Slices
+            for (auto iterSlice = (*iterPhi).second.map_slices.begin(); iterSlice != (*iterPhi).second.map_slices.end(); ++iterSlice) { //Loop Over Slices
+                add(strMemCat_Slices, getBytes( (*iterSlice).second.hSlice_ClustADC.get() ) );
+                add(strMemCat_Fits, getBytes( (*iterSlice).second.fitSlice_ClustADC.get() ) );
+            } //End Loop Over Slices
+
+            //Physics Objects
+            for (auto iterClust = (*iterPhi).second.map_clusters.begin(); iterClust != (*iterPhi).second.map_clusters.end(); ++iterClust) {
+                add(strMemCat_Clusters, getBytes( (*iterClust).second ) );
+            }
+
+            for (auto iterHit = (*iterPhi).second.map_hits.begin(); iterHit != (*iterPhi).second.map_hits.end(); ++iterHit) {
+                add(strMemCat_Hits, getBytes( (*iterHit).second ) );
+            }
+        } //End Loop Over iPhi Sectors
+    } //End Loop Over iEta Sectors
+
+    return;
+} //End MemoryReport::accumulate() - DetectorMPGD
+
+//Adds the histograms of inputHistos to the report
+void MemoryReport::accumulate(HistosPhysObj & inputHistos){
+    add(strMemCat_Histos1D, getBytes( inputHistos.hADC.get() ) );
+    add(strMemCat_Histos1D, getBytes( inputHistos.hMulti.get() ) );
+    add(strMemCat_Histos1D, getBytes( inputHistos.hPos.get() ) );
+    add(strMemCat_Histos1D, getBytes( inputHistos.hSize.get() ) );
+    add(strMemCat_Histos1D, getBytes( inputHistos.hTime.get() ) );
+
+    add(strMemCat_Histos2D, getBytes( inputHistos.hADC_v_Pos.get() ) );
+    add(strMemCat_Histos2D, getBytes( inputHistos.hADC_v_Size.get() ) );
+    add(strMemCat_Histos2D, getBytes( inputHistos.hADC_v_Time.get() ) );
+    add(strMemCat_Histos2D, getBytes( inputHistos.hADCMax_v_ADCInt.get() ) );
+    add(strMemCat_Histos2D, getBytes( inputHistos.hSize_v_Pos.get() ) );
+
+    for (auto iterHisto = inputHistos.map_hADC_v_EvtNum_by_Run.begin(); iterHisto != inputHistos.map_hADC_v_EvtNum_by_Run.end(); ++iterHisto) {
+        add(strMemCat_RunHistory, getBytes( (*iterHisto).second.get() ) );
+    }
+
+    for (auto iterHisto = inputHistos.map_hTime_v_EvtNum_by_Run.begin(); iterHisto != inputHistos.map_hTime_v_EvtNum_by_Run.end(); ++iterHisto) {
+        add(strMemCat_RunHistory, getBytes( (*iterHisto).second.get() ) );
+    }
+
+    if ( !inputHistos.storeADC_v_Run.empty() ) add(strMemCat_RunHistory, inputHistos.storeADC_v_Run.getBytes() );
+    if ( !inputHistos.storeTime_v_Run.empty() ) add(strMemCat_RunHistory, inputHistos.storeTime_v_Run.getBytes() );
+
+    return;
+} //End MemoryReport::accumulate() - HistosPhysObj
+
+//Adds one object of lBytes to strCategory
+void MemoryReport::add(const std::string & strCategory, long lBytes){
+    if ( !(lBytes > 0) ) return;
+
+    map_Usage[strCategory].lNObjects++;
+    map_Usage[strCategory].lBytes += lBytes;
+
+    return;
+} //End MemoryReport::add()
+
+//Returns the estimated bytes in category strCategory
+long MemoryReport::getBytes(const std::string & strCategory){
+    return ( map_Usage.count(strCategory) > 0 ) ? map_Usage[strCategory].lBytes : 0;
+} //End MemoryReport::getBytes()
+
+//Returns the estimated bytes over all categories
+long MemoryReport::getBytesTotal(){
+    //Variable Declaration
+    long lRetBytes = 0;
+
+    for (auto iterCat = map_Usage.begin(); iterCat != map_Usage.end(); ++iterCat) {
+        lRetBytes += (*iterCat).second.lBytes;
+    }
+
+    return lRetBytes;
+} //End MemoryReport::getBytesTotal()
+
+//Returns the number of objects in category strCategory
+long MemoryReport::getNObjects(const std::string & strCategory){
+    return ( map_Usage.count(strCategory) > 0 ) ? map_Usage[strCategory].lNObjects : 0;
+} //End MemoryReport::getNObjects()
+
+//Histograms: bin contents, plus the sum of squared weights when Sumw2() is set
+long MemoryReport::getBytes(TH1F * hInput){
+    if (hInput == nullptr) return 0;
+
+    return sizeof(TH1F) + hInput->GetNcells() * sizeof(float) + hInput->GetSumw2N() * sizeof(double);
+} //End MemoryReport::getBytes() - TH1F
+
+long MemoryReport::getBytes(TH2F * hInput){
+    if (hInput == nullptr) return 0;
+
+    return sizeof(TH2F) + hInput->GetNcells() * sizeof(float) + hInput->GetSumw2N() * sizeof(double);
+} //End MemoryReport::getBytes() - TH2F
+
+//Graphs: x, y, ex & ey arrays (allocated to the capacity, not the number of points)
+long MemoryReport::getBytes(TGraphErrors * gInput){
+    if (gInput == nullptr) return 0;
+
+    return sizeof(TGraphErrors) + 4 * gInput->GetMaxSize() * sizeof(double);
+} //End MemoryReport::getBytes() - TGraphErrors
+
+//Fits: parameters, errors & limits, plus the sampled function kept for drawing
+long MemoryReport::getBytes(TF1 * fitInput){
+    if (fitInput == nullptr) return 0;
+
+    return sizeof(TF1) + 4 * fitInput->GetNpar() * sizeof(double) + 2 * fitInput->GetNpx() * sizeof(double);
+} //End MemoryReport::getBytes() - TF1
+
+//Hits: the multimap node and the per time bin ADC values
+long MemoryReport::getBytes(const Hit & inputHit){
+    return lMapNodeOverhead + sizeof(int) + sizeof(Hit) + inputHit.vec_sADC.capacity() * sizeof(short);
+} //End MemoryReport::getBytes() - Hit
+
+//Clusters: the multimap node and the hits of the cluster
+long MemoryReport::getBytes(const Cluster & inputCluster){
+    //Variable Declaration
+    long lRetBytes = lMapNodeOverhead + sizeof(int) + sizeof(Cluster);
+
+    for (auto iterHit = inputCluster.map_hits.begin(); iterHit != inputCluster.map_hits.end(); ++iterHit) {
+        lRetBytes += getBytes( (*iterHit).second );
+    }
+
+    return lRetBytes;
+} //End MemoryReport::getBytes() - Cluster
+
+//Prints the bytes & number of objects in each category
+void MemoryReport::printReport(){
+    cout<<"=======================================================================\n";
+    cout<<"Memory Report\n";
+    cout<<"Category\tObjects\tMB\n";
+
+    for (auto iterCat = map_Usage.begin(); iterCat != map_Usage.end(); ++iterCat) {
+        cout<<(*iterCat).first<<"\t"<<(*iterCat).second.lNObjects<<"\t"<<(*iterCat).second.lBytes / ( 1024. * 1024. )<<endl;
+    }
+
+    cout<<"Total\t\t\t"<<getBytesTotal() / ( 1024. * 1024. )<<endl;
+    cout<<"=======================================================================\n";
+
+    return;
+} //End MemoryReport::printReport()
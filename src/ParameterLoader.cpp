@@ -69,7 +69,7 @@ void ParameterLoader::loadParameters(std::ifstream &file_Input, bool bVerboseMod
 //Only those input files having a run number will be returned
 //  ->First is run number
 //  ->Second is run name
-std::vector<std::pair<int, string> > ParameterLoader::getPairedRunList(ifstream &file_Input, string strIdent, bool bVerboseMode){
+std::vector<std::pair<int, string> > ParameterLoader::getPairedRunList(ifstream &file_Input, string strIdent, bool bVerboseMode, bool bChain){
     //Variable Declaration
     bool bHeaderEnd = false;
     
@@ -77,6 +77,8 @@ std::vector<std::pair<int, string> > ParameterLoader::getPairedRunList(ifstream
     
     string strLine = "";
     
+    vector<string> vec_strFiles;
+    
     vector<std::pair<int, string> > vec_retPairedRuns;
 
     //Loop Through Data File
@@ -110,23 +112,45 @@ std::vector<std::pair<int, string> > ParameterLoader::getPairedRunList(ifstream
                     break;
                 } //End Case: End of run list header
                 
-                //Get the run number from the file name
-                iNum_Run = getRunNumber(strLine, strIdent);
+                //Expand the line into its input files
+                vec_strFiles = getExpandedFileList(strLine);
                 
-                //Set the run or inform the user of a problem
-                if (iNum_Run > -1 ) { //Case: Success, Run Set!
-                    vec_retPairedRuns.push_back(std::make_pair(iNum_Run, strLine ) );
-                } //End Case: Success, Run Set!
-                else{ //End Case: Input not understood/not parsed correctly
-                    cout<<"ParameterLoader::getPairedRunList() - ERROR!!! input file:\n";
+                if ( vec_strFiles.empty() ) { //Case: No Input Files
+                    cout<<"ParameterLoader::getPairedRunList() - ERROR!!! no input files match:\n";
                     cout<<"\t"<<strLine.c_str()<<endl;
-                    
-                    cout<<"ParameterLoader::getPairedRunList(): Run number not found/parsed from filename!\n";
-                    cout<<"ParameterLoader::getPairedRunList(): you must have the field 'RunX' in the filename, separated by underscores '_', for some unique integer X\n";
-                    cout<<"ParameterLoader::getPairedRunList(): This file will be skipped!!! Please cross-check input file!!!\n";
+                    cout<<"ParameterLoader::getPairedRunList(): This line will be skipped!!! Please cross-check input file!!!\n";
                     
                     continue;
-                } //Case: Input not understood/not parsed correctly
+                } //End Case: No Input Files
+                
+                //A chained run is a single entry; its files are kept as a comma separated list
+                if (bChain) {
+                    string strChain = vec_strFiles[0];
+                    
+                    for (int i=1; i < vec_strFiles.size(); ++i) { strChain = strChain + "," + vec_strFiles[i]; }
+                    
+                    vec_strFiles.assign(1, strChain);
+                }
+                
+                for (int i=0; i < vec_strFiles.size(); ++i) { //Loop Over Input Files
+                    //Get the run number from the file name
+                    iNum_Run = getRunNumber(vec_strFiles[i].substr(0, vec_strFiles[i].find(',') ), strIdent);
+                    
+                    //Set the run or inform the user of a problem
+                    if (iNum_Run > -1 ) { //Case: Success, Run Set!
+                        vec_retPairedRuns.push_back(std::make_pair(iNum_Run, vec_strFiles[i] ) );
+                    } //End Case: Success, Run Set!
+                    else{ //End Case: Input not understood/not parsed correctly
+                        cout<<"ParameterLoader::getPairedRunList() - ERROR!!! input file:\n";
+                        cout<<"\t"<<vec_strFiles[i].c_str()<<endl;
+                        
+                        cout<<"ParameterLoader::getPairedRunList(): Run number not found/parsed from filename!\n";
+                        cout<<"ParameterLoader::getPairedRunList(): you must have the field 'RunX' in the filename, separated by underscores '_', for some unique integer X\n";
+                        cout<<"ParameterLoader::getPairedRunList(): This file will be skipped!!! Please cross-check input file!!!\n";
+                        
+                        continue;
+                    } //Case: Input not understood/not parsed correctly
+                } //End Loop Over Input Files
             } //End loop through run list header
         } //End Case: Run list header
         
@@ -180,7 +204,10 @@ vector<string> ParameterLoader::getRunList(ifstream &file_Input, bool bVerboseMo
                     break;
                 } //End Case: End of run list header
                 
-                vec_strRetRuns.push_back(strLine);
+                //Glob patterns & comma separated lists are expanded into their files
+                vector<string> vec_strFiles = getExpandedFileList(strLine);
+                
+                vec_strRetRuns.insert(vec_strRetRuns.end(), vec_strFiles.begin(), vec_strFiles.end() );
             } //End loop through run list header
         } //End Case: Run list header
         
@@ -224,6 +251,39 @@ void ParameterLoader::setFileStream(std::string strInputSetupFile, ifstream &fil
     return;
 } //End ParameterLoader::getFileStream()
 
+//Returns the files of a run list line; a comma separated list of files and/or glob patterns, patterns are expanded in alphabetical order
+vector<string> ParameterLoader::getExpandedFileList(std::string strInput){
+    //Variable Declaration
+    glob_t globResult;
+    
+    vector<string> vec_strRetFiles;
+    vector<string> vec_strParsedInput = getCharSeparatedList(strInput, ',');
+    
+    for (int i=0; i < vec_strParsedInput.size(); ++i) { //Loop Over Comma Separated Entries
+        if ( vec_strParsedInput[i].empty() ) continue;
+        
+        //Plain file name, keep as is (a missing file is reported when it is opened)
+        if ( vec_strParsedInput[i].find_first_of("*?[") == string::npos ) {
+            vec_strRetFiles.push_back( vec_strParsedInput[i] );
+            continue;
+        }
+        
+        //Glob pattern
+        if ( 0 == glob( vec_strParsedInput[i].c_str(), 0, NULL, &globResult ) ) { //Case: Pattern Matched
+            for (size_t j=0; j < globResult.gl_pathc; ++j) {
+                vec_strRetFiles.push_back( globResult.gl_pathv[j] );
+            }
+        } //End Case: Pattern Matched
+        else{ //Case: No Match
+            printClassMethodMsg("ParameterLoader","getExpandedFileList", ("no file matches " + vec_strParsedInput[i]).c_str() );
+        } //End Case: No Match
+        
+        globfree(&globResult);
+    } //End Loop Over Comma Separated Entries
+    
+    return vec_strRetFiles;
+} //End ParameterLoader::getExpandedFileList()
+
 int ParameterLoader::getRunNumber(std::string strRunName, string strIdent){
     //Variable Declaration
     int iRetVal;
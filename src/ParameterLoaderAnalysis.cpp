@@ -600,6 +600,70 @@ void ParameterLoaderAnalysis::loadAnalysisParametersUniformity(ifstream &inputFi
             else if( 0 == pair_strParam.first.compare("UNIFORMITY_GRANULARITY") ){ //Case: Uniformity Granularity
                 aSetupUniformity.iUniformityGranularity = stoiSafe(pair_strParam.first,pair_strParam.second);
             } //End Case: Uniformity Granularity
+            else if( 0 == pair_strParam.first.compare("UNIFORMITY_ADAPTIVE") ){ //Case: Adaptive Slicing
+                aSetupUniformity.bUniformityAdaptive = convert2bool(pair_strParam.second, bExitSuccess);
+            } //End Case: Adaptive Slicing
+            else if( 0 == pair_strParam.first.compare("UNIFORMITY_MINCLUSTERS") ){ //Case: Adaptive Slicing - Min Clusters per Slice
+                aSetupUniformity.iUniformityMinClusters = stoiSafe(pair_strParam.first,pair_strParam.second);
+            } //End Case: Adaptive Slicing - Min Clusters per Slice
+            else if( 0 == pair_strParam.first.compare("UNIFORMITY_SPLITMAX") ){ //Case: Adaptive Slicing - Max Split
+                aSetupUniformity.iUniformitySplitMax = stoiSafe(pair_strParam.first,pair_strParam.second);
+            } //End Case: Adaptive Slicing - Max Split
+            else if( 0 == pair_strParam.first.compare("UNIFORMITY_HISTOS2D") ){ //Case: Book 2D Cluster Histograms
+                aSetupUniformity.bUniformityHistos2D = convert2bool(pair_strParam.second, bExitSuccess);
+            } //End Case: Book 2D Cluster Histograms
+            else if( 0 == pair_strParam.first.compare("UNIFORMITY_FITMODE") ){ //Case: Fit Mode
+                aSetupUniformity.strUniformityFitMode = pair_strParam.second;
+                transform(aSetupUniformity.strUniformityFitMode.begin(), aSetupUniformity.strUniformityFitMode.end(), aSetupUniformity.strUniformityFitMode.begin(), toupper);
+                
+                if ( !( 0 == aSetupUniformity.strUniformityFitMode.compare("FIT")
+                     || 0 == aSetupUniformity.strUniformityFitMode.compare("FAST")
+                     || 0 == aSetupUniformity.strUniformityFitMode.compare("FAST_SEED") ) ) {
+                    printClassMethodMsg("ParameterLoaderAnalysis","loadAnalysisParametersUniformity", ("Unrecognized Uniformity_FitMode " + pair_strParam.second + ", using FIT").c_str() );
+                    aSetupUniformity.strUniformityFitMode = "FIT";
+                }
+            } //End Case: Fit Mode
+            //=======================Input Parameters=======================
+            else if( 0 == pair_strParam.first.compare("CLUSTERCACHE_USE") ){ //Case: Read Clusters from Cluster Cache
+                aSetupUniformity.bClusterCache_Use = convert2bool(pair_strParam.second, bExitSuccess);
+            } //End Case: Read Clusters from Cluster Cache
+            else if( 0 == pair_strParam.first.compare("EVENTINDEX_USE") ){ //Case: Multiplicity Cut from Event Index
+                aSetupUniformity.bEventIndex_Use = convert2bool(pair_strParam.second, bExitSuccess);
+            } //End Case: Multiplicity Cut from Event Index
+            //=======================Run History Parameters=======================
+            else if( 0 == pair_strParam.first.compare("RUNHISTORY_FULL") ){ //Case: Full Run History Histograms
+                aSetupUniformity.bRunHistory_Full = convert2bool(pair_strParam.second, bExitSuccess);
+            } //End Case: Full Run History Histograms
+            else if( 0 == pair_strParam.first.compare("RUNHISTORY_NBINS") ){ //Case: Run History Summary - History Bins
+                aSetupUniformity.iRunHistory_NBins = stoiSafe(pair_strParam.first,pair_strParam.second);
+            } //End Case: Run History Summary - History Bins
+            else if( 0 == pair_strParam.first.compare("RUNHISTORY_SKETCHBINS") ){ //Case: Run History Summary - Sketch Bins
+                aSetupUniformity.iRunHistory_SketchBins = stoiSafe(pair_strParam.first,pair_strParam.second);
+            } //End Case: Run History Summary - Sketch Bins
+            //=======================Memory Parameters=======================
+            else if( 0 == pair_strParam.first.compare("MEMORY_REPORT") ){ //Case: Print Memory Report
+                aSetupUniformity.bMemory_Report = convert2bool(pair_strParam.second, bExitSuccess);
+            } //End Case: Print Memory Report
+            else if( 0 == pair_strParam.first.compare("MEMORY_BUDGET") ){ //Case: Memory Budget
+                aSetupUniformity.fMemory_Budget = stofSafe(pair_strParam.first,pair_strParam.second);
+            } //End Case: Memory Budget
+            //=======================Strip Health Parameters=======================
+            else if( 0 == pair_strParam.first.compare("STRIPHEALTH_PVAL_DEAD") ){ //Case: Dead Strip Probability
+                aSetupUniformity.fStripHealth_PVal_Dead = stofSafe(pair_strParam.first,pair_strParam.second);
+            } //End Case: Dead Strip Probability
+            else if( 0 == pair_strParam.first.compare("STRIPHEALTH_NSIGMA_HOT") ){ //Case: Hot Strip Threshold
+                aSetupUniformity.fStripHealth_NSigma_Hot = stofSafe(pair_strParam.first,pair_strParam.second);
+            } //End Case: Hot Strip Threshold
+            else if( 0 == pair_strParam.first.compare("STRIPMASK_FILE") ){ //Case: Input Strip Mask
+                aSetupUniformity.strFile_StripMask = pair_strParam.second;
+            } //End Case: Input Strip Mask
+            //=======================Fit Seed Parameters=======================
+            else if( 0 == pair_strParam.first.compare("FITSEED_FILE") ){ //Case: Input Fit Seeds
+                aSetupUniformity.strFile_FitSeed = pair_strParam.second;
+            } //End Case: Input Fit Seeds
+            else if( 0 == pair_strParam.first.compare("FITSEED_GAINSCALE") ){ //Case: Expected Gain Change
+                aSetupUniformity.fFitSeed_GainScale = stofSafe(pair_strParam.first,pair_strParam.second);
+            } //End Case: Expected Gain Change
             //=======================Unrecognized Parameters=======================
             else{ //Case: Parameter Not Recognized
                 printClassMethodMsg("ParameterLoaderAnalysis","loadAnalysisParametersUniformity","Error!!! Parameter Not Recognizd:\n");
@@ -139,6 +139,9 @@ void ParameterLoaderRun::loadParametersRun(std::ifstream &file_Input, bool bVerb
             else if ( pair_strParam.first.compare("ANA_HITS") == 0 ) {
                 inputRunSetup.bAnaStep_Hits = convert2bool(pair_strParam.second, bExitSuccess);
             }
+            else if ( pair_strParam.first.compare("ANA_NTHREADS") == 0 ) {
+                inputRunSetup.iAna_NThreads = stoiSafe(pair_strParam.first, pair_strParam.second);
+            }
             else if ( pair_strParam.first.compare("RECO_ALL") == 0 ) {
                 inputRunSetup.bRecoStep_All = convert2bool(pair_strParam.second, bExitSuccess);
                 //inputRunSetup.bInputIsRaw = inputRunSetup.bRecoStep_All;
@@ -149,6 +152,12 @@ void ParameterLoaderRun::loadParametersRun(std::ifstream &file_Input, bool bVerb
             else if ( pair_strParam.first.compare("INPUT_IDENTIFIER") == 0 ) {
                 inputRunSetup.strIdent = pair_strParam.second;
             }
+            else if ( pair_strParam.first.compare("INPUT_CHAIN") == 0 ) {
+                inputRunSetup.bInputChain = convert2bool(pair_strParam.second, bExitSuccess);
+            }
+            else if ( pair_strParam.first.compare("INPUT_CHAIN_NTHREADS") == 0 ) {
+                inputRunSetup.iInputChain_NThreads = stoiSafe(pair_strParam.first, pair_strParam.second);
+            }
             else if ( pair_strParam.first.compare("INPUT_IS_FRMWRK_OUTPUT") == 0 ) {
                 inputRunSetup.bInputFromFrmwrk = convert2bool(pair_strParam.second, bExitSuccess);
             }
@@ -161,6 +170,9 @@ void ParameterLoaderRun::loadParametersRun(std::ifstream &file_Input, bool bVerb
             else if ( pair_strParam.first.compare("VISUALIZE_AUTOSAVEIMAGES") == 0 ) {
                 inputRunSetup.bVisPlots_AutoSaving = convert2bool(pair_strParam.second, bExitSuccess);
             }
+            else if ( pair_strParam.first.compare("VISUALIZE_NWORKERS") == 0 ) {
+                inputRunSetup.iVisPlots_NWorkers = stoiSafe(pair_strParam.first, pair_strParam.second);
+            }
             else if ( pair_strParam.first.compare("CONFIG_RECO") == 0 ) {
                 inputRunSetup.strFile_Config_Reco = pair_strParam.second;
             }
@@ -296,6 +308,12 @@ void ParameterLoaderRun::loadParametersCompare(std::ifstream &file_Input, bool b
             else if ( pair_strParam.first.compare("INPUT_IDENTIFIER") == 0 ) {
                 inputRunSetup.strIdent = pair_strParam.second;
             }
+            else if ( pair_strParam.first.compare("INPUT_CACHESIZE") == 0 ) {
+                inputRunSetup.iComp_CacheSize = stoiSafe(pair_strParam.first, pair_strParam.second);
+            }
+            else if ( pair_strParam.first.compare("INPUT_NTHREADS") == 0 ) {
+                inputRunSetup.iComp_NThreads = stoiSafe(pair_strParam.first, pair_strParam.second);
+            }
             else if ( pair_strParam.first.compare("OUTPUT_FILE_NAME") == 0 ) {
                 inputRunSetup.strFile_Output_Name = pair_strParam.second;
             }
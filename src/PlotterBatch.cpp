@@ -0,0 +1,188 @@
+//
+//  PlotterBatch.cpp
+//  
+//
+//
+//
+
+#include "PlotterBatch.h"
+
+//POSIX Includes
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using std::cout;
+using std::endl;
+using std::make_shared;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+using QualityControl::Timing::getString;
+using QualityControl::Timing::printStreamStatus;
+
+using namespace QualityControl::Plotter;
+
+//Default Constructor
+PlotterBatch::PlotterBatch(){
+    m_bVerboseMode = false;
+    
+    m_iNWorkers = 1;
+    
+    m_vec_strImgFormats = {"png", "pdf"};
+} //End Default Constructor
+
+//Renders every plot config file in headless (batch) mode & saves the requested image formats
+int PlotterBatch::render(){
+    //Variable Declaration
+    int iNFailures = 0;
+    int iNWorkers = m_iNWorkers;
+    int iStatus;
+    
+    pid_t pid;
+    
+    vector<pid_t> vec_pidWorkers;
+    
+    //Nothing to do?
+    if ( m_vec_strConfigs.size() == 0 ) return 0;
+    
+    //Never open a display
+    gROOT->SetBatch(kTRUE);
+    
+    //Never fork more workers than configs
+    if ( iNWorkers > (int)m_vec_strConfigs.size() ) { iNWorkers = m_vec_strConfigs.size(); }
+    
+    //Serial Case
+    //------------------------------------------------------
+    if ( iNWorkers <= 1 ) { return runWorker(0, 1); }
+    
+    //Parallel Case: fork the workers
+    //------------------------------------------------------
+    cout<<"PlotterBatch::render() - Rendering " << m_vec_strConfigs.size() << " plot config files with " << iNWorkers << " worker processes\n";
+    
+    //Flush everything buffered so far so it is not duplicated by the workers
+    cout.flush();
+    fflush(stdout);
+    
+    for (int i=0; i < iNWorkers; ++i) { //Loop Over Workers
+        pid = fork();
+        
+        if ( pid == 0 ) { //Case: Worker Process
+            iNFailures = runWorker(i, iNWorkers);
+            
+            cout.flush();
+            fflush(stdout);
+            
+            //Skip static destructors & atexit handlers
+            _exit( (iNFailures > 255) ? 255 : iNFailures );
+        } //End Case: Worker Process
+        else if ( pid < 0 ) { //Case: fork failed
+            perror( "PlotterBatch::render() - fork failed; the configs of this worker will be rendered serially" );
+            
+            iNFailures += runWorker(i, iNWorkers);
+            continue;
+        } //End Case: fork failed
+        
+        vec_pidWorkers.push_back(pid);
+    } //End Loop Over Workers
+    
+    //Wait for all workers
+    for (int i=0; i < vec_pidWorkers.size(); ++i) { //Loop Over Workers
+        if ( waitpid(vec_pidWorkers[i], &iStatus, 0) < 0 || !WIFEXITED(iStatus) ) {
+            cout<<"PlotterBatch::render() - A worker did not finish cleanly; some of its plots may be missing\n";
+            ++iNFailures;
+        }
+        else{
+            iNFailures += WEXITSTATUS(iStatus);
+        }
+    } //End Loop Over Workers
+    
+    return iNFailures;
+} //End PlotterBatch::render()
+
+//Renders a single plot config file on inputCanvas
+bool PlotterBatch::plotConfig(std::string & strInputConfig, std::shared_ptr<TCanvas> inputCanvas){
+    //Variable Declaration
+    std::ifstream file_Config;
+    
+    InfoCanvas canvSetup;
+    
+    ParameterLoaderPlotter loaderPlots;
+    
+    shared_ptr<PlotterGeneric> plotter;
+    
+    //Load the Input Config File
+    //------------------------------------------------------
+    loaderPlots.setFileStream( strInputConfig, file_Config, m_bVerboseMode );
+    
+    //Check to see if the config file opened successfully
+    if (!file_Config.is_open()) {
+        perror( ("PlotterBatch::plotConfig() - error while opening file: " + strInputConfig).c_str() );
+        printStreamStatus(file_Config);
+        
+        return false;
+    } //End Case: Input Not Understood
+    
+    loaderPlots.loadParameters(file_Config, m_bVerboseMode, canvSetup);
+    
+    //Determine the Plot Type, Setup the Plotter, and Plot
+    //------------------------------------------------------
+    plotter = getPlotter(canvSetup.m_strPlotType);
+    
+    if ( plotter == nullptr ) { //Case: Unrecognized Plot Type
+        cout<<"PlotterBatch::plotConfig() - Plot type: " << canvSetup.m_strPlotType << endl;
+        cout<<"\tNot Recognized\n";
+        cout<<"\tPlease cross-check " << strInputConfig << " and try again\n";
+        
+        return false;
+    } //End Case: Unrecognized Plot Type
+    
+    plotter->setCanvasParameters(canvSetup);
+    plotter->setLogoPos(canvSetup.m_iLogoPos);
+    plotter->setPreliminary(canvSetup.m_bIsPrelim);
+    plotter->setImgFormats(m_vec_strImgFormats);
+    plotter->setAutoWriteRootFile(false);
+    plotter->setAutoReleaseCanvas(true); //Clear the canvas while the plotter still owns the plots drawn on it
+    plotter->setCanvas(inputCanvas);
+    plotter->plotAndStore();
+    
+    return true;
+} //End PlotterBatch::plotConfig()
+
+//Renders the configs assigned to worker iWorker
+int PlotterBatch::runWorker(int iWorker, int iNWorkers){
+    //Variable Declaration
+    int iNFailures = 0;
+    
+    //One canvas per worker, reused for every plot
+    shared_ptr<TCanvas> canvWorker = make_shared<TCanvas>( ("canvPlotterBatch_" + getString(iWorker) ).c_str(), "", 700, 700 );
+    
+    for (int i=iWorker; i < m_vec_strConfigs.size(); i+=iNWorkers) { //Loop Over Configs of this Worker
+        if (m_bVerboseMode) {
+            cout<<"PlotterBatch::runWorker() - Worker " << iWorker << " making plot from file: " << m_vec_strConfigs[i] << endl;
+        }
+        
+        if ( !plotConfig(m_vec_strConfigs[i], canvWorker) ) { ++iNFailures; }
+    } //End Loop Over Configs of this Worker
+    
+    canvWorker.reset();
+    
+    return iNFailures;
+} //End PlotterBatch::runWorker()
+
+//Returns a new plotter for the plot type given
+std::shared_ptr<PlotterGeneric> PlotterBatch::getPlotter(std::string & strPlotType){
+    //Variable Declaration
+    PlotTypesPlotter typePlot;
+    
+    shared_ptr<PlotterGeneric> ret_Plotter;
+    
+    if ( 0 == strPlotType.compare( typePlot.m_strGraph ) ) {            ret_Plotter = make_shared<PlotterGraph>(); }
+    else if ( 0 == strPlotType.compare( typePlot.m_strGraph2D ) ) {     ret_Plotter = make_shared<PlotterGraph2D>(); }
+    else if ( 0 == strPlotType.compare( typePlot.m_strGraphErrors ) ) { ret_Plotter = make_shared<PlotterGraphErrors>(); }
+    else if ( 0 == strPlotType.compare( typePlot.m_strHisto ) ) {       ret_Plotter = make_shared<PlotterHisto>(); }
+    else if ( 0 == strPlotType.compare( typePlot.m_strHisto2D ) ) {     ret_Plotter = make_shared<PlotterHisto2D>(); }
+    
+    return ret_Plotter;
+} //End PlotterBatch::getPlotter()
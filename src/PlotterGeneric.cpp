@@ -23,15 +23,19 @@ using namespace QualityControl::Plotter;
 
 //Constructor
 PlotterGeneric::PlotterGeneric() :
-    m_canv(new TCanvas),
     m_tdrStyle(new TStyle) {
         m_bIsPrelim = true;
         m_bSaveCanvases = true;
+        m_bWriteRootFile = true;
+        m_bReleaseCanvas = false;
+        m_bExternalCanvas = false;
         m_iLogoPos = 10;
         
         m_strOutputFile_Name = "PlotterOutput.root";
         m_strOutputFile_Option = "UPDATE";
         
+        m_vec_strImgFormats = {"C", "eps", "pdf", "png"};
+        
         lumi.setDrawLogo(false);
         lumi.setPreliminary(true);
         
@@ -84,14 +88,36 @@ void PlotterGeneric::plotAndStore(){
     m_canv->GetFrame()->Draw();
 
     //Save output
-    write2RootFile();
+    if (m_bWriteRootFile) {
+        write2RootFile();
+    }
     if (m_bSaveCanvases) {
         save2ImgFile(m_canv);
     }
     
+    //Release the canvas if requested
+    if (m_bReleaseCanvas) {
+        releaseCanvas();
+    }
+    
     return;
 } //End PlotterGeneric::plotAndStore()
 
+//Clears the canvas & releases it (unless it was supplied with setCanvas())
+void PlotterGeneric::releaseCanvas(){
+    if (m_canv != nullptr) {
+        //Primitives owned by the canvas (legend, latex, logo) are deleted here
+        //Plots & fits are owned by this class and are only removed from the canvas
+        m_canv->Clear();
+        
+        if (!m_bExternalCanvas) { m_canv.reset(); }
+    }
+    
+    m_map_fits.clear();
+    
+    return;
+} //End PlotterGeneric::releaseCanvas()
+
 void PlotterGeneric::drawLatex(std::tuple<float, float, std::string> tupleTexLine){
     //Define the latexLine
     TLatex latex;
@@ -132,8 +158,16 @@ void PlotterGeneric::initCanv(){
     else if( m_iLogoPos%10==2 ){    strTempName += "_center"; }
     else if( m_iLogoPos%10==3 ){    strTempName += "_right"; }
     
-    m_canv = make_shared<TCanvas>(new TCanvas(strTempName.c_str(),m_canvInfo.m_strTitle.c_str(),m_canvInfo.m_iSize_X,m_canvInfo.m_iSize_Y ) );
-    m_canv->SetName( strTempName.c_str() );
+    if ( m_bExternalCanvas && m_canv != nullptr ) { //Case: Reuse the Supplied Canvas
+        m_canv->Clear();
+        m_canv->SetName( strTempName.c_str() );
+        m_canv->SetTitle( m_canvInfo.m_strTitle.c_str() );
+        m_canv->SetCanvasSize( m_canvInfo.m_iSize_X, m_canvInfo.m_iSize_Y );
+    } //End Case: Reuse the Supplied Canvas
+    else{ //Case: Create a New Canvas
+        m_canv = make_shared<TCanvas>(strTempName.c_str(),m_canvInfo.m_strTitle.c_str(),m_canvInfo.m_iSize_X,m_canvInfo.m_iSize_Y );
+        m_canv->SetName( strTempName.c_str() );
+    } //End Case: Create a New Canvas
 
     //Grid
     m_canv->cd()->SetGridx(m_canvInfo.m_bGrid_X);
@@ -268,17 +302,16 @@ void PlotterGeneric::performAndDrawFit(TLegend & inputLegend, InfoFit & fitInfo,
 	return;
 } //End PlotterGeneric::performAndDrawFit()
 
-//Saves inputCanv as a *.png file
+//Saves inputCanv in each of the formats stored in m_vec_strImgFormats
 //The file is placed in the working directory
 //The name of the file is the TName of the canvas
 void PlotterGeneric::save2ImgFile(std::shared_ptr<TCanvas> inputCanvas){
     //Variable Declaration
     string strName = inputCanvas->GetName();
 
-    inputCanvas->SaveAs( ( strName + ".C" ).c_str(), "RECREATE" );
-    inputCanvas->SaveAs( ( strName + ".eps" ).c_str(), "RECREATE" );
-    inputCanvas->SaveAs( ( strName + ".pdf" ).c_str(), "RECREATE" );
-    inputCanvas->SaveAs( ( strName + ".png" ).c_str(), "RECREATE" );
+    for (auto iterFormat = m_vec_strImgFormats.begin(); iterFormat != m_vec_strImgFormats.end(); ++iterFormat) {
+        inputCanvas->SaveAs( ( strName + "." + (*iterFormat) ).c_str(), "RECREATE" );
+    }
     
     return;
 } //End PlotterGeneric::save2ImgFile()
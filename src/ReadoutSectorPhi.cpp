@@ -29,6 +29,7 @@ ReadoutSectorPhi::ReadoutSectorPhi(const ReadoutSectorPhi & other){
     iStripNum_Max = other.iStripNum_Max;
     
     map_slices  = other.map_slices;
+    vec_iSliceByPosBin = other.vec_iSliceByPosBin;
     map_hits    = other.map_hits;
     map_clusters= other.map_clusters;
     
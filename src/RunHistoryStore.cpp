@@ -0,0 +1,236 @@
+//
+//  RunHistoryStore.cpp
+//  
+//
+//
+//
+
+#include "RunHistoryStore.h"
+
+using std::string;
+using std::vector;
+
+using namespace QualityControl::Uniformity;
+
+//Default Constructor
+RunHistoryStore::RunHistoryStore(){
+    iNBinsMax = 64;
+    iNBinsSketch = 50;
+    iRunsPerBin = 1;
+
+    fSketch_Lower = 0.;
+    fSketch_Upper = 1.;
+} //End Default Constructor
+
+//Sets the binning at construction
+RunHistoryStore::RunHistoryStore(int iNBinsMax, int iNBinsSketch, float fLower, float fUpper){
+    this->iNBinsMax = std::max(iNBinsMax, 2);
+    this->iNBinsSketch = std::max(iNBinsSketch, 1);
+    iRunsPerBin = 1;
+
+    fSketch_Lower = fLower;
+    fSketch_Upper = ( fUpper > fLower ) ? fUpper : fLower + 1.;
+} //End Constructor
+
+//Adds the history of inputStore after the runs already stored
+void RunHistoryStore::add(const RunHistoryStore & inputStore){
+    if ( inputStore.iNBinsSketch != iNBinsSketch ) { //Case: Binning Mismatch
+        printf("RunHistoryStore::add() - sketch binning mismatch (%i vs. %i bins); store not added\n", inputStore.iNBinsSketch, iNBinsSketch);
+
+        return;
+    } //End Case: Binning Mismatch
+
+    for (int i=0; i < inputStore.vec_binHistory.size(); ++i) { //Loop Over Input History Bins
+        const HistoryBin & binInput = inputStore.vec_binHistory[i];
+
+        //Same run as the last one stored? otherwise start it
+        if ( vec_binHistory.empty() || binInput.iRun_First != vec_binHistory.back().iRun_Last ) { startRun(binInput.iRun_First, binInput.iNRuns); }
+        else{ vec_binHistory.back().iNRuns += binInput.iNRuns - 1; }
+
+        HistoryBin & binCurrent = vec_binHistory.back();
+
+        binCurrent.iRun_Last = binInput.iRun_Last;
+        binCurrent.lCount   += binInput.lCount;
+        binCurrent.dSum     += binInput.dSum;
+        binCurrent.dSumSq   += binInput.dSumSq;
+
+        for (int j=0; j < iNBinsSketch; ++j) {
+            binCurrent.vec_fSketch[j] += binInput.vec_fSketch[j];
+        }
+    } //End Loop Over Input History Bins
+
+    return;
+} //End RunHistoryStore::add()
+
+//Clears the history, the binning is kept
+void RunHistoryStore::clear(){
+    vec_binHistory.clear();
+    iRunsPerBin = 1;
+
+    return;
+} //End RunHistoryStore::clear()
+
+//Merges neighbouring history bins pairwise & doubles iRunsPerBin
+void RunHistoryStore::downsample(){
+    //Variable Declaration
+    vector<HistoryBin> vec_binMerged;
+
+    for (int i=0; i < vec_binHistory.size(); i+=2) { //Loop Over Pairs of History Bins
+        HistoryBin binMerged = vec_binHistory[i];
+
+        if ( i+1 < vec_binHistory.size() ) { //Case: Pair Complete
+            const HistoryBin & binNext = vec_binHistory[i+1];
+
+            binMerged.iRun_Last = binNext.iRun_Last;
+            binMerged.iNRuns   += binNext.iNRuns;
+            binMerged.lCount   += binNext.lCount;
+            binMerged.dSum     += binNext.dSum;
+            binMerged.dSumSq   += binNext.dSumSq;
+
+            for (int j=0; j < iNBinsSketch; ++j) {
+                binMerged.vec_fSketch[j] += binNext.vec_fSketch[j];
+            }
+        } //End Case: Pair Complete
+
+        vec_binMerged.push_back(binMerged);
+    } //End Loop Over Pairs of History Bins
+
+    vec_binHistory.swap(vec_binMerged);
+    iRunsPerBin *= 2;
+
+    return;
+} //End RunHistoryStore::downsample()
+
+//Makes the last history bin the one of run iRun, starting a new bin if needed
+void RunHistoryStore::startRun(int iRun, int iNRunsInput){
+    //All history bins used & the last one is complete; merge pairwise (this may leave room in the last bin)
+    if ( vec_binHistory.size() == iNBinsMax && vec_binHistory.back().iNRuns >= iRunsPerBin ) { downsample(); }
+
+    if ( vec_binHistory.empty() || vec_binHistory.back().iNRuns >= iRunsPerBin ) { //Case: New History Bin
+        HistoryBin binNew;
+
+        binNew.iRun_First = iRun;
+        binNew.vec_fSketch.assign(iNBinsSketch, 0.);
+
+        vec_binHistory.push_back(binNew);
+    } //End Case: New History Bin
+
+    vec_binHistory.back().iRun_Last = iRun;
+    vec_binHistory.back().iNRuns += iNRunsInput;
+
+    return;
+} //End RunHistoryStore::startRun()
+
+//Adds fVal observed in run iRun
+void RunHistoryStore::fill(int iRun, float fVal){
+    //Variable Declaration
+    int iBinSketch;
+
+    //New run?
+    if ( vec_binHistory.empty() || iRun != vec_binHistory.back().iRun_Last ) { startRun(iRun, 1); }
+
+    //Fill
+    HistoryBin & binCurrent = vec_binHistory.back();
+
+    binCurrent.lCount++;
+    binCurrent.dSum     += fVal;
+    binCurrent.dSumSq   += (double)fVal * fVal;
+
+    iBinSketch = (int)std::floor( ( fVal - fSketch_Lower ) / ( fSketch_Upper - fSketch_Lower ) * iNBinsSketch );
+    iBinSketch = std::min( std::max(iBinSketch, 0), iNBinsSketch - 1);
+
+    binCurrent.vec_fSketch[iBinSketch] += 1.;
+
+    return;
+} //End RunHistoryStore::fill()
+
+//Returns the memory held by the store
+long RunHistoryStore::getBytes() const{
+    return sizeof(RunHistoryStore) + vec_binHistory.capacity() * ( sizeof(HistoryBin) + iNBinsSketch * sizeof(float) );
+} //End RunHistoryStore::getBytes()
+
+//Returns a TGraphErrors of the median & half the inter-quartile range of each history bin
+TGraphErrors RunHistoryStore::getGraphMedian(std::string strName) const{
+    //Variable Declaration
+    TGraphErrors ret_graph( vec_binHistory.size() );
+
+    ret_graph.SetName( strName.c_str() );
+
+    for (int i=0; i < vec_binHistory.size(); ++i) { //Loop Over History Bins
+        ret_graph.SetPoint(i, i + 1, getQuantile(i, 0.5) );
+        ret_graph.SetPointError(i, 0.5, 0.5 * ( getQuantile(i, 0.75) - getQuantile(i, 0.25) ) );
+    } //End Loop Over History Bins
+
+    return ret_graph;
+} //End RunHistoryStore::getGraphMedian()
+
+//Returns a TH2F of the quantile sketch of each history bin
+TH2F RunHistoryStore::getHisto2D(std::string strName, std::string strTitleY) const{
+    //Variable Declaration
+    int iNBinsX = std::max( (int)vec_binHistory.size(), 1);
+
+    TH2F ret_histo( strName.c_str(), "", iNBinsX, 0.5, iNBinsX + 0.5, iNBinsSketch, fSketch_Lower, fSketch_Upper);
+
+    ret_histo.SetDirectory(gROOT);
+    ret_histo.SetXTitle("Run Number");
+    ret_histo.SetYTitle( strTitleY.c_str() );
+
+    for (int i=0; i < vec_binHistory.size(); ++i) { //Loop Over History Bins
+        if ( vec_binHistory[i].iRun_First == vec_binHistory[i].iRun_Last ) {
+            ret_histo.GetXaxis()->SetBinLabel(i + 1, std::to_string( vec_binHistory[i].iRun_First ).c_str() );
+        }
+        else{
+            ret_histo.GetXaxis()->SetBinLabel(i + 1, ( std::to_string( vec_binHistory[i].iRun_First ) + "-" + std::to_string( vec_binHistory[i].iRun_Last ) ).c_str() );
+        }
+
+        for (int j=0; j < iNBinsSketch; ++j) {
+            ret_histo.SetBinContent(i + 1, j + 1, vec_binHistory[i].vec_fSketch[j] );
+            ret_histo.SetBinError(i + 1, j + 1, std::sqrt( vec_binHistory[i].vec_fSketch[j] ) );
+        }
+    } //End Loop Over History Bins
+
+    return ret_histo;
+} //End RunHistoryStore::getHisto2D()
+
+//Returns the mean of history bin iBin
+float RunHistoryStore::getMean(int iBin) const{
+    if ( !(vec_binHistory[iBin].lCount > 0) ) return 0.;
+
+    return vec_binHistory[iBin].dSum / vec_binHistory[iBin].lCount;
+} //End RunHistoryStore::getMean()
+
+//Returns the fProb quantile of history bin iBin; linear interpolation within the sketch bin reaching fProb
+float RunHistoryStore::getQuantile(int iBin, float fProb) const{
+    //Variable Declaration
+    double dTarget, dCumulative = 0.;
+
+    float fBinWidth = ( fSketch_Upper - fSketch_Lower ) / iNBinsSketch;
+
+    const HistoryBin & binInput = vec_binHistory[iBin];
+
+    if ( !(binInput.lCount > 0) ) return 0.;
+
+    dTarget = fProb * binInput.lCount;
+
+    for (int j=0; j < iNBinsSketch; ++j) { //Loop Over Sketch Bins
+        if ( binInput.vec_fSketch[j] > 0 && dCumulative + binInput.vec_fSketch[j] >= dTarget ) {
+            return fSketch_Lower + fBinWidth * ( j + ( dTarget - dCumulative ) / binInput.vec_fSketch[j] );
+        }
+
+        dCumulative += binInput.vec_fSketch[j];
+    } //End Loop Over Sketch Bins
+
+    return fSketch_Upper;
+} //End RunHistoryStore::getQuantile()
+
+//Returns the standard deviation of history bin iBin
+float RunHistoryStore::getStdDev(int iBin) const{
+    //Variable Declaration
+    double dMean;
+
+    if ( !(vec_binHistory[iBin].lCount > 1) ) return 0.;
+
+    dMean = vec_binHistory[iBin].dSum / vec_binHistory[iBin].lCount;
+
+    return std::sqrt( std::max( vec_binHistory[iBin].dSumSq / vec_binHistory[iBin].lCount - dMean * dMean, 0. ) );
+} //End RunHistoryStore::getStdDev()
@@ -0,0 +1,92 @@
+#include "SRSAPVContext.h"
+#include <map>
+#include <iostream>
+#include "SRSAPVEvent.h"
+#include "SRSMapping.h"
+#include "SRSPedestal.h"
+
+//============================================================================================
+// Same defaults as the SRSAPVEvent constructor had before the mapping lookups
+SRSAPVContext::SRSAPVContext() {
+  fFECNo = 0, fADCChannel = 0, fAPVID = 0, fAPVKey = 0 ;
+
+  fPlane        = "GEM1X" ;
+  fDetector     = "GEM1" ;
+  fReadoutBoard = "CARTESIAN" ;
+  fDetectorType = "STANDARD" ;
+
+  fPlaneSize         = 102.4 ;
+  fAPVIndexOnPlane   = 2 ;
+  fAPVOrientation    = 0 ;
+  fAPVstripmapping   = 0 ;
+  fAPVHeaderLevel    = 1300 ;
+  fNbOfAPVsFromPlane = 0 ;
+  fEtaSectorPos      = 0 ;
+
+  fTrapezoidDetLength      = 0 ;
+  fTrapezoidDetOuterRadius = 430.0 ;
+  fTrapezoidDetInnerRadius = 220.0 ;
+
+  fPitch       = 0 ;
+  fStripOffset = 0 ;
+
+  for (int chNo = 0; chNo < NCH; chNo++) {
+    fStripNoFromChNo[chNo] = chNo ;
+    fPadNoFromChNo[chNo]   = 0 ;
+  }
+  fIsPedestalLoaded = false ;
+}
+
+//============================================================================================
+SRSAPVContextTable::SRSAPVContextTable() {
+  fIndexFromAPVID.assign(kNbOfFECs * kNbOfADCChannels, -1) ;
+  fActiveChannels.assign(kNbOfFECs, 0) ;
+  fNbOfMaskedAPVs = 0 ;
+}
+
+//============================================================================================
+void SRSAPVContextTable::Build(SRSPedestal * ped, float apvMaskFraction) {
+  SRSMapping * mapping = SRSMapping::GetInstance() ;
+  std::map <int, int> apvNoFromApvIDMap = mapping->GetAPVNoFromIDMap() ;
+
+  fContexts.clear() ;
+  fIndexFromAPVID.assign(kNbOfFECs * kNbOfADCChannels, -1) ;
+  fActiveChannels.assign(kNbOfFECs, 0) ;
+  fNbOfMaskedAPVs = 0 ;
+  fContexts.resize(apvNoFromApvIDMap.size()) ;
+
+  int index = 0 ;
+  std::map <int, int>::const_iterator apvID_itr ;
+  for (apvID_itr = apvNoFromApvIDMap.begin(); apvID_itr != apvNoFromApvIDMap.end(); ++apvID_itr) {
+    int apvID = (* apvID_itr).first ;
+    int fecNo = (apvID >> 4) & 0xF, adcChannel = apvID & 0xF ;
+    SRSAPVContext & context = fContexts[index] ;
+    SRSAPVEvent::BuildContext(fecNo, adcChannel, apvID, context) ;
+    fIndexFromAPVID[(fecNo << 4) | adcChannel] = index++ ;
+
+    bool isMasked = false ;
+    if (ped && ped->IsAPVLoaded(apvID)) {
+      context.fIsPedestalLoaded = true ;
+      context.fPedestalOffsets  = ped->GetAPVOffsets(apvID) ;
+      context.fPedestalNoises   = ped->GetAPVNoises(apvID) ;
+      context.fMaskedChannels   = ped->GetAPVMaskedChannels(apvID) ;
+
+      //=== Dead or noisy APV: too many of its channels masked by the pedestal run
+      if (apvMaskFraction > 0) {
+        int nbOfMaskedChannels = 0 ;
+        for (unsigned int chNo = 0; chNo < context.fMaskedChannels.size(); chNo++) {
+          if (context.fMaskedChannels[chNo] > 0) nbOfMaskedChannels++ ;
+        }
+        isMasked = (nbOfMaskedChannels >= apvMaskFraction * NCH) ;
+      }
+    }
+
+    if (isMasked) {
+      printf("SRSAPVContextTable::Build() ==> APV %s (fec %d, channel %d) masked\n", context.fAPV.c_str(), fecNo, adcChannel) ;
+      fNbOfMaskedAPVs++ ;
+      continue ;
+    }
+    fActiveChannels[fecNo] |= (1 << adcChannel) ;
+  }
+  printf("SRSAPVContextTable::Build() ==> %d APV contexts built, %d masked\n", (int) fContexts.size(), fNbOfMaskedAPVs) ;
+}
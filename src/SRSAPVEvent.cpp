@@ -1,110 +1,148 @@
 #include <cmath>
+#include <cstring>
+#include <algorithm>
 #include "SRSAPVEvent.h"
+#include "Logger.h"
 
 
 //=====================================================
+// Stand alone APV (pedestal runs, no context table): the mapping is looked up for this APV only
 SRSAPVEvent::SRSAPVEvent(int fec_no, int fec_channel, int apv_id, int zeroSupCut, int packetSize) {
+  fOwnedContext = new SRSAPVContext ;
+  BuildContext(fec_no, fec_channel, apv_id, * fOwnedContext) ;
+  InitFromContext(fOwnedContext, zeroSupCut, packetSize) ;
+}
+
+//=====================================================
+// APV of a per run SRSAPVContextTable: no mapping lookup at all
+SRSAPVEvent::SRSAPVEvent(const SRSAPVContext * context, int zeroSupCut, int packetSize) {
+  fOwnedContext = 0 ;
+  InitFromContext(context, zeroSupCut, packetSize) ;
+}
+
+//=====================================================
+void SRSAPVEvent::InitFromContext(const SRSAPVContext * context, int zeroSupCut, int packetSize) {
   this->Clear() ;
-  SRSMapping * mapping = SRSMapping::GetInstance();
-  
-  fPlane        = "GEM1X" ;
-  fDetector     = "GEM1" ;
-  fReadoutBoard = "CARTESIAN" ;
-  fDetectorType = "STANDARD" ;
-  
-  fPlaneSize       = 102.4 ;
-  fAPVIndexOnPlane = 2;
-  fAPVOrientation  = 0 ;
-  fAPVstripmapping = 0 ;
-  fAPVstripmapping = 0 ;
-  fAPVHeaderLevel  = 1300 ;
-  fEtaSectorPos = 0 ;
-  
-  fTrapezoidDetOuterRadius = 430.0 ;
-  fTrapezoidDetInnerRadius = 220.0 ;
-  
+  fContext = context ;
+
   fPedSubFlag           = false ;
   fCommonModeFlag       = false ;
   fIsCosmicRunFlag      = false ;
   fIsPedestalRunFlag    = false ;
   fIsRawPedestalRunFlag = false ;
-  
-  fFECNo = fec_no ;
-  fAPVID = apv_id ;
-  
-  fADCChannel = fec_channel ;
-  fPacketSize = packetSize;
-  
-  fAPVGain = 1.0 ;
-  
-  fZeroSupCut = zeroSupCut ;
-  fMeanAPVnoise = 0;
-  
-  fAPVKey          = mapping->GetAPVNoFromID(apv_id);
-  fAPV             = mapping->GetAPVFromID(apv_id);
-  fAPVHeaderLevel  = mapping->GetAPVHeaderLevelFromID(apv_id);
-  fAPVIndexOnPlane = mapping->GetAPVIndexOnPlane(apv_id);
-  fAPVOrientation  = mapping->GetAPVOrientation(apv_id);
-  fAPVstripmapping = mapping->GetAPVstripmapping(apv_id);
 
-    
-  fPlane        = mapping->GetDetectorPlaneFromAPVID(apv_id);
-  fDetector     = mapping->GetDetectorFromPlane(fPlane) ;
-  fReadoutBoard = mapping->GetReadoutBoardFromDetector(fDetector) ;
-  fDetectorType = mapping->GetDetectorTypeFromDetector(fDetector) ;
-  
-    
-  if(fReadoutBoard == "CARTESIAN") {
-    fPlaneSize         = (mapping->GetCartesianReadoutMap(fPlane))[1];
-    fNbOfAPVsFromPlane = (int) ((mapping->GetCartesianReadoutMap(fPlane)) [2]) ;
-    fPadDetectorMap.resize(5) ;
-        //    printf("SRSAPVEvent::SRSAPVEvent  detType=%s, plane=%s, planeSize=%f, fNbOfAPVsFromPlane=%d\n", fDetectorType.Data(), fPlane.Data(), fPlaneSize, fNbOfAPVsFromPlane) ;
-    }
-    
-    if(fReadoutBoard == "UV_ANGLE") {
-        fTrapezoidDetLength      = (mapping->GetUVangleReadoutMap(fDetector)) [0] ;
-        fTrapezoidDetInnerRadius = (mapping->GetUVangleReadoutMap(fDetector)) [1] ;
-        fTrapezoidDetOuterRadius = (mapping->GetUVangleReadoutMap(fDetector)) [2] ;
-        fNbOfAPVsFromPlane = (int) ((mapping->GetUVangleReadoutMap(fPlane)) [1]) ;
-        fPadDetectorMap.resize(5) ;
-        //    printf("SRSAPVEvent::SRSAPVEvent => fDetector =%s,  fPlane=%s, detLength=%f, innerRadius=%f, outerRadius=%f, fNbOfAPVsFromPlane=%d \n",fDetector.Data(), fPlane.Data(), fTrapezoidDetLength, fTrapezoidDetInnerRadius, fTrapezoidDetOuterRadius, fNbOfAPVsFromPlane);
-    }
-    
-    if(fReadoutBoard == "1DSTRIPS") {
-        fPlaneSize = (mapping->Get1DStripsReadoutMap(fPlane)) [1] ;
-        fNbOfAPVsFromPlane = (int) ((mapping->Get1DStripsReadoutMap(fPlane)) [2]) ;
-        fPadDetectorMap.resize(5) ;
-        //    printf("SRSAPVEvent::SRSAPVEvent  fPlane=%s, planeSize=%f, fNbOfAPVsFromPlane=%d \n", fPlane.Data(), fPlaneSize, fNbOfAPVsFromPlane);
-    }
-    
-    if(fReadoutBoard == "CMSGEM") {
-        fEtaSectorPos = (mapping->GetCMSGEMReadoutMap(fPlane)) [0] ;
-        fPlaneSize    = (mapping->GetCMSGEMReadoutMap(fPlane)) [1] ;
-        fNbOfAPVsFromPlane = (int) ((mapping->GetCMSGEMReadoutMap(fPlane)) [2]) ;
-        fPadDetectorMap.resize(5) ;
-	//printf("SRSAPVEvent::SRSAPVEvent   fPlane=%s, etaSectorPos=%f, planeSize=%f, fNbOfAPVsFromPlane=%d, \n", fPlane.c_str(), fEtaSectorPos, fPlaneSize, fNbOfAPVsFromPlane);
+  fPacketSize   = packetSize ;
+  fAPVGain      = 1.0 ;
+  fZeroSupCut   = zeroSupCut ;
+  fMeanAPVnoise = 0 ;
+
+  fFECNo      = context->fFECNo ;
+  fADCChannel = context->fADCChannel ;
+  fAPVID      = context->fAPVID ;
+  fAPVKey     = context->fAPVKey ;
+  fAPV        = context->fAPV ;
+
+  fAPVHeaderLevel    = context->fAPVHeaderLevel ;
+  fAPVIndexOnPlane   = context->fAPVIndexOnPlane ;
+  fAPVOrientation    = context->fAPVOrientation ;
+  fAPVstripmapping   = context->fAPVstripmapping ;
+  fNbOfAPVsFromPlane = context->fNbOfAPVsFromPlane ;
+
+  fPlane        = context->fPlane ;
+  fDetector     = context->fDetector ;
+  fReadoutBoard = context->fReadoutBoard ;
+  fDetectorType = context->fDetectorType ;
+
+  fPlaneSize               = context->fPlaneSize ;
+  fEtaSectorPos            = context->fEtaSectorPos ;
+  fTrapezoidDetLength      = context->fTrapezoidDetLength ;
+  fTrapezoidDetInnerRadius = context->fTrapezoidDetInnerRadius ;
+  fTrapezoidDetOuterRadius = context->fTrapezoidDetOuterRadius ;
+  fPadDetectorMap          = context->fPadDetectorMap ;
+}
+
+//=====================================================
+// All the SRSMapping lookups of one APV, done once per run by SRSAPVContextTable::Build()
+void SRSAPVEvent::BuildContext(int fec_no, int fec_channel, int apv_id, SRSAPVContext & context) {
+  SRSMapping * mapping = SRSMapping::GetInstance();
+
+  context.fFECNo      = fec_no ;
+  context.fADCChannel = fec_channel ;
+  context.fAPVID      = apv_id ;
+
+  context.fAPVKey          = mapping->GetAPVNoFromID(apv_id);
+  context.fAPV             = mapping->GetAPVFromID(apv_id);
+  context.fAPVHeaderLevel  = mapping->GetAPVHeaderLevelFromID(apv_id);
+  context.fAPVIndexOnPlane = mapping->GetAPVIndexOnPlane(apv_id);
+  context.fAPVOrientation  = mapping->GetAPVOrientation(apv_id);
+  context.fAPVstripmapping = mapping->GetAPVstripmapping(apv_id);
+
+  context.fPlane        = mapping->GetDetectorPlaneFromAPVID(apv_id);
+  context.fDetector     = mapping->GetDetectorFromPlane(context.fPlane) ;
+  context.fReadoutBoard = mapping->GetReadoutBoardFromDetector(context.fDetector) ;
+  context.fDetectorType = mapping->GetDetectorTypeFromDetector(context.fDetector) ;
+
+  const std::string & plane        = context.fPlane ;
+  const std::string & detector     = context.fDetector ;
+  const std::string & readoutBoard = context.fReadoutBoard ;
+
+  if(readoutBoard == "CARTESIAN") {
+    context.fPlaneSize         = (mapping->GetCartesianReadoutMap(plane))[1];
+    context.fNbOfAPVsFromPlane = (int) ((mapping->GetCartesianReadoutMap(plane)) [2]) ;
+    context.fPadDetectorMap.resize(5) ;
+  }
+
+  if(readoutBoard == "UV_ANGLE") {
+    context.fTrapezoidDetLength      = (mapping->GetUVangleReadoutMap(detector)) [0] ;
+    context.fTrapezoidDetInnerRadius = (mapping->GetUVangleReadoutMap(detector)) [1] ;
+    context.fTrapezoidDetOuterRadius = (mapping->GetUVangleReadoutMap(detector)) [2] ;
+    context.fNbOfAPVsFromPlane = (int) ((mapping->GetUVangleReadoutMap(plane)) [1]) ;
+    context.fPadDetectorMap.resize(5) ;
+  }
+
+  if(readoutBoard == "1DSTRIPS") {
+    context.fPlaneSize = (mapping->Get1DStripsReadoutMap(plane)) [1] ;
+    context.fNbOfAPVsFromPlane = (int) ((mapping->Get1DStripsReadoutMap(plane)) [2]) ;
+    context.fPadDetectorMap.resize(5) ;
+  }
+
+  if(readoutBoard == "CMSGEM") {
+    context.fEtaSectorPos = (mapping->GetCMSGEMReadoutMap(plane)) [0] ;
+    context.fPlaneSize    = (mapping->GetCMSGEMReadoutMap(plane)) [1] ;
+    context.fNbOfAPVsFromPlane = (int) ((mapping->GetCMSGEMReadoutMap(plane)) [2]) ;
+    context.fPadDetectorMap.resize(5) ;
+  }
+
+  else if(readoutBoard == "PADPLANE") {
+    std::vector< int> apvChPadCh = mapping->GetPadChannelsMapping(apv_id) ;
+    std::vector< int>::const_iterator apvChPadCh_itr ;
+    for (apvChPadCh_itr = apvChPadCh.begin(); apvChPadCh_itr != apvChPadCh.end(); ++apvChPadCh_itr) {
+      int padCh = ((* apvChPadCh_itr) >> 8) & 0xffff ;
+      int apvCh = (* apvChPadCh_itr) & 0xff ;
+      if (apvCh < NCH) context.fPadNoFromChNo[apvCh] = padCh ;
     }
-    
-    else if(fReadoutBoard == "PADPLANE") {
-      std::vector< int> apvChPadCh = mapping->GetPadChannelsMapping(apv_id) ;
-      std::vector< int>::const_iterator apvChPadCh_itr ;
-      for (apvChPadCh_itr = apvChPadCh.begin(); apvChPadCh_itr != apvChPadCh.end(); ++apvChPadCh_itr) {
-	int apvChPadCh = * apvChPadCh_itr ;
-	int padCh =  (apvChPadCh >> 8) & 0xffff ;
-	int apvCh = apvChPadCh & 0xff ;
-	fapvChToPadChMap[apvCh] = padCh ;
-	fPadDetectorMap = mapping->GetPadDetectorMap(fDetector) ;
-	fPadDetectorMap.resize(5) ;
-      }
+    if (!apvChPadCh.empty()) {
+      context.fPadDetectorMap = mapping->GetPadDetectorMap(detector) ;
+      context.fPadDetectorMap.resize(5) ;
     }
-    //  printf("SRSAPVEvent::SRSAPVEvent   fPlane=%s, etaSectorPos=%f, planeSize=%f, fNbOfAPVsFromPlane=%d, \n", fPlane.Data(), fEtaSectorPos, fPlaneSize, fNbOfAPVsFromPlane) ;
+  }
+
+  if (context.fNbOfAPVsFromPlane > 0) {
+    context.fPitch       = context.fPlaneSize / (NCH * context.fNbOfAPVsFromPlane) ;
+    context.fStripOffset = NCH * (context.fAPVIndexOnPlane % context.fNbOfAPVsFromPlane) ;
+  }
+
+  //=== The strip mapping only depends on the detector type and the APV strip mapping
+  SRSAPVEvent apvEvent(&context, 0, 0) ;
+  for (int chNo = 0; chNo < NCH; chNo++) context.fStripNoFromChNo[chNo] = apvEvent.StripMapping(chNo) ;
 }
 
 //=====================================================
 void SRSAPVEvent::Clear() {
     fRawData32bits.clear() ;
     fRawData16bits.clear() ;
-    fapvTimeBinDataMap.clear() ;
+    fTimeBinData.clear() ;
+    fNbTimeBins = 0 ;
     fPedestalData.clear() ;
     fRawPedestalData.clear() ;
     fMaskedChannels.clear() ;
@@ -121,6 +159,7 @@ void SRSAPVEvent::Clear() {
 //=====================================================
 SRSAPVEvent::~SRSAPVEvent(){
     Clear() ;
+    delete fOwnedContext ;
 }
 
 //=====================================================
@@ -387,155 +426,94 @@ void SRSAPVEvent::ComputeRawData16bitsZS() {
 }
 
 //=====================================================
+// Copies a per strip vector (pedestal offsets, noises, masks) into a contiguous NCH array, 0 if it was not loaded
+static void CopyStripArray(const std::vector<float> & stripVect, float * stripArray) {
+    if ((int) stripVect.size() < NCH) {
+        std::memset(stripArray, 0, NCH * sizeof(float)) ;
+        return ;
+    }
+    std::memcpy(stripArray, &stripVect[0], NCH * sizeof(float)) ;
+}
+
+//=====================================================
+// Common mode of one time bin over the strips [firstStrip, lastStrip): the median of the pedestal subtracted data of
+// the unmasked strips (found with nth_element, no sort), refined into the mean over the strips below zeroSupCut * noise
+// so the strips with a signal do not pull the baseline up. Without noises the median is returned
+float SRSAPVEvent::ComputeCommonMode(const float * data, const float * offsets, const float * noises, const float * masks, int firstStrip, int lastStrip, float zeroSupCut) {
+    float pedSubData[NCH] ;
+    int nbStrips = 0 ;
+    for (int stripNo = firstStrip; stripNo < lastStrip; stripNo++) {
+        if (masks[stripNo] == 0) pedSubData[nbStrips++] = data[stripNo] - offsets[stripNo] ;
+    }
+    if (nbStrips == 0) return 0 ;
+
+    std::nth_element(pedSubData, pedSubData + nbStrips / 2, pedSubData + nbStrips) ;
+    float median = pedSubData[nbStrips / 2] ;
+    if (!noises) return median ;
+
+    //=== Branch free so the loop vectorizes
+    float sum = 0, nbBelow = 0 ;
+    for (int stripNo = firstStrip; stripNo < lastStrip; stripNo++) {
+        float value = data[stripNo] - offsets[stripNo] ;
+        float below = ((masks[stripNo] == 0) && (value - median < zeroSupCut * noises[stripNo])) ? 1 : 0 ;
+        sum     += below * value ;
+        nbBelow += below ;
+    }
+    if (nbBelow == 0) return median ;
+    return sum / nbBelow ;
+}
+
+//=====================================================
+// Unpacks the frame into the flat fTimeBinData [timebin * NCH + stripNo] and computes the common mode of each time bin,
+// for the EICPROTO1 UV_ANGLE readout separately for the strips of the top (even) and bottom (odd) plane
 void SRSAPVEvent::ComputeTimeBinCommonMode() {
     // printf("  SRSAPVEvent::ComputeTimeBinCommonMode()==>enter \n") ;
-    
-    int idata = 0  ;
-    bool startDataFlag = false ;
-    
-    fapvTimeBinDataMap.clear() ;
-    unsigned int apvheaderlevel = (unsigned int)  fAPVHeaderLevel ;
     int size = fRawData16bits.size() ;
-    
     if (size != fPacketSize) {
-        printf("SRSAPVEvent::ComputeTimeBinCommonMode() XXXX ERROR XXXXX ==> Packet size %d different from expected %d, header=%d \n",size,fPacketSize, fAPVHeaderLevel ) ;
+        QualityControl::Uniformity::Logger::getInstance().logf(QualityControl::Uniformity::kLogWarning, "SRSAPVEvent::ComputeTimeBinCommonMode()", "packet size %d different from expected %d, header=%d", size, fPacketSize, fAPVHeaderLevel) ;
     }
-    
-    std::list<float> commonModeOffset,  commonModeOffset_odd, commonModeOffset_even ;
 
-    float vtot = 0;
-    for (std::vector<float>::iterator i=fPedestalOffsets.begin();i<fPedestalOffsets.end();i++){
-      vtot+=*i;
-    }
-    //    float apvBaseline = 4096 - TMath::Mean(fPedestalOffsets.begin(), fPedestalOffsets.end()) ;
-    float apvBaseline = 4096 - vtot/float(fPedestalOffsets.size());
-    
-    while(idata < size) {
-        //    printf("    SRSAPVEvent::ComputeTimeBinCommonMode()  ==> idata=%d, apvBaseline=%f \n",idata, apvBaseline) ;
-        //===============================================================//
-        // If 3 consecutive words satisfy this condition below => it is  //
-        // an APV header so we could take meaninfull data                //
-        //===============================================================//
-        if (fRawData16bits[idata] < apvheaderlevel ) {
-            idata++ ;
-            if (fRawData16bits[idata] < apvheaderlevel ) {
-                idata++ ;
-                if (fRawData16bits[idata] < apvheaderlevel ) {
-                    idata += 10;
-                    startDataFlag = true ;
-                    continue ;
-                }
+    fCommonModeOffsets.clear(), fCommonModeOffsets_odd.clear(), fCommonModeOffsets_even.clear() ;
+    fNbTimeBins = UnpackTimeBinRawData(fTimeBinData) ;
+
+    bool isEICUVAngle = (fReadoutBoard == "UV_ANGLE") && (fDetectorType == "EICPROTO1") ;
+
+    //=== Pedestal run: the raw pedestals are used, raw pedestal run: no common mode at all
+    const std::vector<float> & pedestalOffsets = fIsPedestalRunFlag ? fRawPedestalOffsets : PedestalOffsets() ;
+    const std::vector<float> & pedestalNoises  = fIsPedestalRunFlag ? fRawPedestalNoises  : PedestalNoises() ;
+
+    float offsets[NCH], noises[NCH], masks[NCH] ;
+    CopyStripArray(pedestalOffsets, offsets) ;
+    CopyStripArray(pedestalNoises, noises) ;
+    CopyStripArray(MaskedChannels(), masks) ;
+    const float * noisesIfLoaded = ((int) pedestalNoises.size() < NCH) ? 0 : noises ;
+
+    float zeroSupCut = (fZeroSupCut > 0) ? fZeroSupCut : 5 ;
+
+    for (int timebin = 0; timebin < fNbTimeBins; timebin++) {
+        const float * data = &fTimeBinData[timebin * NCH] ;
+
+        if (isEICUVAngle) {
+            float commMode_even = 0, commMode_odd = 0 ;
+            if (!fIsRawPedestalRunFlag) {
+                commMode_even = ComputeCommonMode(data, offsets, noisesIfLoaded, masks, 0, NCH / 2, zeroSupCut) ;
+                commMode_odd  = ComputeCommonMode(data, offsets, noisesIfLoaded, masks, NCH / 2, NCH, zeroSupCut) ;
             }
+            fCommonModeOffsets_even.push_back(commMode_even) ;
+            fCommonModeOffsets_odd.push_back(commMode_odd) ;
         }
-        
-        //===============================================================//
-        // That's where the meaninfull data are taken                    //
-        // 128 analog word for each apv strip and each timebin           //
-        //===============================================================//
-        if (startDataFlag == true) {
-            commonModeOffset.clear(), commonModeOffset_odd.clear(), commonModeOffset_even.clear() ;
-            
-            float commMode      = 0 ;
-            float commMode_odd  = 0 ;
-            float commMode_even = 0 ;
-            
-            for(int chNo = 0; chNo < NCH; ++chNo) {
-                
-                int stripNo = StripMapping(chNo) ;
-                
-                float rawdata = ((float) fRawData16bits[idata]) ;
-                float comMode = rawdata ;
-                
-                float thresohld = 500 ;
-                if ((fReadoutBoard == "UV_ANGLE") &&  (fDetectorType == "EICPROTO1") ) thresohld = 500 	;
-                
-                if (fabs(comMode - apvBaseline) > thresohld) {
-                    comMode = apvBaseline ;
-                }
-                
-                rawdata = 4096 - rawdata ;
-                comMode = 4096 - comMode ;
-                
-                if (fIsCosmicRunFlag) {
-                    if ((fReadoutBoard == "UV_ANGLE") &&  (fDetectorType == "EICPROTO1") ) {
-                        if(stripNo < 64) commonModeOffset_even.push_back(comMode - fPedestalOffsets[stripNo]) ;
-                        else             commonModeOffset_odd.push_back(comMode - fPedestalOffsets[stripNo]) ;
-                    }
-                    else {
-                        commonModeOffset.push_back(comMode - fPedestalOffsets[stripNo]) ;
-                    }
-                }
-                
-                if (fIsPedestalRunFlag) {
-                    if ((fReadoutBoard == "UV_ANGLE") &&  (fDetectorType == "EICPROTO1") ) {
-                        if(stripNo < 64) commonModeOffset_even.push_back(comMode - fRawPedestalOffsets[stripNo]) ;
-                        else             commonModeOffset_odd.push_back(comMode - fRawPedestalOffsets[stripNo]) ;
-                    }
-                    else {
-                        commonModeOffset.push_back(comMode - fRawPedestalOffsets[stripNo]) ;
-                    }
-                }
-                fapvTimeBinDataMap.insert(std::pair<int, float>(stripNo, rawdata)) ;
-                idata++ ;
-            }
-            
-            if ((fReadoutBoard == "UV_ANGLE") &&  (fDetectorType == "EICPROTO1") ) {
-                commonModeOffset_odd.sort() ;
-                commonModeOffset_even.sort() ;
-                
-		float ovtot = 0;
-		for (std::list<float>::iterator i=commonModeOffset_odd.begin();i!=commonModeOffset_odd.end();i++){
-		  ovtot+=*i;
-		}
-                commMode_odd  = ovtot/float(commonModeOffset_odd.size());
-		  //TMath::Mean(commonModeOffset_odd.begin(),commonModeOffset_odd.end()) ;
-		float evtot = 0;
-		for (std::list<float>::iterator i=commonModeOffset_even.begin();i!=commonModeOffset_even.end();i++){
-		  evtot+=*i;
-		}
-                commMode_even  = evtot/float(commonModeOffset_even.size());
-		//                commMode_even = TMath::Mean(commonModeOffset_even.begin(),commonModeOffset_even.end()) ;
-                commonModeOffset_odd.clear() ;
-                commonModeOffset_even.clear() ;
-            }
-            else {
-                commonModeOffset.sort() ;
-		float vtot = 0;
-		for (std::list<float>::iterator i=commonModeOffset.begin();i!=commonModeOffset.end();i++){
-		  vtot+=*i;
-		}
-                commMode = vtot/float(commonModeOffset.size());
-		//                commMode = TMath::Mean(commonModeOffset.begin(),commonModeOffset.end()) ;
-                commonModeOffset.clear() ;
-            }
-            
-            if (fIsRawPedestalRunFlag) {
-                if ((fReadoutBoard == "UV_ANGLE") &&  (fDetectorType == "EICPROTO1") ) {
-                    fCommonModeOffsets_odd.push_back(0) ;
-                    fCommonModeOffsets_even.push_back(0) ;
-                }
-                else {
-                    fCommonModeOffsets.push_back(0) ;
-                }
-            }
-            else {
-                if ((fReadoutBoard == "UV_ANGLE") &&  (fDetectorType == "EICPROTO1") ) {
-                    fCommonModeOffsets_odd.push_back(commMode_odd) ;
-                    fCommonModeOffsets_even.push_back(commMode_even) ;
-                }
-                else {
-                    fCommonModeOffsets.push_back(commMode) ;
-                }
-            }
-            startDataFlag = false ;
-            continue ;
+        else {
+            float commMode = 0 ;
+            if (!fIsRawPedestalRunFlag) commMode = ComputeCommonMode(data, offsets, noisesIfLoaded, masks, 0, NCH, zeroSupCut) ;
+            fCommonModeOffsets.push_back(commMode) ;
         }
-        idata++ ;
     }
     //  printf("  SRSAPVEvent::ComputeTimeBinCommonMode()==>exit \n") ;
 }
 
 //===================================================================
+// Non ZS frame: pedestal, common mode, mask and gain corrections then the fZeroSupCut * fPedestalNoises threshold test,
+// all as loops over the contiguous [timebin * NCH + stripNo] data; only the strips kept become SRSHits
 std::list <SRSHit * >  SRSAPVEvent::ComputeListOfAPVHits() {
     //  printf("SRSAPVEvent::ComputeListOfAPVHits()==> enter \n") ;
     
@@ -547,159 +525,125 @@ std::list <SRSHit * >  SRSAPVEvent::ComputeListOfAPVHits() {
     ComputeTimeBinCommonMode() ;
     std::list <SRSHit * > listOfHits ;
     
-    int apvTimeBinDataMapSize = fapvTimeBinDataMap.size() ;
+    if (fNbTimeBins == 0) return listOfHits ;
+
+    bool isEICUVAngle = (fReadoutBoard == "UV_ANGLE") && (fDetectorType == "EICPROTO1") ;
+    int nbSegments = isEICUVAngle ? 2 : 1 ;
+
+    //=== Per strip corrections: offset to subtract and (1 - mask) / gain
+    float offsets[NCH], noises[NCH], masks[NCH], scales[NCH] ;
+    CopyStripArray(PedestalOffsets(), offsets) ;
+    CopyStripArray(PedestalNoises(), noises) ;
+    CopyStripArray(MaskedChannels(), masks) ;
+    for (int stripNo = 0; stripNo < NCH; stripNo++) {
+        if (!fPedSubFlag) offsets[stripNo] = 0 ;
+        scales[stripNo] = (1 - masks[stripNo]) / fAPVGain ;
+    }
+
+    //=== Baseline correction, in place
+    for (int timebin = 0; timebin < fNbTimeBins; timebin++) {
+        float * data = &fTimeBinData[timebin * NCH] ;
+        for (int segment = 0; segment < nbSegments; segment++) {
+            float commonMode = 0 ;
+            if (fCommonModeFlag) {
+                if (isEICUVAngle) commonMode = (segment == 0) ? fCommonModeOffsets_even[timebin] : fCommonModeOffsets_odd[timebin] ;
+                else              commonMode = fCommonModeOffsets[timebin] ;
+            }
+            int lastStrip = (segment + 1) * NCH / nbSegments ;
+            for (int stripNo = segment * NCH / nbSegments; stripNo < lastStrip; stripNo++) {
+                data[stripNo] = (data[stripNo] - commonMode - offsets[stripNo]) * scales[stripNo] ;
+            }
+        }
+    }
+
+    //=== Mean & max over the time bins and threshold test of each strip
+    float stripMean[NCH], stripMax[NCH], stripThreshold[NCH] ;
+    std::memset(stripMean, 0, sizeof(stripMean)) ;
+    std::memset(stripMax, 0, sizeof(stripMax)) ;
+    for (int timebin = 0; timebin < fNbTimeBins; timebin++) {
+        const float * data = &fTimeBinData[timebin * NCH] ;
+        for (int stripNo = 0; stripNo < NCH; stripNo++) {
+            stripMean[stripNo] += data[stripNo] ;
+            stripMax[stripNo]   = std::max(stripMax[stripNo], data[stripNo]) ;
+        }
+    }
+    float zeroSupCut = (fZeroSupCut > 0) ? fZeroSupCut : 5 ;
+    for (int stripNo = 0; stripNo < NCH; stripNo++) {
+        stripMean[stripNo]      = stripMean[stripNo] / float(fNbTimeBins) ;
+        stripThreshold[stripNo] = zeroSupCut * noises[stripNo] ;
+    }
+
     int padNo = 0 ;
     std::string plane = fPlane ;
+    std::vector <float> stripPedestalNoise ;
     
-    if (apvTimeBinDataMapSize != 0) {
-        std::vector <float> stripPedestalNoise ;
+    for (int stripNo = 0;  stripNo < NCH; stripNo++) {
+        if(fReadoutBoard == "PADPLANE") {
+            padNo = fContext->fPadNoFromChNo[stripNo] ;
+            if (padNo == 65535) continue ;
+        }
         
-	std::pair<std::multimap<int, float>::iterator, std::multimap<int, float>::iterator> stripSetOfTimeBinRawData ;
-        for (int stripNo = 0;  stripNo < NCH; stripNo++) {
-            //     printf("SRSAPVEvent::ComputeListOfAPVHits()==> stripNo=%d \n", stripNo) ;
-            
-	  std::vector<float> timeBinADCs;
-            int timebin = 0 ;
-            
-            stripSetOfTimeBinRawData = fapvTimeBinDataMap.equal_range(stripNo) ;
-            
-	    std::multimap <int, float>::iterator timebin_it ;
-            for (timebin_it = stripSetOfTimeBinRawData.first; timebin_it != stripSetOfTimeBinRawData.second; ++timebin_it) {
-                float rawdata =  timebin_it->second ;
-                //	printf("SRSAPVEvent::ComputeListOfAPVHits()==> stripNo=%d, rawdata=%f \n", stripNo, rawdata) ;
-                
-                // BASELINE CORRECTION
-                if (fCommonModeFlag) {
-                    if ((fReadoutBoard == "UV_ANGLE") &&  (fDetectorType == "EICPROTO1") ) {
-                        if(stripNo < 64)  rawdata -= fCommonModeOffsets_even[timebin] ;
-                        else              rawdata -= fCommonModeOffsets_odd[timebin] ;
-                    }
-                    else  {
-                        rawdata -= fCommonModeOffsets[timebin] ;
-                    }
-                }
-                
-                // Pedestal Offset Suppression
-                if(fPedSubFlag) rawdata -= fPedestalOffsets[stripNo] ;
-                
-                // Masked Channels
-                rawdata = (1 - fMaskedChannels[stripNo]) * rawdata ;
-                
-                // APV GAIN CORRECTION DEFAULT VALUE GAIN = 1
-                rawdata =  rawdata / fAPVGain ;
-                timeBinADCs.push_back(rawdata) ;
-                timebin++ ;
-            }
-            
-            if(fReadoutBoard == "PADPLANE") {
-                padNo = fapvChToPadChMap[stripNo] ;
-                if (padNo == 65535) continue ;
+        int stripNb = stripNo ;
+        if (isEICUVAngle) {
+            if(stripNo > 63) {
+                stripNb = stripNo - 64 ;
+                plane = fDetector + "BOT" ;
             }
-            
-            int stripNb = stripNo ;
-            if ((fReadoutBoard == "UV_ANGLE") &&  (fDetectorType == "EICPROTO1") ) {
-                if(stripNo > 63) {
-                    stripNb = stripNo - 64 ;
-                    plane = fDetector + "BOT" ;
-                }
-                else    {
-                    plane = fDetector + "TOP" ;
-                }
-            }
-            
-            // ZERO SUPPRESSION
-            if (fZeroSupCut > 0 ) {
-	      float tval= 0;
-	      float tmax= 0;
-	      for (std::vector<float>::iterator i=timeBinADCs.begin();i<timeBinADCs.end();i++){
-		  tval+=*i;
-		  if (tmax < *i) tmax = *i;
-	      }
-	      tval = tval / float(timeBinADCs.size());
-	      //	      if( TMath::Mean(timeBinADCs.begin(), timeBinADCs.end()) < fZeroSupCut * fPedestalNoises[stripNo] ) {
-	      if( tval < fZeroSupCut * fPedestalNoises[stripNo] ) {
-		stripPedestalNoise.push_back(tval) ;
-		timeBinADCs.clear() ;
-		continue ;
-	      }
-	      
-	      if ( (int) (timeBinADCs.size()) != 0 ) {
-		//		float adcs = * (TMath::LocMax(timeBinADCs.begin(), timeBinADCs.end())) ;
-		float adcs = tmax;
-		if(adcs < 0) adcs = 0 ;
-		SRSHit * apvHit = new SRSHit() ;
-		apvHit->SetAPVID(fAPVID) ;
-		apvHit->IsHitFlag(true) ;
-		apvHit->SetDetector(fDetector) ;
-		apvHit->SetDetectorType(fDetectorType) ;
-		apvHit->SetReadoutBoard(fReadoutBoard) ;
-		apvHit->SetPadDetectorMap(fPadDetectorMap) ;
-		apvHit->SetPlane(plane) ;
-		apvHit->SetPlaneSize(fPlaneSize) ;
-		apvHit->SetTrapezoidDetRadius(fTrapezoidDetInnerRadius, fTrapezoidDetOuterRadius) ;
-		apvHit->SetAPVOrientation(fAPVOrientation) ;
-		apvHit->SetAPVstripmapping(fAPVstripmapping) ;
-		apvHit->SetAPVIndexOnPlane(fAPVIndexOnPlane) ;
-		apvHit->SetNbAPVsFromPlane(fNbOfAPVsFromPlane) ;
-		apvHit->SetTimeBinADCs(timeBinADCs) ;
-		apvHit->SetHitADCs(fZeroSupCut, adcs, fIsHitMaxOrTotalADCs) ;
-		apvHit->SetPadNo(padNo) ;
-		apvHit->SetStripNo(stripNb) ;
-		listOfHits.push_back(apvHit) ;
-	      }
+            else    {
+                plane = fDetector + "TOP" ;
             }
-            
-            else {
-	      SRSHit * apvHit = new SRSHit() ;
-	      apvHit->SetAPVID(fAPVID) ;
-	      
-	      float tval= 0;
-	      float tmax= 0;
-	      for (std::vector<float>::iterator i=timeBinADCs.begin();i<timeBinADCs.end();i++){
-		tval+=*i;
-		if (tmax < *i) tmax = *i;
-	      }
-	      tval = tval / float(timeBinADCs.size());
-	      float adcs = tmax;
-	      //float adcs = * (TMath::LocMax(timeBinADCs.begin(), timeBinADCs.end())) ;
-	      if ( tval < 5 * fPedestalNoises[stripNo] ) {
-		//                if( TMath::Mean(timeBinADCs.begin(), timeBinADCs.end()) < 5 * fPedestalNoises[stripNo] ) {
-		apvHit->IsHitFlag(false) ;
-		//		adcs = TMath::Mean(timeBinADCs.begin(), timeBinADCs.end());		
-		adcs = tval;
-	      }
-	      
-	      apvHit->SetDetector(fDetector) ;
-	      apvHit->SetDetectorType(fDetectorType) ;
-	      apvHit->SetReadoutBoard(fReadoutBoard) ;
-	      apvHit->SetPadDetectorMap(fPadDetectorMap) ;
-	      apvHit->SetPlane(plane) ;
-	      apvHit->SetPlaneSize(fPlaneSize) ;
-	      apvHit->SetTrapezoidDetRadius(fTrapezoidDetInnerRadius, fTrapezoidDetOuterRadius) ;
-	      apvHit->SetAPVOrientation(fAPVOrientation) ;
-	      apvHit->SetAPVstripmapping(fAPVstripmapping) ;
-	      apvHit->SetAPVIndexOnPlane(fAPVIndexOnPlane) ;
-	      apvHit->SetNbAPVsFromPlane(fNbOfAPVsFromPlane) ;
-	      apvHit->SetTimeBinADCs(timeBinADCs) ;
-	      apvHit->SetHitADCs(fZeroSupCut, adcs, fIsHitMaxOrTotalADCs) ;
-	      apvHit->SetPadNo(padNo) ;
-	      apvHit->SetStripNo(stripNb) ;
-	      listOfHits.push_back(apvHit) ;
-            }
-            timeBinADCs.clear() ;
         }
-	float nav1 = 0;
-	float nav2 = 0;
-	for (std::vector<float>::iterator i=stripPedestalNoise.begin();i<stripPedestalNoise.end();i++){
-	  nav1+=*i;
-	  nav2+=(*i)*(*i);
-	}
-	float rms2 = (nav2-nav1*nav1/float(stripPedestalNoise.size()))/(float(stripPedestalNoise.size()-1));
-	float rmsnoise = sqrt(rms2);
-        fMeanAPVnoise  = rmsnoise;
-	//        fMeanAPVnoise  = TMath::RMS(stripPedestalNoise.begin(), stripPedestalNoise.end()) ;
-        stripPedestalNoise.clear() ;
+        
+        bool isBelowThreshold = (stripMean[stripNo] < stripThreshold[stripNo]) ;
+
+        // ZERO SUPPRESSION
+        if ((fZeroSupCut > 0) && isBelowThreshold) {
+            stripPedestalNoise.push_back(stripMean[stripNo]) ;
+            continue ;
+        }
+
+        std::vector<float> timeBinADCs(fNbTimeBins) ;
+        for (int timebin = 0; timebin < fNbTimeBins; timebin++) timeBinADCs[timebin] = fTimeBinData[timebin * NCH + stripNo] ;
+
+        float adcs = stripMax[stripNo] ;
+        SRSHit * apvHit = new SRSHit() ;
+        apvHit->SetAPVID(fAPVID) ;
+        if (fZeroSupCut > 0) {
+            if(adcs < 0) adcs = 0 ;
+            apvHit->IsHitFlag(true) ;
+        }
+        else if (isBelowThreshold) {
+            apvHit->IsHitFlag(false) ;
+            adcs = stripMean[stripNo] ;
+        }
+        apvHit->SetDetector(fDetector) ;
+        apvHit->SetDetectorType(fDetectorType) ;
+        apvHit->SetReadoutBoard(fReadoutBoard) ;
+        apvHit->SetPadDetectorMap(fPadDetectorMap) ;
+        apvHit->SetPlane(plane) ;
+        apvHit->SetPlaneSize(fPlaneSize) ;
+        apvHit->SetTrapezoidDetRadius(fTrapezoidDetInnerRadius, fTrapezoidDetOuterRadius) ;
+        apvHit->SetAPVOrientation(fAPVOrientation) ;
+        apvHit->SetAPVstripmapping(fAPVstripmapping) ;
+        apvHit->SetAPVIndexOnPlane(fAPVIndexOnPlane) ;
+        apvHit->SetNbAPVsFromPlane(fNbOfAPVsFromPlane) ;
+        apvHit->SetTimeBinADCs(timeBinADCs) ;
+        apvHit->SetHitADCs(fZeroSupCut, adcs, fIsHitMaxOrTotalADCs) ;
+        apvHit->SetPadNo(padNo) ;
+        apvHit->SetStripNo(stripNb) ;
+        listOfHits.push_back(apvHit) ;
     }
+
+    float nav1 = 0;
+    float nav2 = 0;
+    for (std::vector<float>::iterator i=stripPedestalNoise.begin();i<stripPedestalNoise.end();i++){
+      nav1+=*i;
+      nav2+=(*i)*(*i);
+    }
+    float rms2 = (nav2-nav1*nav1/float(stripPedestalNoise.size()))/(float(stripPedestalNoise.size()-1));
+    float rmsnoise = sqrt(rms2);
+    fMeanAPVnoise  = rmsnoise;
+    //        fMeanAPVnoise  = TMath::RMS(stripPedestalNoise.begin(), stripPedestalNoise.end()) ;
     //  printf("SRSAPVEvent::ComputeListOfAPVHits()==> exit \n") ;
     
     return listOfHits ;
@@ -723,7 +667,6 @@ std::list <SRSHit * >  SRSAPVEvent::ComputeListOfAPVHitsZS() {
     
     bool startDataFlag = false ;
     
-    fapvTimeBinDataMap.clear() ;
     unsigned int apvheaderlevel = (unsigned int)  fAPVHeaderLevel ;
     int size = fRawData16bits.size() ;
     
@@ -768,7 +711,7 @@ std::list <SRSHit * >  SRSAPVEvent::ComputeListOfAPVHitsZS() {
 	  }
             
 	  if ( ((idata-4)%(adcbin+1))==adcbin ) {
-	    int stripNo = this->StripMapping(chNo) ;
+	    int stripNo = ((chNo >= 0) && (chNo < NCH)) ? fContext->fStripNoFromChNo[chNo] : this->StripMapping(chNo) ;
 	    //	    std::cout <<" +++ last long word creating adc time profile for strip "<<stripNo<<std::endl;
 	    if (timeBinADCs.size()>0) {
 	      float tval= 0;
@@ -830,6 +773,64 @@ std::list <SRSHit * >  SRSAPVEvent::ComputeListOfAPVHitsZS() {
 }
 
 
+//========================================================================================================================
+// Flat [timebin * NCH + stripNo] copy of the (4096 - raw) data of a full readout frame, no common mode
+// nor pedestal correction; used by SRSPedestal which accumulates the statistics itself
+int SRSAPVEvent::ComputeTimeBinRawData(std::vector<float> & timeBinData) {
+    ComputeRawData16bits() ;
+    return UnpackTimeBinRawData(timeBinData) ;
+}
+
+//========================================================================================================================
+// Same as ComputeTimeBinRawData() from the already computed fRawData16bits
+int SRSAPVEvent::UnpackTimeBinRawData(std::vector<float> & timeBinData) {
+    timeBinData.clear() ;
+
+    const int * stripNoFromChNo = fContext->fStripNoFromChNo ;
+
+    unsigned int apvheaderlevel = (unsigned int)  fAPVHeaderLevel ;
+    int size = fRawData16bits.size() ;
+    int idata = 0, nbTimeBins = 0 ;
+
+    while(idata < size - 2) {
+        //=== 3 consecutive words below the header level == APV header, the data start 12 words after
+        if ( (fRawData16bits[idata] < apvheaderlevel) && (fRawData16bits[idata+1] < apvheaderlevel) && (fRawData16bits[idata+2] < apvheaderlevel) ) {
+            idata += 12 ;
+            if (idata + NCH > size) break ;
+
+            timeBinData.resize((nbTimeBins + 1) * NCH) ;
+            float * data = &timeBinData[nbTimeBins * NCH] ;
+            for(int chNo = 0; chNo < NCH; ++chNo) {
+                data[stripNoFromChNo[chNo]] = 4096 - ((float) fRawData16bits[idata + chNo]) ;
+            }
+            idata += NCH ;
+            nbTimeBins++ ;
+            continue ;
+        }
+        idata++ ;
+    }
+    return nbTimeBins ;
+}
+
+//========================================================================================================================
+// Mean over the time bins of the common mode subtracted data of each strip
+void SRSAPVEvent::ComputeMeanTimeBinData(std::vector<float> & meanTimeBinData) {
+    meanTimeBinData.assign(NCH, 0) ;
+    if (fNbTimeBins == 0) return ;
+
+    bool isEICUVAngle = (fReadoutBoard == "UV_ANGLE") && (fDetectorType == "EICPROTO1") ;
+    for (int timebin = 0; timebin < fNbTimeBins; timebin++) {
+        const float * data = &fTimeBinData[timebin * NCH] ;
+        for (int stripNo = 0; stripNo < NCH; stripNo++) {
+            float commonMode ;
+            if (isEICUVAngle) commonMode = (stripNo < NCH / 2) ? fCommonModeOffsets_even[timebin] : fCommonModeOffsets_odd[timebin] ;
+            else              commonMode = fCommonModeOffsets[timebin] ;
+            meanTimeBinData[stripNo] += data[stripNo] - commonMode ;
+        }
+    }
+    for (int stripNo = 0; stripNo < NCH; stripNo++) meanTimeBinData[stripNo] = meanTimeBinData[stripNo] / float(fNbTimeBins) ;
+}
+
 //========================================================================================================================
 void SRSAPVEvent::ComputeMeanTimeBinRawPedestalData() { 
     //  printf("SRSAPVEvent::ComputeMeanTimeBinRawPedestalData() \n") ;
@@ -842,35 +843,7 @@ void SRSAPVEvent::ComputeMeanTimeBinRawPedestalData() {
     
     ComputeRawData16bits() ;
     ComputeTimeBinCommonMode() ;
-    fRawPedestalData.clear() ;
-    
-    std::vector<float>  meanTimeBinRawPedestalDataVect ;
-    std::pair<std::multimap<int, float>::iterator, std::multimap<int, float>::iterator> stripSetOfTimeBinRawData ;
-    for (int stripNo = 0;  stripNo < NCH; stripNo++) {
-        stripSetOfTimeBinRawData = fapvTimeBinDataMap.equal_range(stripNo) ;
-	std::multimap<int, float>::iterator timebin_it ;
-        int timebin = 0 ;
-        for (timebin_it = stripSetOfTimeBinRawData.first; timebin_it != stripSetOfTimeBinRawData.second; ++timebin_it) {
-            float rawdata = timebin_it->second ;
-            
-            if ((fReadoutBoard == "UV_ANGLE") &&  (fDetectorType == "EICPROTO1") ) {
-                if(stripNo < 64) meanTimeBinRawPedestalDataVect.push_back(rawdata - fCommonModeOffsets_even[timebin]) ;
-                else             meanTimeBinRawPedestalDataVect.push_back(rawdata - fCommonModeOffsets_odd[timebin]) ; 
-            }
-            else {
-                meanTimeBinRawPedestalDataVect.push_back(rawdata - fCommonModeOffsets[timebin]) ;
-            }
-            timebin++ ;
-        }
-	float avte = 0;
-	for (std::vector<float>::iterator i=meanTimeBinRawPedestalDataVect.begin();i<meanTimeBinRawPedestalDataVect.end();i++){
-	  avte += *i;
-	}
-	avte = avte/ float(meanTimeBinRawPedestalDataVect.size());
-	//        fRawPedestalData.push_back(TMath::Mean(meanTimeBinRawPedestalDataVect.begin(),meanTimeBinRawPedestalDataVect.end())) ;
-        fRawPedestalData.push_back(avte) ;
-        meanTimeBinRawPedestalDataVect.clear() ;
-    }
+    ComputeMeanTimeBinData(fRawPedestalData) ;
 }
 
 //========================================================================================================================
@@ -885,34 +858,5 @@ void SRSAPVEvent::ComputeMeanTimeBinPedestalData() {
     
     ComputeRawData16bits() ;
     ComputeTimeBinCommonMode() ;
-    fPedestalData.clear() ;
-    
-    std::vector<float>  meanTimeBinPedestalDataVect ;
-    std::pair<std::multimap<int, float>::iterator, std::multimap<int, float>::iterator> stripSetOfTimeBinRawData ;
-    for (int stripNo = 0;  stripNo < NCH; stripNo++) {
-        stripSetOfTimeBinRawData = fapvTimeBinDataMap.equal_range(stripNo) ;
-	std::multimap<int, float>::iterator timebin_it ;
-        int timebin = 0 ;
-        for (timebin_it = stripSetOfTimeBinRawData.first; timebin_it != stripSetOfTimeBinRawData.second; ++timebin_it) {
-            float rawdata = timebin_it->second ;
-            
-            if ((fReadoutBoard == "UV_ANGLE") &&  (fDetectorType == "EICPROTO1") ) {
-                if(stripNo < 64) meanTimeBinPedestalDataVect.push_back(rawdata - fCommonModeOffsets_even[timebin]) ;
-                else             meanTimeBinPedestalDataVect.push_back(rawdata - fCommonModeOffsets_odd[timebin]) ;
-            }
-            else {
-                meanTimeBinPedestalDataVect.push_back(rawdata - fCommonModeOffsets[timebin]) ;
-            }
-            timebin++ ;
-        }
-	float avte = 0;
-	for (std::vector<float>::iterator i=meanTimeBinPedestalDataVect.begin();i<meanTimeBinPedestalDataVect.end();i++){
-	  avte += *i;
-	}
-	avte = avte/ float(meanTimeBinPedestalDataVect.size());
-	
-	//        fPedestalData.push_back(TMath::Mean(meanTimeBinPedestalDataVect.begin(),meanTimeBinPedestalDataVect.end())) ;
-        fPedestalData.push_back(avte) ;
-        meanTimeBinPedestalDataVect.clear() ;
-    }
+    ComputeMeanTimeBinData(fPedestalData) ;
 }
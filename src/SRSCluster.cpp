@@ -42,13 +42,12 @@ int SRSCluster::GetClusterTimeBin() {
   fClusterTimeBinADC = 0 ;
   
   for (int i = 0; i < nbofhits; i++) {
-    std::vector< float > timeBinADCs = (fArrayOfHits[i])->GetTimeBinADCs() ;
+    const std::vector< float > & timeBinADCs = (fArrayOfHits[i])->GetTimeBinADCs() ;
     int nbOfTimeBins = timeBinADCs.size() ;
     fClusterTimeBinADCs.resize(nbOfTimeBins) ;
     for (int k = 0; k < nbOfTimeBins; k++) {
       fClusterTimeBinADCs[k] += timeBinADCs[k] ;
     }
-    timeBinADCs.clear() ;
   }
   
   this->Timing() ;
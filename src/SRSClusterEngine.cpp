@@ -0,0 +1,109 @@
+#include "SRSClusterEngine.h"
+#include <utility>
+#include "SRSHit.h"
+
+//============================================================================================
+SRSClusterEngine::SRSClusterEngine() {
+  fMaxGap       = 0 ;
+  fSeedCut      = 0 ;
+  fNeighbourCut = 0 ;
+}
+
+//============================================================================================
+void SRSClusterEngine::Clear() {
+  fHits.clear() ;
+  fSortedHits.clear() ;
+  fClusters.clear() ;
+}
+
+//============================================================================================
+void SRSClusterEngine::AddHit(SRSHit * hit) {
+  SRSClusterHit clusterHit ;
+  clusterHit.fADCs = hit->GetHitADCs() ;
+
+  //=== Below the neighbour cut the strip does not exist for the clustering
+  if ((fNeighbourCut > 0) && (clusterHit.fADCs < fNeighbourCut)) return ;
+
+  clusterHit.fStripNo = hit->GetStripNo() ;
+  clusterHit.fTimeBin = hit->GetSignalPeakBinNumber() ;
+  clusterHit.fHit     = hit ;
+  fHits.push_back(clusterHit) ;
+}
+
+//============================================================================================
+// LSD radix sort on (stripNo - min stripNo), 8 bits per pass; a plane has at most a few
+// thousand strips so this is 1 or 2 counting passes. Stable, like the list::sort it replaces
+void SRSClusterEngine::SortByStripNo() {
+  int nbOfHits = fHits.size() ;
+  fSortedHits.resize(nbOfHits) ;
+  if (nbOfHits == 0) return ;
+
+  int minStrip = fHits[0].fStripNo, maxStrip = fHits[0].fStripNo ;
+  for (int i = 1; i < nbOfHits; i++) {
+    if (fHits[i].fStripNo < minStrip) minStrip = fHits[i].fStripNo ;
+    if (fHits[i].fStripNo > maxStrip) maxStrip = fHits[i].fStripNo ;
+  }
+  unsigned int range = (unsigned int) (maxStrip - minStrip) ;
+
+  std::vector<SRSClusterHit> * in  = &fHits ;
+  std::vector<SRSClusterHit> * out = &fSortedHits ;
+  int nbPasses = 0 ;
+  for (unsigned int shift = 0; (shift == 0) || ((shift < 32) && ((range >> shift) != 0)); shift += 8) {
+    int counts[257] = {0} ;
+    for (int i = 0; i < nbOfHits; i++) counts[(((unsigned int) ((*in)[i].fStripNo - minStrip) >> shift) & 0xff) + 1]++ ;
+    for (int digit = 0; digit < 256; digit++) counts[digit + 1] += counts[digit] ;
+    for (int i = 0; i < nbOfHits; i++) {
+      int digit = ((unsigned int) ((*in)[i].fStripNo - minStrip) >> shift) & 0xff ;
+      (*out)[counts[digit]++] = (*in)[i] ;
+    }
+    std::swap(in, out) ;
+    nbPasses++ ;
+  }
+
+  //=== The last pass wrote into fHits
+  if (nbPasses % 2 == 0) fSortedHits.swap(fHits) ;
+}
+
+//============================================================================================
+void SRSClusterEngine::CloseCluster(SRSClusterRecord & cluster) {
+  if (cluster.fNbOfHits == 0) return ;
+  if (cluster.fPeakADCs < fSeedCut) return ;
+  fClusters.push_back(cluster) ;
+}
+
+//============================================================================================
+int SRSClusterEngine::ComputeClusters(bool isPadPlane) {
+  fClusters.clear() ;
+  SortByStripNo() ;
+
+  SRSClusterRecord cluster ;
+  cluster.fNbOfHits = 0 ;
+
+  int nbOfHits = fSortedHits.size() ;
+  int previousStrip = 0 ;
+  for (int i = 0; i < nbOfHits; i++) {
+    const SRSClusterHit & hit = fSortedHits[i] ;
+    int stripGap = hit.fStripNo - previousStrip ;
+
+    //=== Same strip twice counts as a new cluster, as in the original adjacency test
+    if (isPadPlane || (cluster.fNbOfHits == 0) || (stripGap < 1) || (stripGap > fMaxGap + 1)) {
+      CloseCluster(cluster) ;
+      cluster.fFirstHit    = i ;
+      cluster.fNbOfHits    = 0 ;
+      cluster.fSumADCs     = 0 ;
+      cluster.fPeakADCs    = 0 ;
+      cluster.fPeakTimeBin = 0 ;
+    }
+
+    cluster.fNbOfHits++ ;
+    cluster.fSumADCs += hit.fADCs ;
+    if (hit.fADCs > cluster.fPeakADCs) {
+      cluster.fPeakADCs    = hit.fADCs ;
+      cluster.fPeakTimeBin = hit.fTimeBin ;
+    }
+    previousStrip = hit.fStripNo ;
+  }
+  CloseCluster(cluster) ;
+
+  return fClusters.size() ;
+}
@@ -47,6 +47,18 @@ SRSConfiguration & SRSConfiguration::operator=(const SRSConfiguration &rhs) {
   fIsHitMaxOrTotalADCs     = rhs.GetHitMaxOrTotalADCs() ;
   fIsClusterMaxOrTotalADCs = rhs.GetClusterMaxOrTotalADCs() ;
   fAPVGainCalibrationFile  = rhs.GetAPVGainCalibrationFile() ;
+  fNbOfThreads             = rhs.GetNbOfThreads() ;
+  fClusterCache            = rhs.GetClusterCache() ;
+  fClusterMaxGap           = rhs.GetClusterMaxGap() ;
+  fClusterSeedCut          = rhs.GetClusterSeedCut() ;
+  fClusterNeighbourCut     = rhs.GetClusterNeighbourCut() ;
+  fAPVMaskFraction         = rhs.GetAPVMaskFraction() ;
+  fLogLevel                = rhs.GetLogLevel() ;
+  fLogFile                 = rhs.GetLogFile() ;
+  fLogRate                 = rhs.GetLogRate() ;
+  fEventRange              = rhs.GetEventRange() ;
+  fRecoChunks              = rhs.GetRecoChunks() ;
+  fSplitDetectors          = rhs.GetSplitDetectors() ;
   return *this;
 }
 
@@ -91,6 +103,18 @@ void SRSConfiguration::SetDefaults() {
   fIsClusterMaxOrTotalADCs = "TotalCharges" ;
   fStartEventNumber        = "0" ;
   fEventFrequencyNumber    = "1" ;
+  fNbOfThreads             = "0" ;
+  fClusterCache            = "NO" ;
+  fClusterMaxGap           = "0" ;
+  fClusterSeedCut          = "0" ;
+  fClusterNeighbourCut     = "0" ;
+  fAPVMaskFraction         = "0" ;
+  fLogLevel                = "INFO" ;
+  fLogFile                 = "" ;
+  fLogRate                 = "1" ;
+  fEventRange              = "ALL" ;
+  fRecoChunks              = "1" ;
+  fSplitDetectors          = "NO" ;
 }
 
 //============================================================================================
@@ -123,6 +147,18 @@ void SRSConfiguration::Save(const char * filename) const {
   file << "APVGAINCALIB "         << fAPVGainCalibrationFile << std::endl;
   file << "HIT_ADCS "             << fIsHitMaxOrTotalADCs << std::endl;
   file << "CLUSTER_ADCS "         << fIsClusterMaxOrTotalADCs << std::endl;
+  file << "NBOFTHREADS "          << fNbOfThreads            << std::endl;
+  file << "CLUSTERCACHE "         << fClusterCache           << std::endl;
+  file << "CLUSTERMAXGAP "        << fClusterMaxGap          << std::endl;
+  file << "CLUSTERSEEDCUT "       << fClusterSeedCut         << std::endl;
+  file << "CLUSTERNEIGHBOURCUT "  << fClusterNeighbourCut    << std::endl;
+  file << "APVMASKFRACTION "      << fAPVMaskFraction        << std::endl;
+  file << "LOGLEVEL "             << fLogLevel               << std::endl;
+  if (!fLogFile.empty()) file << "LOGFILE " << fLogFile << std::endl;
+  file << "LOGRATE "              << fLogRate                << std::endl;
+  file << "EVENTRANGE "           << fEventRange             << std::endl;
+  file << "RECOCHUNKS "           << fRecoChunks             << std::endl;
+  file << "SPLITDETECTORS "       << fSplitDetectors         << std::endl;
   file.close();
 }
 
@@ -204,7 +240,7 @@ bool SRSConfiguration::Load(const char * filename) {
       sscanf(line.c_str(), "HISTCFG %s", hfile);
       fHistosFile = hfile;
     }
-    if(line.find("PEDFILE")!=line.npos) {  
+    if(line.find("PEDFILE")!=line.npos && line.find("RAWPEDFILE")==line.npos) {  
       char pedfile[1000];  
       sscanf(line.c_str(), "PEDFILE %s", pedfile);  
       fPedestalFile = pedfile; 
@@ -279,6 +315,66 @@ bool SRSConfiguration::Load(const char * filename) {
       sscanf(line.c_str(), " HIT_ADCS%s", isHitMaxOrTotalADCs);
       fIsHitMaxOrTotalADCs = isHitMaxOrTotalADCs ;
     }
+    if(line.find("NBOFTHREADS")!=line.npos) {
+      char nbOfThreads[100];
+      sscanf(line.c_str(), "NBOFTHREADS %s", nbOfThreads);
+      fNbOfThreads = nbOfThreads;
+    }
+    if(line.find("CLUSTERCACHE")!=line.npos) {
+      char clusterCache[100];
+      sscanf(line.c_str(), "CLUSTERCACHE %s", clusterCache);
+      fClusterCache = clusterCache;
+    }
+    if(line.find("CLUSTERMAXGAP")!=line.npos) {
+      char clusterMaxGap[100];
+      sscanf(line.c_str(), "CLUSTERMAXGAP %s", clusterMaxGap);
+      fClusterMaxGap = clusterMaxGap;
+    }
+    if(line.find("CLUSTERSEEDCUT")!=line.npos) {
+      char clusterSeedCut[100];
+      sscanf(line.c_str(), "CLUSTERSEEDCUT %s", clusterSeedCut);
+      fClusterSeedCut = clusterSeedCut;
+    }
+    if(line.find("CLUSTERNEIGHBOURCUT")!=line.npos) {
+      char clusterNeighbourCut[100];
+      sscanf(line.c_str(), "CLUSTERNEIGHBOURCUT %s", clusterNeighbourCut);
+      fClusterNeighbourCut = clusterNeighbourCut;
+    }
+    if(line.find("APVMASKFRACTION")!=line.npos) {
+      char apvMaskFraction[100];
+      sscanf(line.c_str(), "APVMASKFRACTION %s", apvMaskFraction);
+      fAPVMaskFraction = apvMaskFraction;
+    }
+    if(line.find("LOGLEVEL")!=line.npos) {
+      char logLevel[100];
+      sscanf(line.c_str(), "LOGLEVEL %s", logLevel);
+      fLogLevel = logLevel;
+    }
+    if(line.find("LOGFILE")!=line.npos) {
+      char logFile[1000];
+      sscanf(line.c_str(), "LOGFILE %s", logFile);
+      fLogFile = logFile;
+    }
+    if(line.find("LOGRATE")!=line.npos) {
+      char logRate[100];
+      sscanf(line.c_str(), "LOGRATE %s", logRate);
+      fLogRate = logRate;
+    }
+    if(line.find("EVENTRANGE")!=line.npos) {
+      char eventRange[100];
+      sscanf(line.c_str(), "EVENTRANGE %s", eventRange);
+      fEventRange = eventRange;
+    }
+    if(line.find("RECOCHUNKS")!=line.npos) {
+      char recoChunks[100];
+      sscanf(line.c_str(), "RECOCHUNKS %s", recoChunks);
+      fRecoChunks = recoChunks;
+    }
+    if(line.find("SPLITDETECTORS")!=line.npos) {
+      char splitDetectors[100];
+      sscanf(line.c_str(), "SPLITDETECTORS %s", splitDetectors);
+      fSplitDetectors = splitDetectors;
+    }
   }while (!file.eof());
   this->Dump();
   return true;
@@ -308,4 +404,16 @@ void SRSConfiguration::Dump() const {
   printf("  SRSConfiguration::Load() ==> APVGAINCALIB          %s\n", fAPVGainCalibrationFile.c_str()) ;
   printf("  SRSConfiguration::Load() ==> ROOTDATATYPE          %s\n", fROOTDataType.c_str()) ;
   printf("  SRSConfiguration::Load() ==> OFFSETDIR             %s\n", fTrackingOffsetDir.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> NBOFTHREADS           %s\n", fNbOfThreads.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> CLUSTERCACHE          %s\n", fClusterCache.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> CLUSTERMAXGAP         %s\n", fClusterMaxGap.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> CLUSTERSEEDCUT        %s\n", fClusterSeedCut.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> CLUSTERNEIGHBOURCUT   %s\n", fClusterNeighbourCut.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> APVMASKFRACTION       %s\n", fAPVMaskFraction.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> LOGLEVEL              %s\n", fLogLevel.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> LOGFILE               %s\n", fLogFile.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> LOGRATE               %s\n", fLogRate.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> EVENTRANGE            %s\n", fEventRange.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> RECOCHUNKS            %s\n", fRecoChunks.c_str()) ;
+  printf("  SRSConfiguration::Load() ==> SPLITDETECTORS        %s\n", fSplitDetectors.c_str()) ;
 }
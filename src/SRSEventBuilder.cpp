@@ -1,6 +1,14 @@
 #include "SRSEventBuilder.h"
 #include "SRSCluster.h"
+#include <algorithm>
 #include <sstream>
+#include "Logger.h"
+
+using QualityControl::Uniformity::Logger;
+
+//=== Per event diagnostics only increment these counters (see Logger::printSummary()), registered once
+static const int iCountBadClusters   = Logger::getInstance().registerCounter("SRSEventBuilder: bad clusters dropped") ;
+static const int iCountRejectedInDet = Logger::getInstance().registerCounter("SRSEventBuilder: events rejected in a trigger detector") ;
 
 //============================================================================================
 SRSEventBuilder::SRSEventBuilder(int triggerNb, std::string maxClusterSize, std::string minClusterSize, std::string zeroSupCut, std::string runType, bool isClusterPosCorrection ) {
@@ -12,6 +20,8 @@ SRSEventBuilder::SRSEventBuilder(int triggerNb, std::string maxClusterSize, std:
     fMaxClusterSize = 100000 ;
     fMinClusterSize = 1 ;
     fIsClusterPosCorrection = isClusterPosCorrection ;
+    fClusterEngine = 0 ;
+    fLastPlaneEvent = -1 ;
     if(fZeroSupCut != 0) {
       fMinClusterSize = this->atoi(minClusterSize) ;
       fMaxClusterSize = this->atoi(maxClusterSize);
@@ -39,34 +49,77 @@ SRSEventBuilder::SRSEventBuilder(int triggerNb, std::string maxClusterSize, std:
 }
 
 //============================================================================================
+// The hits are owned through fListOfHits only, the planes hold the same pointers
 SRSEventBuilder::~SRSEventBuilder() {
     fTriggerList.clear() ;
+    for (unsigned int i = 0; i < fPlaneEvents.size(); i++) ClearClusters(fPlaneEvents[i]) ;
     DeleteListOfHits(fListOfHits) ;
     DeleteListOfAPVEvents(fListOfAPVEvents) ;
-    DeleteHitsInDetectorPlaneMap(fHitsInDetectorPlaneMap) ;
-    //    DeleteClustersInDetectorPlaneMap(fClustersInDetectorPlaneMap) ;
 }
 
 //============================================================================================
-template <typename M> void ClearVectorMap( M & amap ) {
-    for ( typename M::iterator it = amap.begin(); it != amap.end(); ++it ) {
-        ((*it).second).clear();
+void SRSEventBuilder::Reset(int triggerNb) {
+    fTriggerCount = triggerNb ;
+    fIsGoodEvent = false ;
+
+    for (unsigned int i = 0; i < fPlaneEvents.size(); i++) {
+      ClearClusters(fPlaneEvents[i]) ;
+      fPlaneEvents[i].fHits.clear() ;
     }
-    amap.clear() ;
+    DeleteListOfHits(fListOfHits) ;
+    DeleteListOfAPVEvents(fListOfAPVEvents) ;
+    fDetectorPlaneNoise.clear() ;
+}
+
+//============================================================================================
+void SRSEventBuilder::ClearClusters(SRSPlaneEvent & planeEvent) {
+    for (unsigned int i = 0; i < planeEvent.fClusters.size(); i++) delete planeEvent.fClusters[i] ;
+    planeEvent.fClusters.clear() ;
+}
+
+//============================================================================================
+SRSPlaneEvent * SRSEventBuilder::FindPlaneEvent(const std::string & planeName) {
+    std::map<std::string, int>::const_iterator index_itr = fPlaneEventIndex.find(planeName) ;
+    if (index_itr == fPlaneEventIndex.end()) return 0 ;
+    return &fPlaneEvents[index_itr->second] ;
 }
 
 //============================================================================================
-void SRSEventBuilder::DeleteHitsInDetectorPlaneMap( std::map<std::string, std::list <SRSHit * > > & stringListMap) {
-  std::map < std::string, std::list <SRSHit *> >::const_iterator itr ;
-  for (itr = stringListMap.begin(); itr != stringListMap.end(); itr++) {
-    std::list <SRSHit *> listOfHits = (*itr).second ;
-    std::list <SRSHit *>::const_iterator hit_itr ;
-    for (hit_itr = listOfHits.begin(); hit_itr != listOfHits.end(); hit_itr++) {
-      delete (* hit_itr) ;
+SRSPlaneEvent & SRSEventBuilder::GetPlaneEvent(const std::string & planeName) {
+    if ((fLastPlaneEvent >= 0) && (fPlaneEvents[fLastPlaneEvent].fPlane == planeName)) return fPlaneEvents[fLastPlaneEvent] ;
+
+    std::map<std::string, int>::const_iterator index_itr = fPlaneEventIndex.find(planeName) ;
+    if (index_itr != fPlaneEventIndex.end()) {
+      fLastPlaneEvent = index_itr->second ;
+      return fPlaneEvents[fLastPlaneEvent] ;
     }
-    listOfHits.clear() ;
-  }
-  stringListMap.clear() ;
+
+    //=== First hit on this plane in the run
+    SRSMapping * mapping = SRSMapping::GetInstance() ;
+    SRSPlaneEvent planeEvent ;
+    planeEvent.fPlane        = planeName ;
+    planeEvent.fDetector     = mapping->GetDetectorFromPlane(planeName) ;
+    planeEvent.fReadoutBoard = mapping->GetReadoutBoardFromDetector(planeEvent.fDetector) ;
+    planeEvent.fDetID        = mapping->GetDetectorIDFromDetector(planeEvent.fDetector) ;
+    planeEvent.fPlaneID      = mapping->GetPlaneIDorEtaSector(planeName) ;
+
+    fLastPlaneEvent = fPlaneEvents.size() ;
+    fPlaneEvents.push_back(planeEvent) ;
+    fPlaneEventIndex[planeName] = fLastPlaneEvent ;
+
+    fPlaneEventsByName.clear() ;
+    std::map<std::string, int>::const_iterator byName_itr ;
+    for (byName_itr = fPlaneEventIndex.begin(); byName_itr != fPlaneEventIndex.end(); ++byName_itr) fPlaneEventsByName.push_back(byName_itr->second) ;
+
+    return fPlaneEvents[fLastPlaneEvent] ;
+}
+
+//============================================================================================
+template <typename M> void ClearVectorMap( M & amap ) {
+    for ( typename M::iterator it = amap.begin(); it != amap.end(); ++it ) {
+        ((*it).second).clear();
+    }
+    amap.clear() ;
 }
 
 /*
@@ -104,8 +157,8 @@ void SRSEventBuilder::DeleteListOfClusters(TList * listOfClusters) {
 
 
 //============================================================================================
-void SRSEventBuilder::DeleteListOfHits(std::list<SRSHit *>& listOfHits) {
-  std::list<SRSHit *>::iterator hit;
+void SRSEventBuilder::DeleteListOfHits(std::vector<SRSHit *>& listOfHits) {
+  std::vector<SRSHit *>::iterator hit;
   for (hit=listOfHits.begin();hit!=listOfHits.end();hit++){
     delete (*hit);
   }
@@ -114,10 +167,14 @@ void SRSEventBuilder::DeleteListOfHits(std::list<SRSHit *>& listOfHits) {
 
 //============================================================================================
 static bool CompareStripNo( SRSHit *obj1, SRSHit *obj2) {
-    bool compare ;
-    if ( obj1->GetStripNo() < obj2->GetStripNo() ) compare = true;
-    else compare = false;
-    return compare ;
+    return obj1->GetStripNo() < obj2->GetStripNo() ;
+}
+
+//============================================================================================
+void SRSEventBuilder::SortHitsByStripNo() {
+  for (unsigned int i = 0; i < fPlaneEvents.size(); i++) {
+    std::stable_sort(fPlaneEvents[i].fHits.begin(), fPlaneEvents[i].fHits.end(), CompareStripNo) ;
+  }
 }
 
 //============================================================================================
@@ -139,59 +196,42 @@ static bool CompareClusterADCs( SRSCluster *obj1, SRSCluster *obj2) {
 
 
 //============================================================================================
+// The grouping of adjacent strips is done by SRSClusterEngine on flat arrays, the SRSClusters are
+// only created for the groups it returns
 void SRSEventBuilder::ComputeClustersInDetectorPlane() {
     //  printf("==SRSEventBuilder::ComputeClustersInDetectorPlane() \n") ;
-  std::map<std::string, std::list <SRSHit*> >::const_iterator  listOfHits_itr ;
-  for (listOfHits_itr = fHitsInDetectorPlaneMap.begin(); listOfHits_itr != fHitsInDetectorPlaneMap.end(); ++listOfHits_itr) {
-    std::string detPlane =  listOfHits_itr->first;
-    SRSMapping * mapping = SRSMapping::GetInstance();
-    std::string detector = mapping->GetDetectorFromPlane(detPlane);
-    std::string readoutBoard = mapping->GetReadoutBoardFromDetector(detector);
-        
-    std::list <SRSHit*> listOfHits = listOfHits_itr->second ;
-    listOfHits.sort(CompareStripNo) ;
-    int listSize = listOfHits.size() ;
-    if (listSize < fMinClusterSize) {
+  SRSClusterEngine localClusterEngine ;
+  SRSClusterEngine * clusterEngine = fClusterEngine ? fClusterEngine : &localClusterEngine ;
+
+  for (unsigned int iPlane = 0; iPlane < fPlaneEventsByName.size(); iPlane++) {
+    SRSPlaneEvent & planeEvent = fPlaneEvents[fPlaneEventsByName[iPlane]] ;
+    ClearClusters(planeEvent) ;
+    if (planeEvent.fHits.empty()) continue ;
+
+    clusterEngine->Clear() ;
+    for (unsigned int i = 0; i < planeEvent.fHits.size(); i++) clusterEngine->AddHit(planeEvent.fHits[i]) ;
+    if (clusterEngine->GetNbOfHits() < fMinClusterSize) {
       fIsGoodEvent = false ;
       continue ;
     }
-        
-    int previousStrip = -2 ;
-    int clusterNo = -1 ;
-        
-    std::map<int, SRSCluster *> clustersMap ;
-    std::list <SRSHit *>::const_iterator hit_itr ;
-    for (hit_itr = listOfHits.begin(); hit_itr != listOfHits.end(); hit_itr++) {
-      SRSHit* hit =  *hit_itr ;            
-      int currentStrip = hit->GetStripNo() ;
-      int apvIndexOnPlane = hit->GetAPVIndexOnPlane();      
-      if(readoutBoard != "PADPLANE") {
-	if(currentStrip != (previousStrip + 1)) {
-	  clusterNo++ ;
-	}
-      }
-      else {
-	clusterNo++ ;
-      }
-            
-      if(!clustersMap[clusterNo]) {
-	//	std:: cout <<" >>> Creating Cluster request min size="<<fMinClusterSize<<" max size="<<fMaxClusterSize<<std::endl;
-	clustersMap[clusterNo] = new SRSCluster(fMinClusterSize, fMaxClusterSize, fIsClusterMaxOrTotalADCs) ;
-	clustersMap[clusterNo]->SetNbAPVsFromPlane(hit->GetNbAPVsFromPlane());
-	clustersMap[clusterNo]->SetPlaneSize(hit->GetPlaneSize());
-	clustersMap[clusterNo]->SetPlane(hit->GetPlane());
-      }
-      clustersMap[clusterNo]->AddHit(hit) ;
-      previousStrip = currentStrip;
-    }
-        
-    std::map<int, SRSCluster *>::const_iterator  cluster_itr;
-    
-    for (cluster_itr = clustersMap.begin(); cluster_itr != clustersMap.end(); cluster_itr++) {
-      SRSCluster * cluster = cluster_itr->second ;
-            
+    clusterEngine->ComputeClusters(planeEvent.fReadoutBoard == "PADPLANE") ;
+
+    const std::vector<SRSClusterHit> & sortedHits = clusterEngine->GetSortedHits() ;
+    const std::vector<SRSClusterRecord> & clusterRecords = clusterEngine->GetClusters() ;
+
+    std::vector<SRSCluster *> & clustersInPlane = planeEvent.fClusters ;
+    std::vector<SRSClusterRecord>::const_iterator  record_itr;
+    for (record_itr = clusterRecords.begin(); record_itr != clusterRecords.end(); record_itr++) {
+      const SRSClusterHit * firstHit = &sortedHits[record_itr->fFirstHit] ;
+
+      SRSCluster * cluster = new SRSCluster(fMinClusterSize, fMaxClusterSize, fIsClusterMaxOrTotalADCs) ;
+      cluster->SetNbAPVsFromPlane(firstHit->fHit->GetNbAPVsFromPlane());
+      cluster->SetPlaneSize(firstHit->fHit->GetPlaneSize());
+      cluster->SetPlane(firstHit->fHit->GetPlane());
+      for (int i = 0; i < record_itr->fNbOfHits; i++) cluster->AddHit(firstHit[i].fHit) ;
+
       if (!cluster->IsGoodCluster()) {
-	std::cout <<"  OPS Bad cluster!!!!"<<std::endl;
+	Logger::getInstance().count(iCountBadClusters) ;
 	delete cluster ;
 	continue ;
       }
@@ -203,15 +243,10 @@ void SRSEventBuilder::ComputeClustersInDetectorPlane() {
 	cluster->SetClusterPositionCorrection(false) ;
 	cluster->ComputeClusterPositionWithoutCorrection() ;
       }
-      fClustersInDetectorPlaneMap[detPlane].push_back(cluster) ;
+      clustersInPlane.push_back(cluster) ;
     }
-    fClustersInDetectorPlaneMap[detPlane].sort(CompareClusterADCs) ;
-    
-    listOfHits.clear() ;
-    clustersMap.clear() ;
+    std::stable_sort(clustersInPlane.begin(), clustersInPlane.end(), CompareClusterADCs) ;
   }
-  
-
 }
 
 
@@ -224,19 +259,19 @@ bool  SRSEventBuilder::IsAGoodEventInDetector(std::string detector) {
     
     if( readoutBoard == "PADPLANE") {
       std::string padPlane = (mapping->GetDetectorPlaneListFromDetector(detector)).front();
-      std::list <SRSHit*> listOfHits = fHitsInDetectorPlaneMap[padPlane];
-        int size = listOfHits.size() ;
-        if (size > 0) IsGoodEventInDetector = true ;
+      SRSPlaneEvent * planeEvent = FindPlaneEvent(padPlane) ;
+        if (planeEvent && (planeEvent->fHits.size() > 0)) IsGoodEventInDetector = true ;
     }
     
     else if(readoutBoard == "CMSGEM") {
       std::string plane = (mapping->GetDetectorPlaneListFromDetector(detector)).front();
       // Temporary good after clusterization ..
-      int clusterMultiplicity = fClustersInDetectorPlaneMap[plane].size() ;
+      SRSPlaneEvent * planeEvent = FindPlaneEvent(plane) ;
+      int clusterMultiplicity = planeEvent ? planeEvent->fClusters.size() : 0 ;
       //int clusterMultiplicity = 1;
-      std::cout <<" ==== Cluster multiplicity in the event "<<clusterMultiplicity <<"  compared with max "<<fMaxClusterMultiplicity<<std::endl;
+      Logger::getInstance().logf(QualityControl::Uniformity::kLogDebug, "SRSEventBuilder::IsAGoodEventInDetector()", "cluster multiplicity %d compared with max %d", clusterMultiplicity, fMaxClusterMultiplicity) ;
       if ( (clusterMultiplicity == 0) ||  (clusterMultiplicity > fMaxClusterMultiplicity) ) {
-	fClustersInDetectorPlaneMap[plane].clear() ;
+	if (planeEvent) ClearClusters(* planeEvent) ;
 	IsGoodEventInDetector = false ;
       }
       else {
@@ -279,7 +314,8 @@ bool  SRSEventBuilder::IsAGoodEventInDetector(std::string detector) {
         }
       */
     }
-    std::cout <<" Is in "<<detector<<"  a good event? "<<IsGoodEventInDetector<<std::endl;
+    if (!IsGoodEventInDetector) Logger::getInstance().count(iCountRejectedInDet) ;
+    Logger::getInstance().logf(QualityControl::Uniformity::kLogDebug, "SRSEventBuilder::IsAGoodEventInDetector()", "good event in %s: %d", detector.c_str(), (int) IsGoodEventInDetector) ;
     return IsGoodEventInDetector ;
 }
 
@@ -4,21 +4,36 @@
 #include "SRSFECDecoder.h"
 #include "SRSMapping.h"
 #include "SRSAPVEvent.h"
+#include "SRSAPVContext.h"
 #include "SRSEventBuilder.h"
-SRSFECDecoder::SRSFECDecoder(SRSEventBuilder* eventBuilder): feventBuilder(eventBuilder){
+#include "SRSPedestal.h"
+#include "Logger.h"
+SRSFECDecoder::SRSFECDecoder(SRSEventBuilder* eventBuilder, SRSPedestal* ped, const SRSAPVContextTable* apvContexts): feventBuilder(eventBuilder), fPedestal(ped), fAPVContexts(apvContexts), fIsZeroSuppressed(true){
+  fIsActiveChannel = false ;
+  //=== The context table already knows the active channels
+  if (fAPVContexts) return ;
+
+  //=== Otherwise 16 bits mask of the mapped ADC channels of each FEC
+  fActiveChannels.assign(SRSAPVContextTable::kNbOfFECs, 0) ;
   SRSMapping * mapping = SRSMapping::GetInstance();
   std::map <int, int> apvNoFromApvIDMap = mapping->GetAPVNoFromIDMap();
-  fActiveFecChannelsMap.clear() ;
   std::map <int, int>::const_iterator adcChannel_itr ;
   for(adcChannel_itr = apvNoFromApvIDMap.begin(); adcChannel_itr != apvNoFromApvIDMap.end(); ++adcChannel_itr) {
     int apvid = (* adcChannel_itr).first ;
     int activeChannel = apvid & 0xF;
     int fecId = (apvid >> 4 ) & 0xF;
-    fActiveFecChannelsMap[fecId].push_back(activeChannel) ;
+    fActiveChannels[fecId] |= (1 << activeChannel) ;
   }
 
 }
 
+bool
+SRSFECDecoder::IsActiveChannel(int fec_id, int adc_channel) const {
+  if (fAPVContexts) return fAPVContexts->IsActive(fec_id, adc_channel) ;
+  if ((fec_id < 0) || (fec_id >= (int) fActiveChannels.size()) || (adc_channel < 0) || (adc_channel >= SRSAPVContextTable::kNbOfADCChannels)) return false ;
+  return (fActiveChannels[fec_id] >> adc_channel) & 1 ;
+}
+
 void
 SRSFECDecoder::decodeFEC(unsigned int nw, unsigned long* buffer){
   //  std::cout <<" START DECODING"<<std::endl;
@@ -30,6 +45,7 @@ SRSFECDecoder::decodeFEC(unsigned int nw, unsigned long* buffer){
   current_offset += 2;
   unsigned int eqHeaderWord = buffer[current_offset];
   unsigned int fecID = eqHeaderWord & 0xff;
+  fIsActiveChannel = this->IsActiveChannel(fecID, 0) ;
   unsigned int apvID=0;
   unsigned int adcChannel =0;
   current_offset +=5;
@@ -72,8 +88,9 @@ SRSFECDecoder::decodeFEC(unsigned int nw, unsigned long* buffer){
     //         New packet (or frame) FEC channel data in the equipment                                         //                                           
     //=========================================================================================================//                                           
 
-    if (((rawdata >> 8) & 0xffffff) == 0x41505a) {
-      data32BitsVector.pop_back() ;
+    //=== "APZ" for zero suppressed frames, "ADC" for full readout frames
+    if (((rawdata >> 8) & 0xffffff) == 0x41505a || ((rawdata >> 8) & 0xffffff) == 0x414443) {
+      if(!data32BitsVector.empty()) data32BitsVector.pop_back() ;
       if(!data32BitsVector.empty()) {
         apvID = (fecID << 4) | adcChannel ;
         //      BuildHits(data32BitsVector, fecID, adcChannel, ped, eventBuilder, zeroSupCut) ;                                                             
@@ -83,11 +100,14 @@ SRSFECDecoder::decodeFEC(unsigned int nw, unsigned long* buffer){
 
       unsigned int currentAPVPacketHdr = rawdata  ;
       adcChannel = currentAPVPacketHdr & 0xff ;
+      fIsZeroSuppressed = (((currentAPVPacketHdr >> 8) & 0xffffff) == 0x41505a) ;
       //=== REINITIALISE EVERYTHING                                                                                                                         
       if(adcChannel > 15) {
-        printf("  SRSFECEventDecoder => ERROR #### fecID=%d, ADC Channel=%d, apvID=%d, \n",fecID, adcChannel, apvID) ;
+        QualityControl::Uniformity::Logger::getInstance().logf(QualityControl::Uniformity::kLogError, "SRSFECDecoder::decodeFEC()", "fecID=%d, ADC Channel=%d, apvID=%d", fecID, adcChannel, apvID) ;
         break ;
       }
+      //=== Unmapped or masked channel: the payload is not even copied
+      fIsActiveChannel = this->IsActiveChannel(fecID, adcChannel) ;
       
       data32BitsVector.clear() ;
       fIsNewPacket = true;      
@@ -98,7 +118,7 @@ SRSFECDecoder::decodeFEC(unsigned int nw, unsigned long* buffer){
     //         apv data in the packet (frame)                                                                 //                                            
     //========================================================================================================//                                            
     if (!fIsNewPacket) {
-      data32BitsVector.push_back(rawdata) ;
+      if (fIsActiveChannel) data32BitsVector.push_back(rawdata) ;
       current_offset++ ;
       continue ;
     }
@@ -108,17 +128,18 @@ SRSFECDecoder::decodeFEC(unsigned int nw, unsigned long* buffer){
 
 
 void 
-SRSFECDecoder::BuildHits(std::vector<unsigned long int> data32bits, int fec_id, int adc_channel, SRSEventBuilder* eventBuilder){
-  SRSMapping * mapping = SRSMapping::GetInstance();
-  fActiveFecChannels.clear();
+SRSFECDecoder::BuildHits(const std::vector<unsigned long int> & data32bits, int fec_id, int adc_channel, SRSEventBuilder* eventBuilder){
+  int apvID = (fec_id << 4) | adc_channel ;
   //  if (fdebug) 
   //  std::cout <<" +++ SRSFECDecoder: BuildHIts FECid="<<fec_id<<std::endl;
-  fActiveFecChannels = fActiveFecChannelsMap[fec_id] ;
 
-  int apvID = (fec_id << 4) | adc_channel ;
-  if (std::find(fActiveFecChannels.begin(), fActiveFecChannels.end(), adc_channel) != fActiveFecChannels.end() ) {
+  //=== Unmapped or masked channel: one bit test, otherwise one lookup in the per run table
+  if (IsActiveChannel(fec_id, adc_channel)) {
+    const SRSAPVContext * context = fAPVContexts ? fAPVContexts->GetContext(fec_id, adc_channel) : 0 ;
     int zeroSupCut = -999;
-    SRSAPVEvent * apvEvent = new SRSAPVEvent(fec_id, adc_channel, apvID, zeroSupCut, fPacketSize) ;
+    SRSAPVEvent * apvEvent = 0 ;
+    if (context) apvEvent = new SRSAPVEvent(context, zeroSupCut, fPacketSize) ;
+    else         apvEvent = new SRSAPVEvent(fec_id, adc_channel, apvID, zeroSupCut, fPacketSize) ;
     apvEvent->SetHitMaxOrTotalADCs(eventBuilder->GetHitMaxOrTotalADCs()) ;
 
     std::vector<unsigned long int >::const_iterator data_itr ;
@@ -135,7 +156,19 @@ SRSFECDecoder::BuildHits(std::vector<unsigned long int> data32bits, int fec_id,
     //    if (zeroSupCut!=-999) apvEvent->SetPedestals(ped->GetAPVNoises(apvEvent->GetAPVID()), ped->GetAPVOffsets(apvEvent->GetAPVID()), ped->GetAPVMaskedChannels(apvEvent->GetAPVID())) ;
 
     //    list <SRSHit*> listOfHits = apvEvent->ComputeListOfAPVHits(eventBuilder->GetHitMaxOrTotalADCs()) ;                                                                                           
-    std::list<SRSHit*> listOfHits = apvEvent->ComputeListOfAPVHitsZS() ;
+    std::list<SRSHit*> listOfHits ;
+    if (fIsZeroSuppressed) {
+      listOfHits = apvEvent->ComputeListOfAPVHitsZS() ;
+    }
+    else if (context && context->fIsPedestalLoaded) {
+      apvEvent->SetZeroSupCut(eventBuilder->GetZeroSupCut()) ;
+      listOfHits = apvEvent->ComputeListOfAPVHits() ;
+    }
+    else if (!context && fPedestal && fPedestal->IsAPVLoaded(apvID)) {
+      apvEvent->SetZeroSupCut(eventBuilder->GetZeroSupCut()) ;
+      apvEvent->SetPedestals(fPedestal->GetAPVNoises(apvID), fPedestal->GetAPVOffsets(apvID), fPedestal->GetAPVMaskedChannels(apvID)) ;
+      listOfHits = apvEvent->ComputeListOfAPVHits() ;
+    }
     std::list <SRSHit*>::const_iterator  hit_itr;
     //    std::cout <<"Number of hit found "<<listOfHits.size()<<std::endl;
     //    if (fdebug)
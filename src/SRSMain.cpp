@@ -4,9 +4,32 @@
 #include "SRSMapping.h"
 #include "SRSHit.h"
 #include "SRSAPVEvent.h"
+#include "SRSAPVContext.h"
 #include "SRSFECDecoder.h"
 #include "SRSEventBuilder.h"
+#include "SRSClusterEngine.h"
 #include "SRSOutputROOT.h"
+#include "SRSPedestal.h"
+#include "SRSRawStream.h"
+#include "SRSRawSource.h"
+#include "SRSRawFramer.h"
+#include "SRSRawIndex.h"
+#include "ClusterCache.h"
+#include "Logger.h"
+
+//C++ Includes
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <map>
+#include <sys/wait.h>
+#include <unistd.h>
+
+//ROOT Includes
+#include "TFileMerger.h"
+
+// Longest FEC fragment in words, longer ones are corrupted (no end of fragment mark)
+static const unsigned int nMax = 5000;
 
 //SRSMain* SRSMain::_repro = 0;
 
@@ -25,134 +48,244 @@ SRSMain::Reprocessor(const std::string& rawfile, const std::string& config){
 void 
 SRSMain::Reprocess(){
 
-  std::ifstream ifs(_rawfile.c_str(),std::ios::binary);
-  unsigned int nMax = 5000;
-  unsigned long buffer[nMax];
-  std::vector<unsigned int> previous;
-  unsigned long event[nMax];
-  unsigned int nw = 0;
-  bool newevent=true;
-  unsigned int nEvent = 0;
-  unsigned int prenevt =0;
-  unsigned int iFEC=0,nFEC = 2;
+  if (std::string(_conf->GetRunType()) == "PEDESTAL") {
+    this->ReprocessPedestal();
+    return;
+  }
+
+  unsigned int nbOfChunks = std::max(std::stoi(_conf->GetRecoChunks()), 1);
+  std::string eventRange = _conf->GetEventRange();
+
+  // Whole run in this process: the raw files are read straight through, no index is needed
+  if (nbOfChunks == 1 && eventRange == "ALL") {
+    this->ReprocessEvents(0, 1, 0);
+    return;
+  }
+
+  // Event ranges need the offsets of the events, indexed once and saved next to the raw file
+  SRSRawIndex index;
+  std::string indexFile = this->GetRunName() + SRSRawIndex::GetExtension();
+  if (!index.Load(indexFile, SRSRawStream::GetSize(_rawfile))) {
+    if (!index.Build(_rawfile, nMax)) {
+      std::cout<<" +++ reprocess: cannot index the raw files "<<_rawfile<<std::endl;
+      return;
+    }
+    index.Save(indexFile);
+  }
+
+  unsigned int firstEvent = 1, lastEvent = index.GetNbOfEvents();
+  if (eventRange != "ALL") {
+    unsigned int first = 0, last = 0;
+    if (sscanf(eventRange.c_str(), "%u-%u", &first, &last) != 2 || first < 1 || last < first) {
+      std::cout<<" +++ reprocess: EVENTRANGE "<<eventRange<<" not understood, expected ALL or first-last"<<std::endl;
+      return;
+    }
+    firstEvent = first;
+    lastEvent = std::min(last, lastEvent);
+    // The output of a range does not overwrite the output of the whole run
+    _outputName = this->GetRunName() + "_events" + eventRange;
+  }
+  if (firstEvent > lastEvent) {
+    std::cout<<" +++ reprocess: no event "<<eventRange<<" in "<<_rawfile<<" ("<<index.GetNbOfEvents()<<" events)"<<std::endl;
+    return;
+  }
+
+  if (nbOfChunks == 1) this->ReprocessEvents(&index, firstEvent, lastEvent);
+  else this->ReprocessChunks(index, firstEvent, lastEvent, nbOfChunks);
+}
+
+// Reconstructs the events firstEvent to lastEvent (from 1, lastEvent == 0 up to the end of the run),
+// starting at the offset of firstEvent in the index if one is given, else at the start of the run
+void
+SRSMain::ReprocessEvents(const SRSRawIndex* index, unsigned int firstEvent, unsigned int lastEvent){
+  // Optional flat binary copy of the clusters, named like the ROOT files written by Close()
+  if (std::string(_conf->GetClusterCache()) == "YES") {
+    for (unsigned int iOut = 0; iOut < _roots.size(); iOut++) {
+      _roots[iOut]->SetClusterCacheFile(this->GetOutputName() + _outputSuffixes[iOut] + "_dataTree" + QualityControl::Uniformity::strClusterCache_Ext);
+    }
+  }
+
+  //A run may be spread over several raw files (comma separated list), they are read as one stream
+  SRSRawStream ifs(_rawfile);
+  // The framer only delivers well formed FEC fragments, it resynchronizes on the next end of fragment
+  // mark when a fragment is corrupted or longer than nMax words
+  SRSRawFramer framer(ifs, nMax);
+  if (index && !framer.Seek(index->GetEventOffset(firstEvent))) {
+    std::cout<<" +++ reprocess: cannot reach event "<<firstEvent<<" in "<<_rawfile<<std::endl;
+    return;
+  }
+  std::vector<unsigned long> fragment;
+  int fecID = 0;
+  unsigned int nEvent = firstEvent - 1;
+  unsigned int nFEC = _nbOfFECs;
+  // FEC expected next in the current event, 0 == no event open
+  unsigned int nextFEC = 0;
   SRSEventBuilder* eventBuilder = 0;
-  bool debug_s=false;
-  do {
-    if (newevent){
-      newevent = false;
+  // One builder for the run, reset at the first fragment of each event (its containers keep their capacity)
+  std::unique_ptr<SRSEventBuilder> runEventBuilder(new SRSEventBuilder(0,_conf->GetMaxClusterSize(), _conf->GetMinClusterSize(), _conf->GetZeroSupCut(), _conf->GetRunType(), 
+								      std::string(_conf->GetClusterPositionCorrectionFlag()).find("applyCorrections")!=std::string(_conf->GetClusterPositionCorrectionFlag()).npos));
+  runEventBuilder->SetClusterEngine(_clusterEngine.get());
+  QualityControl::Uniformity::Logger & logger = QualityControl::Uniformity::Logger::getInstance();
+  static const int iCountIncomplete = logger.registerCounter("SRSMain: incomplete events dropped");
+  static const int iCountOutOfOrder = logger.registerCounter("SRSMain: out of order FEC fragments dropped");
+
+  // Each FEC data finish with 0xfafafafa and one events is componsed by NFEC fragments (FEC 1 to nFEC, in order).
+  // The event builder collect the hit of the fragments and make the clusters.
+  while (framer.NextFragment(fragment, fecID)) {
+    // First FEC: a new event starts, an event still open misses fragments and is dropped
+    if (fecID == 1) {
+      if (nextFEC != 0) logger.count(iCountIncomplete);
+      nextFEC = 0;
+      if (lastEvent != 0 && nEvent == lastEvent) break;
       nEvent++;
-      if (nEvent%1000==0) std::cout<<" +++ reprocess: Event # "<<nEvent<<std::endl;
+      if (nEvent%1000==0) logger.logf(QualityControl::Uniformity::kLogInfo, "SRSMain::Reprocess()", "Event # %u", nEvent);
+      eventBuilder = runEventBuilder.get();
+      eventBuilder->Reset(nEvent);
+      nextFEC = 1;
     }
-    unsigned int j  =0x0;
-    ifs.read((char*)&j,4);
-    //    if (debug_s) std::cout <<" j  "<<std::hex<<j<<std::endl;
-    if (!ifs.eof()){
-      buffer[nw]=j&0xffffffff;
-      nw++;
-      if (nw >= nMax) {
-	std::cout<<" +++ reprocess: Number of long words on this event exceed the maximum "<<nMax<<" please change nMax"<<std::endl;
-	this->Close();
-        exit(-1);
-      }
-      // Each FEC data finish with 0xfafafafa and one events is componsed by NFEC fragments. The event builder collect the hit of the                                                                    
-      // fragments and make the clusters.                                                                                                                                                                
-      if ((j&0xffffffff) == 0xfafafafa){
-        bool goodfragment=false;
-        iFEC++;
-	if (debug_s) std::cout <<std::dec<<" end of data fragment record mark "<<std::endl;
-        // realign the words skiping event header, the event start 8 words before the first adc mark (0x41505a)
-        bool first = true;                                                                                          
-	int start_eventRecord=0;
-	int end_eventRecord=0;
-        for (unsigned int ir=0;ir<nw;ir++){
-          if( ((buffer[ir] >> 8) & 0xffffff) == 0x41505a) {
-            if (first) {
-	      // take out the event header, keep the fec header and the adc payloads
-              start_eventRecord = ir - 8;
-              if (start_eventRecord < 0) {
-		if (debug_s)std::cout <<"  +++ reprocess: Wrong Start of Event"<<std::endl;
-		goodfragment = false;
-              } else {
-		goodfragment = ( ((buffer[ir-6])&0xff) == iFEC);
-	      }
-              first = false;
-            }
-          }
-	}
-        end_eventRecord=nw-start_eventRecord;
-        int tFEC=0;
-        if (previous.size()>0){
-          if (goodfragment ) {
-            //  build hits from previous events; 
-	    //  decode previous
-            //  and copy actual event into previous
-            for (unsigned int i=0;i<previous.size();i++){
-              event[i]=previous[i];
-            }
-	    if (debug_s) std::cout <<" +++ reprocess: event # "<<nEvent<<" FEC "<<2-iFEC+1<<std::endl;
-            tFEC=2-iFEC+1;
-            if (tFEC==1) {
-              eventBuilder = new SRSEventBuilder(nEvent,_conf->GetMaxClusterSize(), _conf->GetMinClusterSize(), _conf->GetZeroSupCut(), _conf->GetRunType(), 
-						 std::string(_conf->GetClusterPositionCorrectionFlag()).find("applyCorrections")!=std::string(_conf->GetClusterPositionCorrectionFlag()).npos);
-            }
-            SRSFECDecoder dec(eventBuilder);
-            dec.decodeFEC(previous.size(),event);
-	    if(debug_s) std::cout << " >>>> Good! Event  "<<std::setw(6)<<prenevt<<" iFEC "<<tFEC<<" # word  "<<previous.size()<<std::endl;
-            previous.clear();
-            for (unsigned int ir=0; ir < nw-start_eventRecord;ir++){
-              previous.push_back(buffer[start_eventRecord+ir]);
-            }
-            prenevt=nEvent;
-          }else{
-            //  bad fragment    merge fragment with previous fregment
-            iFEC--;
-            for (unsigned int ir=0;ir<nw;ir++){
-              previous.push_back(buffer[ir]);
-            }
-            prenevt=nEvent;
-            tFEC=iFEC;
-            if (tFEC==1) {
-              eventBuilder = new SRSEventBuilder(nEvent,_conf->GetMaxClusterSize(), _conf->GetMinClusterSize(), _conf->GetZeroSupCut(), _conf->GetRunType(), 
-						 std::string(_conf->GetClusterPositionCorrectionFlag()).find("applyCorrections")!=std::string(_conf->GetClusterPositionCorrectionFlag()).npos);
-            }
-	    if(debug_s)	std::cout << " >>>> BAD! Merging two fragment in  "<<nEvent<< " tFEC "<<iFEC<<" # word "<<previous.size()<<std::endl;
-	    //decode previous                                                                                                                                                                            
-            for(unsigned int i=0;i<previous.size();i++){
-              event[i]=previous[i];
-            }
-	    if (debug_s) std::cout <<" +++ reprocess: event # "<<nEvent<<" FEC "<<tFEC<<std::endl;
-            SRSFECDecoder dec(eventBuilder);
-            dec.decodeFEC(previous.size(),event);
-            previous.clear();
-          }	  
-        }else{
-	  if(debug_s) std::cout <<" >>>> SKIP the decoding waiting next fragment"<<std::endl;
-          for (unsigned int ir=0; ir < nw-start_eventRecord;ir++){
-            previous.push_back(buffer[start_eventRecord+ir]);
-          }
-          prenevt=nEvent;
-        }
-        if (tFEC == nFEC){
-          // The event is now complete and we can form the cluster
-	  if (debug_s) std::cout <<" +++ reprocess: compute cluster"<<std::endl;
-          eventBuilder->ComputeClustersInDetectorPlane();
-          // Fill the trees
-          _root->FillRootFile(eventBuilder);
-          eventBuilder=0;
-	  
-        }
-        if (iFEC == 2) {
-          newevent = true;
-          //  delete eventBuilder;
-          iFEC = 0;
-        }
-        nw = 0;
-      } // end of Mark control
-    } // good file control...
-  }while(!ifs.eof());
+    if ((nextFEC == 0) || (fecID != (int) nextFEC)) {
+      logger.count(iCountOutOfOrder);
+      if (nextFEC != 0) logger.count(iCountIncomplete);
+      nextFEC = 0;
+      continue;
+    }
+
+    // skip the words before the event header, the event start 8 words before the first adc mark (0x41505a)
+    unsigned int start_eventRecord = 0;
+    while (((fragment[start_eventRecord] >> 8) & 0xffffff) != 0x41505a && ((fragment[start_eventRecord] >> 8) & 0xffffff) != 0x414443) start_eventRecord++;
+    start_eventRecord -= 8;
+
+    SRSFECDecoder dec(eventBuilder, _ped.get(), _apvContexts.get());
+    dec.decodeFEC(fragment.size() - start_eventRecord, &fragment[start_eventRecord]);
+
+    if (nextFEC == nFEC) {
+      // The event is now complete and we can form the cluster
+      eventBuilder->ComputeClustersInDetectorPlane();
+      // Fill the trees, each output takes the planes of its detector from the same event
+      for (unsigned int iOut = 0; iOut < _roots.size(); iOut++) _roots[iOut]->FillRootFile(eventBuilder);
+      eventBuilder=0;
+      nextFEC = 0;
+    }
+    else nextFEC++;
+  }
+  if (nextFEC != 0) logger.count(iCountIncomplete);
   ifs.close();
-  if (eventBuilder != 0){
-    //    delete eventBuilder;
+
+  // Counters of the corrupted data and the byte ranges skipped
+  framer.WriteReport(this->GetOutputName() + "_rawReport.txt");
+  if (framer.GetNbOfCorruptFragments() > 0) {
+    std::cout<<" +++ reprocess: "<<framer.GetNbOfCorruptFragments()<<" corrupted fragments, "<<framer.GetNbOfSkippedBytes()<<" bytes skipped, see "<<this->GetOutputName()<<"_rawReport.txt"<<std::endl;
+  }
+}
+
+
+// The events are split in nbOfChunks contiguous ranges, each reconstructed by a child process writing
+// <output>_part<i> files; they are merged in event order once all children are done. Processes rather
+// than threads: the mapping, the ROOT trees and the output are global to the job.
+bool
+SRSMain::ReprocessChunks(const SRSRawIndex& index, unsigned int firstEvent, unsigned int lastEvent, unsigned int nbOfChunks){
+  unsigned int nbOfEvents = lastEvent - firstEvent + 1;
+  if (nbOfChunks > nbOfEvents) nbOfChunks = nbOfEvents;
+
+  std::vector<std::string> partNames;
+  std::vector<pid_t> pids;
+  // Buffered output would be printed again by each child
+  std::cout.flush();
+  fflush(stdout);
+  for (unsigned int iChunk = 0; iChunk < nbOfChunks; iChunk++) {
+    unsigned int chunkFirst = firstEvent + (unsigned long long) iChunk * nbOfEvents / nbOfChunks;
+    unsigned int chunkLast  = firstEvent + (unsigned long long) (iChunk + 1) * nbOfEvents / nbOfChunks - 1;
+    partNames.push_back(this->GetOutputName() + "_part" + std::to_string(iChunk));
+
+    pid_t pid = fork();
+    if (pid == 0) {
+      int status = 0;
+      try {
+        _outputName = partNames.back();
+        this->ReprocessEvents(&index, chunkFirst, chunkLast);
+        this->Close();
+      }
+      catch (std::exception& e) {
+        std::cout<<" +++ reprocess: events "<<chunkFirst<<"-"<<chunkLast<<" failed: "<<e.what()<<std::endl;
+        status = 1;
+      }
+      std::cout.flush();
+      fflush(stdout);
+      _exit(status);
+    }
+    if (pid < 0) {
+      std::cout<<" +++ reprocess: cannot start the process of events "<<chunkFirst<<"-"<<chunkLast<<std::endl;
+      break;
+    }
+    pids.push_back(pid);
+    std::cout<<" +++ reprocess: events "<<chunkFirst<<"-"<<chunkLast<<" in process "<<pid<<std::endl;
+  }
+
+  bool isSuccess = (pids.size() == nbOfChunks);
+  for (unsigned int iChunk = 0; iChunk < pids.size(); iChunk++) {
+    int status = 0;
+    if (waitpid(pids[iChunk], &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      std::cout<<" +++ reprocess: process "<<pids[iChunk]<<" of "<<partNames[iChunk]<<" failed"<<std::endl;
+      isSuccess = false;
+    }
+  }
+
+  // Nothing is written by Close() in this process, an empty output would hide the failure
+  _isOutputWritten = true;
+  if (!isSuccess || !this->MergeChunks(partNames)) {
+    std::cout<<" +++ reprocess: the outputs of the chunks are left in "<<this->GetOutputName()<<"_part*"<<std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Concatenates the ROOT files and cluster caches of the chunks, in order, into the outputs of the job
+// (one per detector if they are split); the part files are removed, the raw reports of the chunks are kept
+bool
+SRSMain::MergeChunks(const std::vector<std::string>& partNames){
+  std::string strClusterCacheExt = QualityControl::Uniformity::strClusterCache_Ext;
+  bool isClusterCache = (std::string(_conf->GetClusterCache()) == "YES");
+
+  for (unsigned int iOut = 0; iOut < _outputSuffixes.size(); iOut++) {
+    std::string strSuffix = _outputSuffixes[iOut];
+
+    TFileMerger merger(kFALSE);
+    merger.OutputFile((this->GetOutputName() + strSuffix + "_dataTree.root").c_str(), "RECREATE");
+    for (unsigned int iPart = 0; iPart < partNames.size(); iPart++) merger.AddFile((partNames[iPart] + strSuffix + "_dataTree.root").c_str(), kFALSE);
+    if (!merger.Merge()) {
+      std::cout<<" +++ reprocess: cannot merge the ROOT files of the chunks into "<<this->GetOutputName()<<strSuffix<<"_dataTree.root"<<std::endl;
+      return false;
+    }
+
+    if (isClusterCache) {
+      std::vector<std::string> cacheNames;
+      for (unsigned int iPart = 0; iPart < partNames.size(); iPart++) cacheNames.push_back(partNames[iPart] + strSuffix + "_dataTree" + strClusterCacheExt);
+      if (!QualityControl::Uniformity::mergeClusterCaches(cacheNames, this->GetOutputName() + strSuffix + "_dataTree" + strClusterCacheExt)) return false;
+    }
+  }
+
+  for (unsigned int iOut = 0; iOut < _outputSuffixes.size(); iOut++) {
+    for (unsigned int iPart = 0; iPart < partNames.size(); iPart++) {
+      remove((partNames[iPart] + _outputSuffixes[iOut] + "_dataTree.root").c_str());
+      if (isClusterCache) remove((partNames[iPart] + _outputSuffixes[iOut] + "_dataTree" + strClusterCacheExt).c_str());
+    }
+  }
+  std::cout<<" +++ reprocess: "<<partNames.size()<<" chunks merged into "<<_outputSuffixes.size()<<" output(s) "<<this->GetOutputName()<<"*_dataTree.root"<<std::endl;
+  return true;
+}
+
+// Pedestal run: offsets and noises of every strip are accumulated over the whole raw file
+// and stored in the compact pedestal file given by PEDFILE
+void
+SRSMain::ReprocessPedestal(){
+  SRSPedestal ped;
+  ped.SetMaskedChannelCut(std::stof(_conf->GetMaskedChannelCut()));
+  if (ped.ComputePedestals(_rawfile, std::stoi(_conf->GetNbOfThreads()))) {
+    ped.Print();
+    ped.SavePedestalFile(_conf->GetPedestalFile());
+  }
+  else {
+    std::cout<<" +++ reprocess: no pedestal could be computed from "<<_rawfile<<std::endl;
   }
 }
 
@@ -164,8 +297,9 @@ SRSMain::SRSMain(const std::string& rawfile, const std::string& config) :
 	_conf(new SRSConfiguration),
 	//_maps(new SRSMapping),
 	_maps( SRSMapping::GetInstance() ),
-	_root(new SRSOutputROOT),
-	_isClosed(false)
+	_nbOfFECs(2),
+	_isClosed(false),
+	_isOutputWritten(false)
   {
   this->Init();
 }
@@ -174,28 +308,128 @@ void
 SRSMain::Init(){
  //_conf = new SRSConfiguration(_config.c_str());
  _conf->Init(_config.c_str());
+
+ // Levels, rate limit and optional file of the diagnostics
+ QualityControl::Uniformity::Logger & logger = QualityControl::Uniformity::Logger::getInstance();
+ logger.setLevel(std::string(_conf->GetLogLevel()));
+ logger.setRateLimit(std::stof(_conf->GetLogRate()), 10);
+ logger.setLogFile(_conf->GetLogFile());
  //_maps = SRSMapping::GetInstance();
  _maps->LoadDefaultMapping(_conf->GetMappingFile());
  _maps->LoadAPVtoPadMapping(_conf->GetPadMappingFile());
  _maps->PrintMapping();
  //_root = new SRSOutputROOT(_conf->GetZeroSupCut(), _conf->GetROOTDataType());
- _root->InitRootFile();
- _root->SetZeroSupCut(std::stoi(_conf->GetZeroSupCut()));
- _root->SetROOTDataType(_conf->GetROOTDataType());
+
+ // An event is made of the fragments of FEC 1 to the highest FEC of the mapping (2 at least, as before)
+ std::map<int, int> apvNoFromID = _maps->GetAPVNoFromIDMap();
+ for (std::map<int, int>::const_iterator apv_itr = apvNoFromID.begin(); apv_itr != apvNoFromID.end(); ++apv_itr) {
+   _nbOfFECs = std::max(_nbOfFECs, (unsigned int) ((*apv_itr).first >> 4));
+ }
+
+ // Detectors written to their own output, in the order of their IDs; none == a single output for all
+ std::vector<std::string> vec_strDetectors;
+ if (std::string(_conf->GetSplitDetectors()) == "YES") {
+   std::map<int, std::string> detectorFromID = _maps->GetDetectorFromIDMap();
+   for (std::map<int, std::string>::const_iterator det_itr = detectorFromID.begin(); det_itr != detectorFromID.end(); ++det_itr) {
+     if (std::find(vec_strDetectors.begin(), vec_strDetectors.end(), (*det_itr).second) == vec_strDetectors.end()) vec_strDetectors.push_back((*det_itr).second);
+   }
+   if (vec_strDetectors.size() < 2) vec_strDetectors.clear();
+ }
+ if (vec_strDetectors.empty()) vec_strDetectors.push_back("");
+
+ for (unsigned int iOut = 0; iOut < vec_strDetectors.size(); iOut++) {
+   std::unique_ptr<SRSOutputROOT> root(new SRSOutputROOT);
+   root->InitRootFile();
+   root->SetZeroSupCut(std::stoi(_conf->GetZeroSupCut()));
+   root->SetROOTDataType(_conf->GetROOTDataType());
+   if (!vec_strDetectors[iOut].empty()) {
+     root->SetDetector(_maps->GetDetectorIDFromDetector(vec_strDetectors[iOut]));
+     std::cout<<" +++ SRSMain: detector "<<vec_strDetectors[iOut]<<" written to *_"<<vec_strDetectors[iOut]<<"_dataTree.root"<<std::endl;
+   }
+   _roots.push_back(std::move(root));
+   _outputSuffixes.push_back(vec_strDetectors[iOut].empty() ? "" : "_" + vec_strDetectors[iOut]);
+ }
+
+ // One clustering engine for the whole run, its buffers are reused from event to event
+ _clusterEngine.reset(new SRSClusterEngine);
+ _clusterEngine->SetMaxGap(std::stoi(_conf->GetClusterMaxGap()));
+ _clusterEngine->SetSeedCut(std::stof(_conf->GetClusterSeedCut()));
+ _clusterEngine->SetNeighbourCut(std::stof(_conf->GetClusterNeighbourCut()));
+
+ // Full readout (non zero suppressed) data need the pedestals of a previous pedestal run
+ if (std::string(_conf->GetRunType()) != "PEDESTAL") {
+   _ped.reset(new SRSPedestal);
+   _ped->SetMaskedChannelCut(std::stof(_conf->GetMaskedChannelCut()));
+   if (!_ped->LoadPedestalFile(_conf->GetPedestalFile())) {
+     std::cout<<" +++ SRSMain: no pedestal file loaded, full readout APV frames will be skipped"<<std::endl;
+     _ped.reset();
+   }
+
+   // Mapping & pedestal constants of every APV, looked up once for the run instead of per APV frame
+   _apvContexts.reset(new SRSAPVContextTable);
+   _apvContexts->Build(_ped.get(), std::stof(_conf->GetAPVMaskFraction()));
+ }
 }
 
-void SRSMain::Close(){
-  std::string strRunName = _rawfile;
-  _isClosed = true;
+// Raw file name without its ".raw" extension, the output files are named after it
+std::string SRSMain::GetRunName() const{
+  return GetRunName(_rawfile);
+}
+
+// Named after the first raw file of the run; a member of a tar archive (archive:member) is named
+// after the member, next to the archive
+std::string SRSMain::GetRunName(const std::string& rawfile){
+  std::string strRunName = rawfile.substr(0, rawfile.find(','));
+  std::string strDiskFile = SRSRawSource::GetDiskFile(strRunName);
+  if (strDiskFile != strRunName) {
+    std::string strMember = strRunName.substr(strDiskFile.size() + 1);
+    if (strMember.rfind('/') != std::string::npos) strMember.erase(0, strMember.rfind('/') + 1);
+    strRunName = (strDiskFile.rfind('/') != std::string::npos) ? strDiskFile.substr(0, strDiskFile.rfind('/') + 1) + strMember : strMember;
+  }
   if( strRunName.find(".raw") != std::string::npos){
 	strRunName.erase(strRunName.find(".raw"), strRunName.length() - strRunName.find(".raw") );
   }
+  return strRunName;
+}
 
-  _root->SetRunName(strRunName);
-  _root->WriteRootFile();
+// Name of the output files: the run name, unless this job or process covers only some events
+std::string SRSMain::GetOutputName() const{
+  return _outputName.empty() ? this->GetRunName() : _outputName;
+}
+
+std::vector<std::string> SRSMain::GetOutputFiles() const{
+  std::vector<std::string> vec_strOutputFiles;
+  for (unsigned int iOut = 0; iOut < _outputSuffixes.size(); iOut++) {
+    vec_strOutputFiles.push_back(this->GetOutputName() + _outputSuffixes[iOut] + "_dataTree.root");
+  }
+  return vec_strOutputFiles;
+}
+
+std::vector<std::string> SRSMain::GetOutputDetectors() const{
+  std::vector<std::string> vec_strDetectors;
+  for (unsigned int iOut = 0; iOut < _outputSuffixes.size(); iOut++) {
+    vec_strDetectors.push_back(_outputSuffixes[iOut].empty() ? "" : _outputSuffixes[iOut].substr(1));
+  }
+  return vec_strDetectors;
+}
+
+void SRSMain::Close(){
+  std::string strRunName = this->GetOutputName();
+  _isClosed = true;
+
+  if (!_isOutputWritten) {
+    for (unsigned int iOut = 0; iOut < _roots.size(); iOut++) {
+      _roots[iOut]->SetRunName(strRunName + _outputSuffixes[iOut]);
+      _roots[iOut]->WriteRootFile();
+    }
+  }
   //delete _root;
-  _root.reset();
+  _roots.clear();
   //delete _conf;
   _conf.reset();
   _maps.reset();
+  _ped.reset();
+  _apvContexts.reset();
+  _clusterEngine.reset();
+  QualityControl::Uniformity::Logger::getInstance().printSummary();
 }
@@ -2,6 +2,8 @@
 
 SRSOutputROOT::SRSOutputROOT() {
     fRunName = "SRSOutputROOT";
+    fFile = 0 ;
+    fDetID = -1 ;
     fRunType = "PHYSICS" ;    
     fZeroSupCut = 10 ;
     fROOTDataType = "HITS_AND_CLUSTERS" ;
@@ -11,6 +13,8 @@ SRSOutputROOT::SRSOutputROOT() {
 //SRSOutputROOT::SRSOutputROOT(const char * cfgname, TString zeroSupCutStr, TString rootDataType) {
 SRSOutputROOT::SRSOutputROOT(const std::string& zeroSupCutStr, const std::string& rootdatatype) {
     fRunName = "SRSOutputROOT";
+    fFile = 0 ;
+    fDetID = -1 ;
     fRunType = "PHYSICS" ;    
     fZeroSupCut = this->atoi(zeroSupCutStr);
     fROOTDataType = rootdatatype ;
@@ -20,7 +24,8 @@ SRSOutputROOT::SRSOutputROOT(const std::string& zeroSupCutStr, const std::string
 //====================================================================================================================
 SRSOutputROOT::~SRSOutputROOT() {
   //  std::cout <<"CLOSING fFile "<<std::endl;
-  fFile->Close();
+  // No file when the output was merged from the parts instead (SRSMain, RECOCHUNKS > 1)
+  if (fFile) fFile->Close();
   //std::cout <<"CLOSED fFile "<<std::endl;
   if (fZeroSupCut == 0) {
     this->DeleteHitsTree() ;
@@ -142,51 +147,31 @@ void SRSOutputROOT::FillRootFile(SRSEventBuilder * eventbuilder) {
   }
 }
 
-//============================================================================================
-static bool CompareStripNo( SRSHit *obj1, SRSHit *obj2) {
-    bool compare ;
-    if ( obj1->GetStripNo() < obj2->GetStripNo() ) compare = true ;
-    else compare = false ;
-    return compare;
-}
-
 //====================================================================================================================
 void SRSOutputROOT::FillHitsTree(SRSEventBuilder * eventbuilder) {
     //  printf("  SRSOutputROOT::FillHitsTree() ==> Enter \n") ;
     m_chID = 0 ;
     //    std::cout <<" In Fill Hits Tree "<<std::endl;
     
-    SRSMapping * mapping = SRSMapping::GetInstance();
-    
     Int_t NbADCTimeFrames = 40 ;
     std::vector<float > timebinCharges ;
     timebinCharges.resize(NbADCTimeFrames,0) ;
     
     
-    std::map < std::string, std::list <SRSHit * > >  hitsInDetectorPlaneMap = eventbuilder->GetHitsInDetectorPlane() ;
-    std::map < std::string, std::list <SRSHit * > >::const_iterator detPlane_itr ;
-    //    std::cout <<"Loop on the dtectors "<<hitsInDetectorPlaneMap.size()<<std::endl;
-    for (detPlane_itr = hitsInDetectorPlaneMap.begin(); detPlane_itr != hitsInDetectorPlaneMap.end(); detPlane_itr++) {
-      std::string detPlaneName = (* detPlane_itr).first ;
-      //      std::cout <<" Det plane name "<<detPlaneName<<std::endl;
-        // Assign Detector ID
-        Int_t detID = 0 ;
-        Float_t  planeID = 0;
-        //Float_t etaSector = 0.0;
-        
-	std::string detName = mapping->GetDetectorFromPlane(detPlaneName) ;
-	//	std::cout <<" DETNAME "<<detName<<std::endl;
-        detID = mapping->GetDetectorIDFromDetector(detName) ;
-	//std::cout <<" DETID "<<detID<<std::endl;
-        planeID   = mapping->GetPlaneIDorEtaSector(detPlaneName) ;
-	//std::cout << " Plane ID "<<planeID<<std::endl;
-        //etaSector = mapping->GetPlaneIDorEtaSector(detPlaneName) ;
-	//std::cout << " detName "<<detName<<" planeID "<<planeID<<" etaSector " <<etaSector<<std::endl;
+    //=== Planes by name and hits by strip number, as in the string keyed maps & sorted lists used before
+    eventbuilder->SortHitsByStripNo() ;
+    const std::vector<SRSPlaneEvent> & planeEvents = eventbuilder->GetPlaneEvents() ;
+    const std::vector<int> & planeEventsByName = eventbuilder->GetPlaneEventsByName() ;
+    for (unsigned int iPlane = 0; iPlane < planeEventsByName.size(); iPlane++) {
+        const SRSPlaneEvent & planeEvent = planeEvents[planeEventsByName[iPlane]] ;
+        if ((fDetID >= 0) && (planeEvent.fDetID != fDetID)) continue ;
 
-	std::list <SRSHit * > listOfHits = hitsInDetectorPlaneMap[detPlaneName] ;
-        listOfHits.sort(CompareStripNo) ;
-        
-	std::list <SRSHit * >::const_iterator hit_itr ;
+        // Detector ID & plane ID were looked up when the plane was first seen
+        Int_t detID       = planeEvent.fDetID ;
+        Float_t  planeID  = planeEvent.fPlaneID ;
+
+	const std::vector <SRSHit * > & listOfHits = planeEvent.fHits ;
+	std::vector <SRSHit * >::const_iterator hit_itr ;
         
         for(hit_itr = listOfHits.begin(); hit_itr != listOfHits.end(); ++hit_itr ) {;
             SRSHit * hit = * hit_itr ;
@@ -247,9 +232,7 @@ void SRSOutputROOT::FillHitsTree(SRSEventBuilder * eventbuilder) {
             timebinCharges.clear() ;
             
         }
-        listOfHits.clear() ;
     }
-    hitsInDetectorPlaneMap.clear() ;
     fHitTree->Fill() ;
 }
 
@@ -259,26 +242,18 @@ void SRSOutputROOT::FillClustersTree(SRSEventBuilder * eventbuilder) {
     //  printf("  SRSOutputROOT::FillClustersTree() ==> \n") ;
     m_nclust = 0 ;
     
-    SRSMapping * mapping = SRSMapping::GetInstance();
-    
-    std::map < std::string, std::list <SRSCluster * > >  clustersInDetectorPlaneMap = eventbuilder->GetClustersInDetectorPlane() ;
-    std::map < std::string, std::list <SRSCluster * > >::const_iterator detPlane_itr ;
-    for (detPlane_itr = clustersInDetectorPlaneMap.begin(); detPlane_itr != clustersInDetectorPlaneMap.end(); detPlane_itr++) {
-      std::string detPlaneName = detPlane_itr->first ;
-        
-        //Assign Detector ID
-        Int_t detID = 0 ;
-        Float_t  planeID = 0 ;
-        //Float_t etaSector = 0.0;
-        
-	std::string detName = mapping->GetDetectorFromPlane(detPlaneName) ;
-        detID = mapping->GetDetectorIDFromDetector(detName) ;
-        
-        planeID   = mapping->GetPlaneIDorEtaSector(detPlaneName) ;
-        //etaSector = mapping->GetPlaneIDorEtaSector(detPlaneName) ;
-        
-	std::list <SRSCluster * > listOfClusters = detPlane_itr->second  ;
-	std::list <SRSCluster * >::const_iterator cluster_itr ;
+    const std::vector<SRSPlaneEvent> & planeEvents = eventbuilder->GetPlaneEvents() ;
+    const std::vector<int> & planeEventsByName = eventbuilder->GetPlaneEventsByName() ;
+    for (unsigned int iPlane = 0; iPlane < planeEventsByName.size(); iPlane++) {
+        const SRSPlaneEvent & planeEvent = planeEvents[planeEventsByName[iPlane]] ;
+        if ((fDetID >= 0) && (planeEvent.fDetID != fDetID)) continue ;
+
+        //Detector ID & plane ID were looked up when the plane was first seen
+        Int_t detID       = planeEvent.fDetID ;
+        Float_t  planeID  = planeEvent.fPlaneID ;
+
+	const std::vector <SRSCluster * > & listOfClusters = planeEvent.fClusters ;
+	std::vector <SRSCluster * >::const_iterator cluster_itr ;
         
         for(cluster_itr = listOfClusters.begin(); cluster_itr != listOfClusters.end(); ++cluster_itr ) {
             SRSCluster * cluster = * cluster_itr ;
@@ -293,10 +268,22 @@ void SRSOutputROOT::FillClustersTree(SRSEventBuilder * eventbuilder) {
             //m_etaSector[m_nclust] = (short) etaSector ;
             m_nclust++ ;
         }
-        listOfClusters.clear() ;
     }
-    clustersInDetectorPlaneMap.clear() ;
     fClusterTree->Fill() ;
+
+    // Same event in the cluster cache, entry for entry
+    if (fClusterCache.isOpen()) {
+      fClusterCacheRecords.resize(m_nclust) ;
+      for (int i = 0; i < m_nclust; i++) {
+        fClusterCacheRecords[i].fPlaneID  = m_planeID[i] ;
+        fClusterCacheRecords[i].fPos      = m_clustPos[i] ;
+        fClusterCacheRecords[i].fADC      = m_clustADCs[i] ;
+        fClusterCacheRecords[i].iSize     = m_clustSize[i] ;
+        fClusterCacheRecords[i].iTimeBin  = m_clustTimeBin[i] ;
+        fClusterCacheRecords[i].iDetID    = m_detID[i] ;
+      }
+      fClusterCache.addEvent(fClusterCacheRecords.data(), m_nclust) ;
+    }
 }
 
 /*
@@ -736,6 +723,11 @@ void SRSOutputROOT::WriteRootFile() {
     }
     fFile->Write();
     //fFile->Close();
+
+    if (fClusterCache.isOpen()) {
+      printf("\tSRSOutputROOT::WriteRootFile() ==> Closing cluster cache \n") ;
+      fClusterCache.close() ;
+    }
 }
 
 int
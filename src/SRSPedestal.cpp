@@ -0,0 +1,470 @@
+#include <cmath>
+#include <thread>
+#include <algorithm>
+#include <cstring>
+#include "SRSPedestal.h"
+#include "SRSMapping.h"
+#include "SRSAPVEvent.h"
+#include "SRSRawStream.h"
+
+//=== Number of FEC fragments held in memory and dealt to the workers at once
+#define PEDESTAL_FRAGMENTS_PER_BATCH 2000
+
+//=== Compact pedestal file identifier (8 chars) followed by the format version
+static const char * kPedestalFileTag = "SRSPEDST" ;
+static const int    kPedestalFileVersion = 1 ;
+
+//=====================================================
+// Both zero suppressed ("APZ") and full readout ("ADC") frames are accepted
+static bool IsAPVFrameHeader(unsigned int word) {
+  unsigned int mark = (word >> 8) & 0xffffff ;
+  return ((mark == 0x41505a) || (mark == 0x414443)) ;
+}
+
+//=====================================================
+SRSAPVPedestalData::SRSAPVPedestalData(int apvID) {
+  fAPVID      = apvID ;
+  fNbTimeBins = 0 ;
+  fNbFrames   = 0 ;
+  fStripNoiseMean.assign(NCH, 0.) ;
+  fStripNoiseM2.assign(NCH, 0.) ;
+}
+
+//=====================================================
+void SRSAPVPedestalData::Resize(int nbTimeBins) {
+  if (nbTimeBins <= fNbTimeBins) return ;
+  fNbTimeBins = nbTimeBins ;
+  fTimeBinEntries.resize(fNbTimeBins, 0) ;
+  fOffsetMean.resize(fNbTimeBins * NCH, 0.) ;
+  fOffsetM2.resize(fNbTimeBins * NCH, 0.) ;
+  fNoiseMean.resize(fNbTimeBins * NCH, 0.) ;
+  fNoiseM2.resize(fNbTimeBins * NCH, 0.) ;
+}
+
+//=====================================================
+// Single pass: the common mode of a time bin is the mean over the 128 channels of the raw data,
+// so (raw - commonMode) has the same spread as the pedestal and common mode subtracted data of
+// SRSAPVEvent::ComputeTimeBinCommonMode() without needing the offsets beforehand (a pedestal run has no
+// signal, so there all strips are below threshold and its truncated mean is the plain mean)
+void SRSAPVPedestalData::Fill(const std::vector<float> & timeBinData, int nbTimeBins) {
+  if (nbTimeBins <= 0) return ;
+  Resize(nbTimeBins) ;
+
+  float stripNoiseData[NCH] ;
+  std::memset(stripNoiseData, 0, sizeof(stripNoiseData)) ;
+
+  for (int timebin = 0; timebin < nbTimeBins; timebin++) {
+    const float * data = &timeBinData[timebin * NCH] ;
+
+    float commonMode = 0 ;
+    for (int stripNo = 0; stripNo < NCH; stripNo++) commonMode += data[stripNo] ;
+    commonMode = commonMode / float(NCH) ;
+
+    long n = ++fTimeBinEntries[timebin] ;
+    double * offsetMean = &fOffsetMean[timebin * NCH] ;
+    double * offsetM2   = &fOffsetM2[timebin * NCH] ;
+    double * noiseMean  = &fNoiseMean[timebin * NCH] ;
+    double * noiseM2    = &fNoiseM2[timebin * NCH] ;
+
+    for (int stripNo = 0; stripNo < NCH; stripNo++) {
+      double rawdata = data[stripNo] ;
+      double delta = rawdata - offsetMean[stripNo] ;
+      offsetMean[stripNo] += delta / n ;
+      offsetM2[stripNo]   += delta * (rawdata - offsetMean[stripNo]) ;
+
+      double cmdata = rawdata - commonMode ;
+      delta = cmdata - noiseMean[stripNo] ;
+      noiseMean[stripNo] += delta / n ;
+      noiseM2[stripNo]   += delta * (cmdata - noiseMean[stripNo]) ;
+
+      stripNoiseData[stripNo] += (float) cmdata ;
+    }
+  }
+
+  //=== Time bin averaged data, this is the quantity compared to fZeroSupCut * noise in ComputeListOfAPVHits()
+  fNbFrames++ ;
+  for (int stripNo = 0; stripNo < NCH; stripNo++) {
+    double avgdata = stripNoiseData[stripNo] / float(nbTimeBins) ;
+    double delta = avgdata - fStripNoiseMean[stripNo] ;
+    fStripNoiseMean[stripNo] += delta / fNbFrames ;
+    fStripNoiseM2[stripNo]   += delta * (avgdata - fStripNoiseMean[stripNo]) ;
+  }
+}
+
+//=====================================================
+// Chan et al. pairwise combination of two sets of running statistics
+static void MergeRunningStat(long nA, double & meanA, double & m2A, long nB, double meanB, double m2B) {
+  if (nB == 0) return ;
+  if (nA == 0) {
+    meanA = meanB ;
+    m2A   = m2B ;
+    return ;
+  }
+  double n = nA + nB ;
+  double delta = meanB - meanA ;
+  meanA += delta * nB / n ;
+  m2A   += m2B + delta * delta * nA * nB / n ;
+}
+
+//=====================================================
+void SRSAPVPedestalData::Merge(const SRSAPVPedestalData & other) {
+  Resize(other.fNbTimeBins) ;
+
+  for (int timebin = 0; timebin < other.fNbTimeBins; timebin++) {
+    long nA = fTimeBinEntries[timebin] ;
+    long nB = other.fTimeBinEntries[timebin] ;
+    for (int stripNo = 0; stripNo < NCH; stripNo++) {
+      int idx = timebin * NCH + stripNo ;
+      MergeRunningStat(nA, fOffsetMean[idx], fOffsetM2[idx], nB, other.fOffsetMean[idx], other.fOffsetM2[idx]) ;
+      MergeRunningStat(nA, fNoiseMean[idx],  fNoiseM2[idx],  nB, other.fNoiseMean[idx],  other.fNoiseM2[idx]) ;
+    }
+    fTimeBinEntries[timebin] = nA + nB ;
+  }
+
+  for (int stripNo = 0; stripNo < NCH; stripNo++) {
+    MergeRunningStat(fNbFrames, fStripNoiseMean[stripNo], fStripNoiseM2[stripNo], other.fNbFrames, other.fStripNoiseMean[stripNo], other.fStripNoiseM2[stripNo]) ;
+  }
+  fNbFrames += other.fNbFrames ;
+}
+
+//=====================================================
+std::vector<float> SRSAPVPedestalData::GetOffsets() const {
+  std::vector<float> offsets(NCH, 0) ;
+  for (int stripNo = 0; stripNo < NCH; stripNo++) {
+    double sum = 0 ;
+    long entries = 0 ;
+    for (int timebin = 0; timebin < fNbTimeBins; timebin++) {
+      sum     += fOffsetMean[timebin * NCH + stripNo] * fTimeBinEntries[timebin] ;
+      entries += fTimeBinEntries[timebin] ;
+    }
+    if (entries > 0) offsets[stripNo] = sum / entries ;
+  }
+  return offsets ;
+}
+
+//=====================================================
+std::vector<float> SRSAPVPedestalData::GetNoises() const {
+  std::vector<float> noises(NCH, 0) ;
+  if (fNbFrames < 2) return noises ;
+  for (int stripNo = 0; stripNo < NCH; stripNo++) {
+    noises[stripNo] = sqrt(fStripNoiseM2[stripNo] / (fNbFrames - 1)) ;
+  }
+  return noises ;
+}
+
+//=====================================================
+std::vector<float> SRSAPVPedestalData::GetTimeBinOffsets() const {
+  return std::vector<float>(fOffsetMean.begin(), fOffsetMean.end()) ;
+}
+
+//=====================================================
+std::vector<float> SRSAPVPedestalData::GetTimeBinNoises() const {
+  std::vector<float> noises(fNbTimeBins * NCH, 0) ;
+  for (int timebin = 0; timebin < fNbTimeBins; timebin++) {
+    long n = fTimeBinEntries[timebin] ;
+    if (n < 2) continue ;
+    for (int stripNo = 0; stripNo < NCH; stripNo++) {
+      noises[timebin * NCH + stripNo] = sqrt(fNoiseM2[timebin * NCH + stripNo] / (n - 1)) ;
+    }
+  }
+  return noises ;
+}
+
+//============================================================================================
+SRSPedestal::SRSPedestal() {
+  fMaskedChannelCut = 20 ;
+  fNbFragments = 0 ;
+}
+
+//============================================================================================
+SRSPedestal::~SRSPedestal() {
+  Clear() ;
+}
+
+//============================================================================================
+void SRSPedestal::Clear() {
+  fNbFragments = 0 ;
+  fNbTimeBins.clear() ;
+  fNbFrames.clear() ;
+  fOffsets.clear() ;
+  fNoises.clear() ;
+  fMaskedChannels.clear() ;
+  fTimeBinOffsets.clear() ;
+  fTimeBinNoises.clear() ;
+}
+
+//============================================================================================
+bool SRSPedestal::ComputePedestals(const std::string & rawfile, unsigned int nbOfThreads) {
+  SRSRawStream ifs(rawfile) ;
+  if (!ifs.is_open()) {
+    printf("  SRSPedestal::ComputePedestals() ==> ERROR: cannot open raw file %s \n", rawfile.c_str()) ;
+    return false ;
+  }
+
+  if (nbOfThreads == 0) nbOfThreads = std::thread::hardware_concurrency() ;
+  if (nbOfThreads == 0) nbOfThreads = 1 ;
+  printf("  SRSPedestal::ComputePedestals() ==> Processing pedestal run %s with %d thread(s) \n", rawfile.c_str(), nbOfThreads) ;
+
+  Clear() ;
+
+  //=== Each worker owns its APV decoders and accumulators; the SRSAPVEvent are built here since
+  //=== the mapping singleton is not safe for concurrent look-ups
+  SRSMapping * mapping = SRSMapping::GetInstance() ;
+  std::map<int, int> apvNoFromApvIDMap = mapping->GetAPVNoFromIDMap() ;
+
+  std::vector< std::map<int, SRSAPVEvent *> > workerAPVEvents(nbOfThreads) ;
+  std::vector< std::map<int, SRSAPVPedestalData> > workerAPVData(nbOfThreads) ;
+  for (unsigned int iWorker = 0; iWorker < nbOfThreads; iWorker++) {
+    std::map<int, int>::const_iterator apv_itr ;
+    for (apv_itr = apvNoFromApvIDMap.begin(); apv_itr != apvNoFromApvIDMap.end(); ++apv_itr) {
+      int apvID = apv_itr->first ;
+      workerAPVEvents[iWorker][apvID] = new SRSAPVEvent((apvID >> 4) & 0xF, apvID & 0xF, apvID, 0, 0) ;
+      workerAPVData[iWorker][apvID]   = SRSAPVPedestalData(apvID) ;
+    }
+  }
+
+  std::vector< std::vector<unsigned int> > fragments ;
+  fragments.reserve(PEDESTAL_FRAGMENTS_PER_BATCH) ;
+  std::vector<unsigned int> fragment ;
+
+  bool isEOF = false ;
+  while (!isEOF) {
+    //=== Collect a batch of FEC fragments, each one ends with 0xfafafafa
+    unsigned int word = 0 ;
+    while (fragments.size() < PEDESTAL_FRAGMENTS_PER_BATCH) {
+      if (!ifs.read((char *) &word, 4)) {
+        isEOF = true ;
+        break ;
+      }
+      fragment.push_back(word) ;
+      if (word == 0xfafafafa) {
+        fragments.push_back(fragment) ;
+        fragment.clear() ;
+      }
+    }
+    if (fragments.empty()) break ;
+
+    //=== Deal contiguous slices of the batch to the workers
+    unsigned int nbFragments = fragments.size() ;
+    unsigned int sliceSize = (nbFragments + nbOfThreads - 1) / nbOfThreads ;
+    std::vector<std::thread> workers ;
+    for (unsigned int iWorker = 0; iWorker < nbOfThreads; iWorker++) {
+      unsigned int first = iWorker * sliceSize ;
+      unsigned int last  = std::min(nbFragments, first + sliceSize) ;
+      if (first >= last) break ;
+      workers.push_back(std::thread(&SRSPedestal::ProcessFragments, this, std::cref(fragments), first, last, std::ref(workerAPVEvents[iWorker]), std::ref(workerAPVData[iWorker]))) ;
+    }
+    for (unsigned int iWorker = 0; iWorker < workers.size(); iWorker++) workers[iWorker].join() ;
+
+    fNbFragments += nbFragments ;
+    printf("  SRSPedestal::ComputePedestals() ==> %ld FEC fragments processed \n", fNbFragments) ;
+    fragments.clear() ;
+  }
+  ifs.close() ;
+
+  //=== Merge the workers and extract offsets, noises and masked channels
+  for (unsigned int iWorker = 1; iWorker < nbOfThreads; iWorker++) {
+    std::map<int, SRSAPVPedestalData>::const_iterator data_itr ;
+    for (data_itr = workerAPVData[iWorker].begin(); data_itr != workerAPVData[iWorker].end(); ++data_itr) {
+      workerAPVData[0][data_itr->first].Merge(data_itr->second) ;
+    }
+  }
+
+  std::map<int, SRSAPVPedestalData>::const_iterator data_itr ;
+  for (data_itr = workerAPVData[0].begin(); data_itr != workerAPVData[0].end(); ++data_itr) {
+    int apvID = data_itr->first ;
+    const SRSAPVPedestalData & apvData = data_itr->second ;
+    if (apvData.GetNbFrames() == 0) {
+      printf("  SRSPedestal::ComputePedestals() ==> WARNING: no data found for apvID=%d \n", apvID) ;
+      continue ;
+    }
+
+    fNbTimeBins[apvID]     = apvData.GetNbTimeBins() ;
+    fNbFrames[apvID]       = apvData.GetNbFrames() ;
+    fOffsets[apvID]        = apvData.GetOffsets() ;
+    fNoises[apvID]         = apvData.GetNoises() ;
+    fTimeBinOffsets[apvID] = apvData.GetTimeBinOffsets() ;
+    fTimeBinNoises[apvID]  = apvData.GetTimeBinNoises() ;
+
+    //=== Dead (no noise at all) and noisy (noise above CHMASKCUT) channels are masked
+    fMaskedChannels[apvID].assign(NCH, 0) ;
+    for (int stripNo = 0; stripNo < NCH; stripNo++) {
+      float noise = fNoises[apvID][stripNo] ;
+      if ((noise <= 0) || (noise > fMaskedChannelCut)) fMaskedChannels[apvID][stripNo] = 1 ;
+    }
+  }
+
+  for (unsigned int iWorker = 0; iWorker < nbOfThreads; iWorker++) {
+    std::map<int, SRSAPVEvent *>::iterator apv_itr ;
+    for (apv_itr = workerAPVEvents[iWorker].begin(); apv_itr != workerAPVEvents[iWorker].end(); ++apv_itr) {
+      delete apv_itr->second ;
+    }
+    workerAPVEvents[iWorker].clear() ;
+  }
+
+  return (!fOffsets.empty()) ;
+}
+
+//============================================================================================
+void SRSPedestal::ProcessFragments(const std::vector< std::vector<unsigned int> > & fragments, unsigned int first, unsigned int last, std::map<int, SRSAPVEvent *> & apvEvents, std::map<int, SRSAPVPedestalData> & apvData) {
+  std::vector<float> timeBinData ;
+  for (unsigned int i = first; i < last; i++) {
+    ProcessFragment(fragments[i], apvEvents, apvData, timeBinData) ;
+  }
+}
+
+//============================================================================================
+// Same framing as SRSMain::Reprocess() and SRSFECDecoder::decodeFEC(): the event header ends
+// 8 words before the first APV frame mark, the FEC ID sits 6 words before it, each frame mark
+// is followed by the packet size word and preceded by the frame counter of the next packet
+void SRSPedestal::ProcessFragment(const std::vector<unsigned int> & fragment, std::map<int, SRSAPVEvent *> & apvEvents, std::map<int, SRSAPVPedestalData> & apvData, std::vector<float> & timeBinData) {
+  unsigned int nw = fragment.size() ;
+  unsigned int firstMark = 0 ;
+  while ((firstMark < nw) && !IsAPVFrameHeader(fragment[firstMark])) firstMark++ ;
+  if ((firstMark < 8) || (firstMark >= nw)) return ;
+
+  int fecID = fragment[firstMark - 6] & 0xff ;
+  int adcChannel = -1 ;
+  bool isNewPacket = false ;
+  std::vector<unsigned int> frame ;
+
+  for (unsigned int iw = firstMark; iw < nw; iw++) {
+    unsigned int rawdata = fragment[iw] ;
+
+    if (rawdata == 0xfafafafa) {
+      if ((adcChannel >= 0) && !frame.empty()) ProcessFrame((fecID << 4) | adcChannel, frame, apvEvents, apvData, timeBinData) ;
+      break ;
+    }
+
+    if (isNewPacket) {
+      isNewPacket = false ;
+      continue ;
+    }
+
+    if (IsAPVFrameHeader(rawdata)) {
+      if (!frame.empty()) frame.pop_back() ;
+      if ((adcChannel >= 0) && !frame.empty()) ProcessFrame((fecID << 4) | adcChannel, frame, apvEvents, apvData, timeBinData) ;
+      adcChannel = rawdata & 0xff ;
+      if (adcChannel > 15) break ;
+      frame.clear() ;
+      isNewPacket = true ;
+      continue ;
+    }
+
+    frame.push_back(rawdata) ;
+  }
+}
+
+//============================================================================================
+void SRSPedestal::ProcessFrame(int apvID, const std::vector<unsigned int> & frame, std::map<int, SRSAPVEvent *> & apvEvents, std::map<int, SRSAPVPedestalData> & apvData, std::vector<float> & timeBinData) {
+  std::map<int, SRSAPVEvent *>::iterator apv_itr = apvEvents.find(apvID) ;
+  if (apv_itr == apvEvents.end()) return ;
+
+  SRSAPVEvent * apvEvent = apv_itr->second ;
+  apvEvent->Set32BitsRawData(frame) ;
+  int nbTimeBins = apvEvent->ComputeTimeBinRawData(timeBinData) ;
+  apvData[apvID].Fill(timeBinData, nbTimeBins) ;
+}
+
+//============================================================================================
+// Layout (native endianness):
+//   char[8] tag, int version, int nbOfAPVs
+//   for each APV: int apvID, int nbTimeBins, int nbFrames,
+//                 float offsets[NCH], float noises[NCH], float maskedChannels[NCH],
+//                 float timeBinOffsets[nbTimeBins * NCH], float timeBinNoises[nbTimeBins * NCH]
+void SRSPedestal::SavePedestalFile(const char * filename) {
+  std::ofstream file(filename, std::ios::binary) ;
+  if (!file.is_open()) {
+    printf("  SRSPedestal::SavePedestalFile() ==> ERROR: cannot open %s \n", filename) ;
+    return ;
+  }
+
+  int version  = kPedestalFileVersion ;
+  int nbOfAPVs = fOffsets.size() ;
+  file.write(kPedestalFileTag, 8) ;
+  file.write((char *) &version, sizeof(int)) ;
+  file.write((char *) &nbOfAPVs, sizeof(int)) ;
+
+  std::map<int, std::vector<float> >::const_iterator apv_itr ;
+  for (apv_itr = fOffsets.begin(); apv_itr != fOffsets.end(); ++apv_itr) {
+    int apvID      = apv_itr->first ;
+    int nbTimeBins = fNbTimeBins[apvID] ;
+    int nbFrames   = fNbFrames[apvID] ;
+    file.write((char *) &apvID, sizeof(int)) ;
+    file.write((char *) &nbTimeBins, sizeof(int)) ;
+    file.write((char *) &nbFrames, sizeof(int)) ;
+    file.write((char *) &fOffsets[apvID][0], NCH * sizeof(float)) ;
+    file.write((char *) &fNoises[apvID][0], NCH * sizeof(float)) ;
+    file.write((char *) &fMaskedChannels[apvID][0], NCH * sizeof(float)) ;
+    if (nbTimeBins > 0) {
+      file.write((char *) &fTimeBinOffsets[apvID][0], nbTimeBins * NCH * sizeof(float)) ;
+      file.write((char *) &fTimeBinNoises[apvID][0], nbTimeBins * NCH * sizeof(float)) ;
+    }
+  }
+  file.close() ;
+  printf("  SRSPedestal::SavePedestalFile() ==> %d APVs saved in %s \n", nbOfAPVs, filename) ;
+}
+
+//============================================================================================
+bool SRSPedestal::LoadPedestalFile(const char * filename) {
+  std::ifstream file(filename, std::ios::binary) ;
+  if (!file.is_open()) return false ;
+
+  char tag[8] ;
+  int version = 0, nbOfAPVs = 0 ;
+  file.read(tag, 8) ;
+  file.read((char *) &version, sizeof(int)) ;
+  file.read((char *) &nbOfAPVs, sizeof(int)) ;
+  if (!file || (std::strncmp(tag, kPedestalFileTag, 8) != 0) || (version != kPedestalFileVersion)) {
+    printf("  SRSPedestal::LoadPedestalFile() ==> ERROR: %s is not a pedestal file \n", filename) ;
+    return false ;
+  }
+
+  Clear() ;
+  for (int iAPV = 0; iAPV < nbOfAPVs; iAPV++) {
+    int apvID = 0, nbTimeBins = 0, nbFrames = 0 ;
+    file.read((char *) &apvID, sizeof(int)) ;
+    file.read((char *) &nbTimeBins, sizeof(int)) ;
+    file.read((char *) &nbFrames, sizeof(int)) ;
+    if (!file || (nbTimeBins < 0)) break ;
+
+    fNbTimeBins[apvID] = nbTimeBins ;
+    fNbFrames[apvID]   = nbFrames ;
+    fOffsets[apvID].resize(NCH) ;
+    fNoises[apvID].resize(NCH) ;
+    fMaskedChannels[apvID].resize(NCH) ;
+    fTimeBinOffsets[apvID].resize(nbTimeBins * NCH) ;
+    fTimeBinNoises[apvID].resize(nbTimeBins * NCH) ;
+    file.read((char *) &fOffsets[apvID][0], NCH * sizeof(float)) ;
+    file.read((char *) &fNoises[apvID][0], NCH * sizeof(float)) ;
+    file.read((char *) &fMaskedChannels[apvID][0], NCH * sizeof(float)) ;
+    if (nbTimeBins > 0) {
+      file.read((char *) &fTimeBinOffsets[apvID][0], nbTimeBins * NCH * sizeof(float)) ;
+      file.read((char *) &fTimeBinNoises[apvID][0], nbTimeBins * NCH * sizeof(float)) ;
+    }
+  }
+
+  if (!file) {
+    printf("  SRSPedestal::LoadPedestalFile() ==> ERROR: %s is truncated \n", filename) ;
+    Clear() ;
+    return false ;
+  }
+
+  printf("  SRSPedestal::LoadPedestalFile() ==> %d APVs loaded from %s \n", (int) fOffsets.size(), filename) ;
+  return true ;
+}
+
+//============================================================================================
+void SRSPedestal::Print() {
+  std::map<int, std::vector<float> >::const_iterator apv_itr ;
+  for (apv_itr = fNoises.begin(); apv_itr != fNoises.end(); ++apv_itr) {
+    int apvID = apv_itr->first ;
+    float meanNoise = 0 ;
+    int nbMasked = 0 ;
+    for (int stripNo = 0; stripNo < NCH; stripNo++) {
+      meanNoise += apv_itr->second[stripNo] ;
+      nbMasked  += (int) fMaskedChannels[apvID][stripNo] ;
+    }
+    printf("  SRSPedestal::Print() ==> apvID=%d, timeBins=%d, frames=%ld, mean noise=%f, masked channels=%d \n", apvID, fNbTimeBins[apvID], fNbFrames[apvID], meanNoise / NCH, nbMasked) ;
+  }
+}
@@ -0,0 +1,220 @@
+#include "SRSRawFramer.h"
+#include <stdio.h>
+#include <fstream>
+#include "SRSRawStream.h"
+#include "Logger.h"
+
+//=== Words read at once from the stream
+static const unsigned int kBlockSize = 65536 ;
+
+static const unsigned int kEndOfFragment = 0xfafafafa ;
+
+//=== Words of the event header before the first APV header
+static const int kEventHeaderWords = 8 ;
+
+//============================================================================================
+SRSRawFramer::SRSRawFramer(SRSRawStream & stream, unsigned int maxWords) : fStream(stream) {
+  fMaxWords = maxWords ;
+  fBlock.resize(kBlockSize) ;
+  fBlockPos = fBlockSize = 0 ;
+  fOffset = fFragmentOffset = 0 ;
+
+  fNbOfFragments = fNbOfCorruptFragments = 0 ;
+  fNbOfSkippedBytes = 0 ;
+}
+
+//============================================================================================
+bool SRSRawFramer::ReadWord(unsigned int & word) {
+  if (fBlockPos == fBlockSize) {
+    if (fStream.eof()) return false ;
+    fStream.read((char *) &fBlock[0], kBlockSize * sizeof(unsigned int)) ;
+    fBlockSize = fStream.gcount() / sizeof(unsigned int) ;   // a trailing partial word is dropped, as before
+    fBlockPos = 0 ;
+    if (fBlockSize == 0) return false ;
+  }
+  word = fBlock[fBlockPos++] ;
+  fOffset += sizeof(unsigned int) ;
+  return true ;
+}
+
+//============================================================================================
+bool SRSRawFramer::Seek(unsigned long long offset) {
+  fBlockPos = fBlockSize = 0 ;
+  fOffset = offset ;
+  return fStream.seekg(offset) ;
+}
+
+//============================================================================================
+// "APZ" for zero suppressed frames, "ADC" for full readout frames
+bool SRSRawFramer::IsAPVHeader(unsigned int word) {
+  unsigned int tag = (word >> 8) & 0xffffff ;
+  return (tag == 0x41505a) || (tag == 0x414443) ;
+}
+
+//============================================================================================
+bool SRSRawFramer::NextFragment(std::vector<unsigned long> & fragment, int & fecNo) {
+  unsigned int word ;
+  for (;;) {
+    fragment.clear() ;
+    unsigned long long firstByte = fOffset ;
+    bool isComplete = false ;
+
+    while (ReadWord(word)) {
+      fragment.push_back(word) ;
+      if (word == kEndOfFragment) {
+        isComplete = true ;
+        break ;
+      }
+
+      //=== No end marker where one was expected: resync to the next event header if one was read,
+      //    otherwise drop everything up to the next end marker
+      if (fragment.size() >= fMaxWords) DropMergedFragments(fragment, firstByte) ;
+      if (fragment.size() >= fMaxWords) {
+        int fec = -1 ;
+        CheckFragment(fragment, fec) ;
+        while (ReadWord(word) && (word != kEndOfFragment)) ;
+        char reason[100] ;
+        sprintf(reason, "no end marker within %u words", fMaxWords) ;
+        Skip(firstByte, fOffset - firstByte, fec, reason) ;
+        fragment.clear() ;
+        firstByte = fOffset ;
+      }
+    }
+
+    if (!isComplete) {
+      if (!fragment.empty()) Skip(firstByte, fOffset - firstByte, -1, "truncated at the end of the stream") ;
+      return false ;
+    }
+
+    DropMergedFragments(fragment, firstByte) ;
+
+    std::string reason = CheckFragment(fragment, fecNo) ;
+    if (reason.empty()) {
+      fFragmentOffset = firstByte ;
+      fNbOfFragments++ ;
+      fNbOfFragmentsPerFEC[fecNo]++ ;
+      return true ;
+    }
+    Skip(firstByte, fOffset - firstByte, fecNo, reason) ;
+  }
+}
+
+//============================================================================================
+std::string SRSRawFramer::CheckFragment(const std::vector<unsigned long> & fragment, int & fecNo) {
+  fecNo = -1 ;
+  int size = fragment.size() ;
+
+  int firstHeader = 0 ;
+  while ((firstHeader < size) && !IsAPVHeader(fragment[firstHeader])) firstHeader++ ;
+  if (firstHeader == size) return "no APV header" ;
+  if (firstHeader < 8) return "truncated event header" ;
+  fecNo = fragment[firstHeader - 6] & 0xff ;
+
+  //=== APV frames: ADC channel in range, at least the packet size word and one data word, once per fragment
+  unsigned int seenChannels = 0 ;
+  for (int header = firstHeader; header < size; ) {
+    int next = header + 1 ;
+    while ((next < size) && !IsAPVHeader(fragment[next])) next++ ;
+
+    int adcChannel = fragment[header] & 0xff ;
+    if (adcChannel > 15) return "ADC channel out of range" ;
+
+    bool isBadFrame = ((seenChannels >> adcChannel) & 1) || (next - header < 3) ;
+    if (isBadFrame) fNbOfCorruptFramesPerAPV[(fecNo << 4) | adcChannel]++ ;
+    seenChannels |= (1 << adcChannel) ;
+    header = next ;
+  }
+  return "" ;
+}
+
+//============================================================================================
+// An ADC channel seen twice means two fragments were merged, provided the 8 words before the
+// repeated APV header hold no APV header of their own (they are then the next event header)
+int SRSRawFramer::FindEventBoundary(const std::vector<unsigned long> & fragment, int & fecNo) {
+  fecNo = -1 ;
+  int size = fragment.size() ;
+
+  int firstHeader = 0 ;
+  while ((firstHeader < size) && !IsAPVHeader(fragment[firstHeader])) firstHeader++ ;
+  if (firstHeader < kEventHeaderWords) return -1 ;
+  fecNo = fragment[firstHeader - 6] & 0xff ;
+
+  unsigned int seenChannels = 0 ;
+  int previous = -1 ;
+  for (int header = firstHeader; header < size; header++) {
+    if (!IsAPVHeader(fragment[header])) continue ;
+    int adcChannel = fragment[header] & 0xff ;
+    if (adcChannel > 15) return -1 ;   // rejected by CheckFragment()
+    if (((seenChannels >> adcChannel) & 1) && (header - kEventHeaderWords > previous)) return header - kEventHeaderWords ;
+    seenChannels |= (1 << adcChannel) ;
+    previous = header ;
+  }
+  return -1 ;
+}
+
+//============================================================================================
+void SRSRawFramer::DropMergedFragments(std::vector<unsigned long> & fragment, unsigned long long & firstByte) {
+  int fec ;
+  int boundary ;
+  while ((boundary = FindEventBoundary(fragment, fec)) > 0) {
+    Skip(firstByte, boundary * sizeof(unsigned int), fec, "end marker lost, next event header in the fragment") ;
+    fragment.erase(fragment.begin(), fragment.begin() + boundary) ;
+    firstByte += boundary * sizeof(unsigned int) ;
+  }
+}
+
+//============================================================================================
+void SRSRawFramer::Skip(unsigned long long firstByte, unsigned long long nbOfBytes, int fecNo, const std::string & reason) {
+  fNbOfCorruptFragments++ ;
+  fNbOfCorruptFragmentsPerFEC[fecNo]++ ;
+  fNbOfSkippedBytes += nbOfBytes ;
+  if (fSkippedRanges.size() < kMaxRanges) {
+    SkippedRange range ;
+    range.fFirstByte = firstByte ;
+    range.fNbOfBytes = nbOfBytes ;
+    range.fReason    = reason ;
+    fSkippedRanges.push_back(range) ;
+  }
+  QualityControl::Uniformity::Logger::getInstance().logf(QualityControl::Uniformity::kLogWarning, "SRSRawFramer::NextFragment()", "fec %d: %s, skipped %llu bytes at offset %llu", fecNo, reason.c_str(), nbOfBytes, firstByte) ;
+}
+
+//============================================================================================
+void SRSRawFramer::WriteReport(const std::string & fileName) const {
+  std::ofstream file(fileName.c_str()) ;
+  if (!file.is_open()) {
+    printf("  SRSRawFramer::WriteReport() ==> ERROR: cannot open %s \n", fileName.c_str()) ;
+    return ;
+  }
+
+  file << "# SRS raw stream report, byte offsets are counted over the raw files of the run in order" << std::endl ;
+  for (unsigned int iFile = 0; iFile < fStream.GetNbFiles(); iFile++) file << "FILE " << fStream.GetFile(iFile) << std::endl ;
+  file << "FRAGMENTS " << fNbOfFragments << std::endl ;
+  file << "CORRUPTFRAGMENTS " << fNbOfCorruptFragments << std::endl ;
+  file << "SKIPPEDBYTES " << fNbOfSkippedBytes << std::endl ;
+
+  file << "# FEC good corrupt   (FEC -1 == unknown)" << std::endl ;
+  std::map<int, long> fecNos = fNbOfFragmentsPerFEC ;
+  fecNos.insert(fNbOfCorruptFragmentsPerFEC.begin(), fNbOfCorruptFragmentsPerFEC.end()) ;
+  std::map<int, long>::const_iterator fec_itr ;
+  for (fec_itr = fecNos.begin(); fec_itr != fecNos.end(); ++fec_itr) {
+    int fecNo = (* fec_itr).first ;
+    std::map<int, long>::const_iterator good = fNbOfFragmentsPerFEC.find(fecNo), corrupt = fNbOfCorruptFragmentsPerFEC.find(fecNo) ;
+    file << "FEC " << fecNo << " " << ((good != fNbOfFragmentsPerFEC.end()) ? good->second : 0)
+         << " " << ((corrupt != fNbOfCorruptFragmentsPerFEC.end()) ? corrupt->second : 0) << std::endl ;
+  }
+
+  file << "# APV fec adcChannel suspiciousFrames   (repeated in a fragment or empty)" << std::endl ;
+  std::map<int, long>::const_iterator apv_itr ;
+  for (apv_itr = fNbOfCorruptFramesPerAPV.begin(); apv_itr != fNbOfCorruptFramesPerAPV.end(); ++apv_itr) {
+    file << "APV " << ((* apv_itr).first >> 4) << " " << ((* apv_itr).first & 0xF) << " " << (* apv_itr).second << std::endl ;
+  }
+
+  file << "# SKIPPED firstByte nbOfBytes reason" << std::endl ;
+  for (unsigned int i = 0; i < fSkippedRanges.size(); i++) {
+    file << "SKIPPED " << fSkippedRanges[i].fFirstByte << " " << fSkippedRanges[i].fNbOfBytes << " " << fSkippedRanges[i].fReason << std::endl ;
+  }
+  if (fNbOfCorruptFragments > (long) fSkippedRanges.size()) {
+    file << "# " << (fNbOfCorruptFragments - (long) fSkippedRanges.size()) << " more ranges not listed" << std::endl ;
+  }
+  file.close() ;
+}
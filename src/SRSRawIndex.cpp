@@ -0,0 +1,89 @@
+#include "SRSRawIndex.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "SRSRawStream.h"
+#include "SRSRawFramer.h"
+
+static const char kIndexMagic[8] = {'S','R','S','R','A','W','I','X'} ;
+static const uint32_t kIndexVersion = 1 ;
+
+//============================================================================================
+bool SRSRawIndex::Build(const std::string & rawfiles, unsigned int maxWords) {
+  fEventOffsets.clear() ;
+
+  SRSRawStream ifs(rawfiles) ;
+  if (!ifs.is_open()) return false ;
+  fStreamSize = ifs.GetSize() ;
+
+  //=== Same framing as the reconstruction, an event starts with each valid fragment of FEC 1
+  SRSRawFramer framer(ifs, maxWords) ;
+  std::vector<unsigned long> fragment ;
+  int fecNo = 0 ;
+  while (framer.NextFragment(fragment, fecNo)) {
+    if (fecNo == 1) fEventOffsets.push_back(framer.GetFragmentOffset()) ;
+  }
+  printf("  SRSRawIndex::Build() ==> %d events indexed in %llu bytes \n", (int) fEventOffsets.size(), fStreamSize) ;
+  return true ;
+}
+
+//============================================================================================
+bool SRSRawIndex::Load(const std::string & fileName, unsigned long long streamSize) {
+  fEventOffsets.clear() ;
+
+  FILE * file = fopen(fileName.c_str(), "rb") ;
+  if (!file) return false ;
+
+  char magic[8] ;
+  uint32_t version = 0, unused = 0 ;
+  uint64_t size = 0, nbOfEvents = 0 ;
+  bool isValid = (fread(magic, sizeof(magic), 1, file) == 1) && (memcmp(magic, kIndexMagic, sizeof(magic)) == 0)
+              && (fread(&version, sizeof(version), 1, file) == 1) && (version == kIndexVersion)
+              && (fread(&unused, sizeof(unused), 1, file) == 1)
+              && (fread(&size, sizeof(size), 1, file) == 1) && (size == streamSize)
+              && (fread(&nbOfEvents, sizeof(nbOfEvents), 1, file) == 1) ;
+
+  if (isValid) {
+    std::vector<uint64_t> offsets(nbOfEvents) ;
+    isValid = (nbOfEvents == 0) || (fread(&offsets[0], sizeof(uint64_t), nbOfEvents, file) == nbOfEvents) ;
+    if (isValid) fEventOffsets.assign(offsets.begin(), offsets.end()) ;
+  }
+  fclose(file) ;
+
+  if (!isValid) {
+    printf("  SRSRawIndex::Load() ==> %s is not an index of this raw stream, rebuilding it \n", fileName.c_str()) ;
+    return false ;
+  }
+  fStreamSize = streamSize ;
+  printf("  SRSRawIndex::Load() ==> %d events indexed in %s \n", (int) fEventOffsets.size(), fileName.c_str()) ;
+  return true ;
+}
+
+//============================================================================================
+bool SRSRawIndex::Save(const std::string & fileName) const {
+  //=== Written aside and renamed, a job killed while writing does not leave a truncated index
+  std::string tmpName = fileName + ".part" ;
+  FILE * file = fopen(tmpName.c_str(), "wb") ;
+  if (!file) {
+    printf("  SRSRawIndex::Save() ==> WARNING: cannot write %s, the index will be rebuilt next time \n", fileName.c_str()) ;
+    return false ;
+  }
+
+  uint32_t version = kIndexVersion, unused = 0 ;
+  uint64_t size = fStreamSize, nbOfEvents = fEventOffsets.size() ;
+  std::vector<uint64_t> offsets(fEventOffsets.begin(), fEventOffsets.end()) ;
+  bool isWritten = (fwrite(kIndexMagic, sizeof(kIndexMagic), 1, file) == 1)
+                && (fwrite(&version, sizeof(version), 1, file) == 1)
+                && (fwrite(&unused, sizeof(unused), 1, file) == 1)
+                && (fwrite(&size, sizeof(size), 1, file) == 1)
+                && (fwrite(&nbOfEvents, sizeof(nbOfEvents), 1, file) == 1)
+                && ((nbOfEvents == 0) || (fwrite(&offsets[0], sizeof(uint64_t), nbOfEvents, file) == nbOfEvents)) ;
+  isWritten = (fclose(file) == 0) && isWritten ;
+
+  if (!isWritten || (rename(tmpName.c_str(), fileName.c_str()) != 0)) {
+    remove(tmpName.c_str()) ;
+    printf("  SRSRawIndex::Save() ==> WARNING: cannot write %s, the index will be rebuilt next time \n", fileName.c_str()) ;
+    return false ;
+  }
+  return true ;
+}
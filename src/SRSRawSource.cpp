@@ -0,0 +1,458 @@
+#include "SRSRawSource.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <zlib.h>
+#ifdef SRS_WITH_ZSTD
+#include <zstd.h>
+#endif
+#ifdef SRS_WITH_LZ4
+#include <lz4frame.h>
+#endif
+
+//=== Compressed bytes read at once from the file
+static const unsigned int kInputSize = 1 << 20 ;
+
+//=== Decompressed bytes per block of the read ahead thread, and blocks it may hold
+static const unsigned int kReadAheadSize   = 4 << 20 ;
+static const unsigned int kReadAheadBlocks = 4 ;
+
+//============================================================================================
+// Uncompressed file
+class SRSPlainSource : public SRSRawSource {
+
+ public:
+  SRSPlainSource(const std::string & file) {
+    fStream.open(file.c_str(), std::ios::binary) ;
+    struct stat fileStat ;
+    fSize = (stat(file.c_str(), &fileStat) == 0) ? fileStat.st_size : 0 ;
+  }
+
+  bool IsOpen() const {return fStream.is_open();}
+
+  std::streamsize Read(char * s, std::streamsize n) {
+    fStream.read(s, n) ;
+    return fStream.gcount() ;
+  }
+
+  bool IsSeekable() const {return true;}
+  bool Seek(unsigned long long offset) {
+    fStream.clear() ;
+    fStream.seekg(offset, std::ios::beg) ;
+    return fStream.good() ;
+  }
+  unsigned long long GetSize() const {return fSize;}
+
+ private:
+  std::ifstream fStream ;
+  unsigned long long fSize ;
+};
+
+//============================================================================================
+// Compressed file: input buffer shared by the codecs; fIsDone once the data are exhausted
+class SRSCompressedSource : public SRSRawSource {
+
+ public:
+  SRSCompressedSource(SRSRawSource * input, const char * format) : fInput(input), fFormat(format) {
+    fIn.resize(kInputSize) ;
+    fInPos = fInSize = 0 ;
+    fIsDone = false ;
+  }
+  ~SRSCompressedSource() {delete fInput;}
+
+ protected:
+  bool FillInput() {
+    fInPos = 0 ;
+    fInSize = fInput->Read((char *) &fIn[0], fIn.size()) ;
+    return fInSize > 0 ;
+  }
+
+  void Stop(const char * reason) {
+    printf("  SRSRawSource::Read() ==> ERROR: %s data %s, the rest of the file is skipped \n", fFormat, reason) ;
+    fIsDone = true ;
+  }
+
+  SRSRawSource * fInput ;
+  const char * fFormat ;
+  std::vector<unsigned char> fIn ;
+  size_t fInPos, fInSize ;
+  bool fIsDone ;
+};
+
+//============================================================================================
+// gzip, concatenated members included (e.g. files appended to with gzip >>)
+class SRSGzipSource : public SRSCompressedSource {
+
+ public:
+  SRSGzipSource(SRSRawSource * input) : SRSCompressedSource(input, "gzip") {
+    memset(&fZ, 0, sizeof(fZ)) ;
+    inflateInit2(&fZ, 15 + 32) ;
+    fIsMemberEnd = false ;
+  }
+  ~SRSGzipSource() {inflateEnd(&fZ);}
+
+  std::streamsize Read(char * s, std::streamsize n) {
+    fZ.next_out  = (Bytef *) s ;
+    fZ.avail_out = n ;
+    while ((fZ.avail_out > 0) && !fIsDone) {
+      if (fZ.avail_in == 0) {
+        if (!FillInput()) {
+          if (!fIsMemberEnd) Stop("truncated") ;
+          fIsDone = true ;
+          break ;
+        }
+        fZ.next_in  = &fIn[0] ;
+        fZ.avail_in = fInSize ;
+      }
+      int ret = inflate(&fZ, Z_NO_FLUSH) ;
+      if (ret == Z_STREAM_END) {
+        fIsMemberEnd = true ;
+        inflateReset(&fZ) ;
+        continue ;
+      }
+      if ((ret != Z_OK) && (ret != Z_BUF_ERROR)) Stop("corrupted") ;
+      fIsMemberEnd = false ;
+    }
+    return n - fZ.avail_out ;
+  }
+
+ private:
+  z_stream fZ ;
+  bool fIsMemberEnd ;
+};
+
+#ifdef SRS_WITH_ZSTD
+//============================================================================================
+class SRSZstdSource : public SRSCompressedSource {
+
+ public:
+  SRSZstdSource(SRSRawSource * input) : SRSCompressedSource(input, "zstd") {
+    fDStream = ZSTD_createDStream() ;
+    ZSTD_initDStream(fDStream) ;
+    fLastRet = 0 ;
+  }
+  ~SRSZstdSource() {ZSTD_freeDStream(fDStream);}
+
+  std::streamsize Read(char * s, std::streamsize n) {
+    ZSTD_outBuffer out = {s, (size_t) n, 0} ;
+    while ((out.pos < out.size) && !fIsDone) {
+      if (fInPos == fInSize) {
+        if (!FillInput()) {
+          if (fLastRet != 0) Stop("truncated") ;
+          fIsDone = true ;
+          break ;
+        }
+      }
+      ZSTD_inBuffer in = {&fIn[0], fInSize, fInPos} ;
+      size_t ret = ZSTD_decompressStream(fDStream, &out, &in) ;
+      fInPos = in.pos ;
+      if (ZSTD_isError(ret)) Stop("corrupted") ;
+      fLastRet = ret ;
+    }
+    return out.pos ;
+  }
+
+ private:
+  ZSTD_DStream * fDStream ;
+  size_t fLastRet ;
+};
+#endif
+
+#ifdef SRS_WITH_LZ4
+//============================================================================================
+class SRSLz4Source : public SRSCompressedSource {
+
+ public:
+  SRSLz4Source(SRSRawSource * input) : SRSCompressedSource(input, "lz4") {
+    LZ4F_createDecompressionContext(&fContext, LZ4F_VERSION) ;
+    fLastRet = 0 ;
+  }
+  ~SRSLz4Source() {LZ4F_freeDecompressionContext(fContext);}
+
+  std::streamsize Read(char * s, std::streamsize n) {
+    size_t outPos = 0 ;
+    while ((outPos < (size_t) n) && !fIsDone) {
+      if (fInPos == fInSize) {
+        if (!FillInput()) {
+          if (fLastRet != 0) Stop("truncated") ;
+          fIsDone = true ;
+          break ;
+        }
+      }
+      size_t outSize = n - outPos, inSize = fInSize - fInPos ;
+      size_t ret = LZ4F_decompress(fContext, s + outPos, &outSize, &fIn[fInPos], &inSize, 0) ;
+      if (LZ4F_isError(ret)) Stop("corrupted") ;
+      fInPos += inSize ;
+      outPos += outSize ;
+      fLastRet = ret ;
+    }
+    return outPos ;
+  }
+
+ private:
+  LZ4F_dctx * fContext ;
+  size_t fLastRet ;
+};
+#endif
+
+//============================================================================================
+// Decompresses in a background thread, up to kReadAheadBlocks blocks ahead of the reader
+class SRSReadAheadSource : public SRSRawSource {
+
+ public:
+  SRSReadAheadSource(SRSRawSource * source) : fSource(source) {
+    fBlockPos = 0 ;
+    fIsEnd = fIsStopped = false ;
+    fThread = std::thread(&SRSReadAheadSource::Fill, this) ;
+  }
+
+  ~SRSReadAheadSource() {
+    {
+      std::lock_guard<std::mutex> lock(fMutex) ;
+      fIsStopped = true ;
+    }
+    fCondition.notify_all() ;
+    fThread.join() ;
+    delete fSource ;
+  }
+
+  std::streamsize Read(char * s, std::streamsize n) {
+    std::streamsize nRead = 0 ;
+    while ((nRead < n) && !fIsEnd) {
+      if (fBlockPos == fBlock.size()) {
+        std::unique_lock<std::mutex> lock(fMutex) ;
+        fCondition.wait(lock, [this] {return !fBlocks.empty();}) ;
+        fBlock.swap(fBlocks.front()) ;
+        fBlocks.pop_front() ;
+        fBlockPos = 0 ;
+        lock.unlock() ;
+        fCondition.notify_all() ;
+        //=== An empty block marks the end of the data
+        if (fBlock.empty()) {
+          fIsEnd = true ;
+          break ;
+        }
+      }
+      size_t nCopy = std::min((size_t) (n - nRead), fBlock.size() - fBlockPos) ;
+      memcpy(s + nRead, &fBlock[fBlockPos], nCopy) ;
+      fBlockPos += nCopy ;
+      nRead += nCopy ;
+    }
+    return nRead ;
+  }
+
+ private:
+  void Fill() {
+    for (;;) {
+      std::vector<char> block(kReadAheadSize) ;
+      block.resize(fSource->Read(&block[0], block.size())) ;
+      bool isLast = block.empty() ;
+
+      std::unique_lock<std::mutex> lock(fMutex) ;
+      fCondition.wait(lock, [this] {return fIsStopped || (fBlocks.size() < kReadAheadBlocks);}) ;
+      if (fIsStopped) return ;
+      fBlocks.push_back(std::vector<char>()) ;
+      fBlocks.back().swap(block) ;
+      lock.unlock() ;
+      fCondition.notify_all() ;
+      if (isLast) return ;
+    }
+  }
+
+  SRSRawSource * fSource ;
+  std::vector<char> fBlock ;
+  size_t fBlockPos ;
+  bool fIsEnd ;
+
+  std::thread fThread ;
+  std::mutex fMutex ;
+  std::condition_variable fCondition ;
+  std::deque<std::vector<char> > fBlocks ;
+  bool fIsStopped ;
+};
+
+//============================================================================================
+// One regular file of a tar archive (ustar, GNU long names)
+class SRSTarMemberSource : public SRSRawSource {
+
+ public:
+  SRSTarMemberSource(SRSRawSource * archive) : fArchive(archive) {
+    fArchiveOffset = fDataStart = fSize = fPos = 0 ;
+  }
+  ~SRSTarMemberSource() {delete fArchive;}
+
+  //=== Moves to the data of member, by its path in the archive or its file name
+  bool Find(const std::string & member) {
+    char header[512] ;
+    std::string longName ;
+    while (ReadArchive(header, sizeof(header)) == sizeof(header)) {
+      if (header[0] == 0) return false ;
+
+      std::string name = longName.empty() ? TarString(header, 100) : longName ;
+      if (longName.empty() && (memcmp(header + 257, "ustar", 5) == 0) && (header[345] != 0)) name = TarString(header + 345, 155) + "/" + name ;
+      longName.clear() ;
+
+      unsigned long long size = TarNumber(header + 124, 12) ;
+      unsigned long long paddedSize = (size + 511) / 512 * 512 ;
+      char type = header[156] ;
+
+      if (type == 'L') {
+        std::vector<char> buffer(paddedSize + 1, 0) ;
+        if (ReadArchive(&buffer[0], paddedSize) != (std::streamsize) paddedSize) return false ;
+        longName = &buffer[0] ;
+        continue ;
+      }
+      if (((type == '0') || (type == 0)) && IsMember(name, member)) {
+        fDataStart = fArchiveOffset ;
+        fSize = size ;
+        return true ;
+      }
+      if (!SkipArchive(paddedSize)) return false ;
+    }
+    return false ;
+  }
+
+  std::streamsize Read(char * s, std::streamsize n) {
+    if ((unsigned long long) n > fSize - fPos) n = fSize - fPos ;
+    std::streamsize nRead = (n > 0) ? ReadArchive(s, n) : 0 ;
+    fPos += nRead ;
+    return nRead ;
+  }
+
+  bool IsSeekable() const {return fArchive->IsSeekable();}
+  bool Seek(unsigned long long offset) {
+    if ((offset > fSize) || !fArchive->Seek(fDataStart + offset)) return false ;
+    fArchiveOffset = fDataStart + offset ;
+    fPos = offset ;
+    return true ;
+  }
+  unsigned long long GetSize() const {return fSize;}
+
+ private:
+  std::streamsize ReadArchive(char * s, std::streamsize n) {
+    std::streamsize nRead = fArchive->Read(s, n) ;
+    fArchiveOffset += nRead ;
+    return nRead ;
+  }
+
+  bool SkipArchive(unsigned long long n) {
+    if (fArchive->IsSeekable()) {
+      fArchiveOffset += n ;
+      return fArchive->Seek(fArchiveOffset) ;
+    }
+    std::vector<char> buffer(65536) ;
+    while (n > 0) {
+      std::streamsize nRead = ReadArchive(&buffer[0], std::min(n, (unsigned long long) buffer.size())) ;
+      if (nRead <= 0) return false ;
+      n -= nRead ;
+    }
+    return true ;
+  }
+
+  static std::string TarString(const char * field, unsigned int size) {
+    return std::string(field, strnlen(field, size)) ;
+  }
+
+  //=== Octal, or base 256 (first bit set) for members of 8 GB and more
+  static unsigned long long TarNumber(const char * field, unsigned int size) {
+    unsigned long long value = 0 ;
+    if (field[0] & 0x80) {
+      value = field[0] & 0x7f ;
+      for (unsigned int i = 1; i < size; i++) value = (value << 8) | (unsigned char) field[i] ;
+      return value ;
+    }
+    for (unsigned int i = 0; i < size; i++) {
+      if ((field[i] >= '0') && (field[i] <= '7')) value = (value << 3) | (field[i] - '0') ;
+      else if ((field[i] != ' ') || (value != 0)) break ;
+    }
+    return value ;
+  }
+
+  static bool IsMember(const std::string & name, const std::string & member) {
+    if ((name == member) || (name == "./" + member)) return true ;
+    size_t slash = name.rfind('/') ;
+    return (slash != std::string::npos) && (name.substr(slash + 1) == member) ;
+  }
+
+  SRSRawSource * fArchive ;
+  unsigned long long fArchiveOffset, fDataStart, fSize, fPos ;
+};
+
+//============================================================================================
+std::string SRSRawSource::GetDiskFile(const std::string & name) {
+  struct stat fileStat ;
+  if (stat(name.c_str(), &fileStat) == 0) return name ;
+
+  //=== archive:member
+  size_t colon = name.rfind(':') ;
+  if ((colon != std::string::npos) && (stat(name.substr(0, colon).c_str(), &fileStat) == 0)) return name.substr(0, colon) ;
+  return name ;
+}
+
+//============================================================================================
+SRSRawSource * SRSRawSource::Open(const std::string & name) {
+  std::string diskFile = GetDiskFile(name) ;
+  std::string member = (diskFile == name) ? "" : name.substr(diskFile.size() + 1) ;
+
+  SRSPlainSource * plain = new SRSPlainSource(diskFile) ;
+  if (!plain->IsOpen()) {
+    delete plain ;
+    return 0 ;
+  }
+
+  unsigned char magic[4] = {0, 0, 0, 0} ;
+  plain->Read((char *) magic, sizeof(magic)) ;
+  plain->Seek(0) ;
+
+  SRSRawSource * source = plain ;
+  const char * format = 0 ;
+  if ((magic[0] == 0x1f) && (magic[1] == 0x8b)) {
+    format = "gzip" ;
+    source = new SRSGzipSource(plain) ;
+  }
+  else if ((magic[0] == 0x28) && (magic[1] == 0xb5) && (magic[2] == 0x2f) && (magic[3] == 0xfd)) {
+    format = "zstd" ;
+#ifdef SRS_WITH_ZSTD
+    source = new SRSZstdSource(plain) ;
+#else
+    source = 0 ;
+#endif
+  }
+  else if ((magic[0] == 0x04) && (magic[1] == 0x22) && (magic[2] == 0x4d) && (magic[3] == 0x18)) {
+    format = "lz4" ;
+#ifdef SRS_WITH_LZ4
+    source = new SRSLz4Source(plain) ;
+#else
+    source = 0 ;
+#endif
+  }
+
+  if (!source) {
+    printf("  SRSRawSource::Open() ==> ERROR: %s is %s compressed, this build has no %s support \n", diskFile.c_str(), format, format) ;
+    delete plain ;
+    return 0 ;
+  }
+  if (format) {
+    printf("  SRSRawSource::Open() ==> %s is %s compressed, decompressing on the fly \n", diskFile.c_str(), format) ;
+    source = new SRSReadAheadSource(source) ;
+  }
+
+  if (!member.empty()) {
+    SRSTarMemberSource * tarMember = new SRSTarMemberSource(source) ;
+    if (!tarMember->Find(member)) {
+      printf("  SRSRawSource::Open() ==> ERROR: no file %s in the tar archive %s \n", member.c_str(), diskFile.c_str()) ;
+      delete tarMember ;
+      return 0 ;
+    }
+    source = tarMember ;
+  }
+  return source ;
+}
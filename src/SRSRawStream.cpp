@@ -0,0 +1,142 @@
+#include "SRSRawStream.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <algorithm>
+
+//============================================================================================
+SRSRawStream::SRSRawStream(const std::string & rawfiles) {
+  fCurrentFile = 0 ;
+  fLastCount = 0 ;
+  fIsOpen = fEOF = false ;
+
+  fFiles = SplitFiles(rawfiles) ;
+
+  //=== Sizes on disk, to identify the run
+  for (unsigned int iFile = 0; iFile < fFiles.size(); iFile++) fFileSizes.push_back(GetDiskSize(fFiles[iFile])) ;
+
+  //=== The stream is open if its first file is
+  fIsOpen = (!fFiles.empty()) && OpenFile(0) ;
+  fEOF = !fIsOpen ;
+}
+
+//============================================================================================
+// Comma separated list, whitespaces ignored
+std::vector<std::string> SRSRawStream::SplitFiles(const std::string & rawfiles) {
+  std::vector<std::string> files ;
+  std::string file ;
+  for (unsigned int i = 0; i <= rawfiles.size(); i++) {
+    if ((i == rawfiles.size()) || (rawfiles[i] == ',')) {
+      if (!file.empty()) files.push_back(file) ;
+      file.clear() ;
+    }
+    else if ((rawfiles[i] != ' ') && (rawfiles[i] != '\t')) file += rawfiles[i] ;
+  }
+  return files ;
+}
+
+//============================================================================================
+// Size of the file on disk holding the data (the archive of a member), 0 if missing
+unsigned long long SRSRawStream::GetDiskSize(const std::string & file) {
+  struct stat fileStat ;
+  return (stat(SRSRawSource::GetDiskFile(file).c_str(), &fileStat) == 0) ? fileStat.st_size : 0 ;
+}
+
+//============================================================================================
+bool SRSRawStream::OpenFile(unsigned int iFile) {
+  fSource.reset() ;
+
+  fCurrentFile = iFile ;
+  fSource.reset(SRSRawSource::Open(fFiles[iFile])) ;
+  if (!fSource) {
+    printf("  SRSRawStream::OpenFile() ==> ERROR: cannot open raw file %s \n", fFiles[iFile].c_str()) ;
+    return false ;
+  }
+
+  if (iFile > 0) printf("  SRSRawStream::OpenFile() ==> Continuing with raw file %s \n", fFiles[iFile].c_str()) ;
+
+  //=== Read ahead the next file while this one is processed
+  if (iFile + 1 < fFiles.size()) Prefetch(iFile + 1) ;
+  return true ;
+}
+
+//============================================================================================
+void SRSRawStream::Prefetch(unsigned int iFile) {
+#ifdef POSIX_FADV_WILLNEED
+  int fd = ::open(SRSRawSource::GetDiskFile(fFiles[iFile]).c_str(), O_RDONLY) ;
+  if (fd < 0) return ;
+  posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED) ;
+  ::close(fd) ;
+#endif
+}
+
+//============================================================================================
+SRSRawStream & SRSRawStream::read(char * s, std::streamsize n) {
+  fLastCount = 0 ;
+  while (!fEOF && (n > 0)) {
+    std::streamsize nRead = fSource ? fSource->Read(s, n) : 0 ;
+    s += nRead ;
+    n -= nRead ;
+    fLastCount += nRead ;
+    if (n == 0) break ;
+
+    //=== Current file exhausted, a word may continue in the next file; unreadable files are skipped
+    bool isOpened = false ;
+    while (!isOpened && (fCurrentFile + 1 < fFiles.size())) isOpened = OpenFile(fCurrentFile + 1) ;
+    if (!isOpened) fEOF = true ;
+  }
+  return *this ;
+}
+
+//============================================================================================
+unsigned long long SRSRawStream::GetSize() const {
+  unsigned long long size = 0 ;
+  for (unsigned int iFile = 0; iFile < fFileSizes.size(); iFile++) size += fFileSizes[iFile] ;
+  return size ;
+}
+
+//============================================================================================
+// The index of a run is checked before any file is opened: no decompression thread is started
+unsigned long long SRSRawStream::GetSize(const std::string & rawfiles) {
+  std::vector<std::string> files = SplitFiles(rawfiles) ;
+  unsigned long long size = 0 ;
+  for (unsigned int iFile = 0; iFile < files.size(); iFile++) size += GetDiskSize(files[iFile]) ;
+  return size ;
+}
+
+//============================================================================================
+bool SRSRawStream::seekg(unsigned long long offset) {
+  unsigned long long fileStart = 0 ;
+  for (unsigned int iFile = 0; iFile < fFiles.size(); iFile++) {
+    if (!OpenFile(iFile)) continue ;
+    fEOF = false ;
+
+    //=== Plain files (or members of a plain tar) are jumped over
+    if (fSource->IsSeekable()) {
+      unsigned long long size = fSource->GetSize() ;
+      if (offset < fileStart + size) return fSource->Seek(offset - fileStart) ;
+      fileStart += size ;
+      continue ;
+    }
+
+    //=== Compressed: decompressed up to the offset, or to its end
+    std::vector<char> buffer(1 << 20) ;
+    while (fileStart < offset) {
+      std::streamsize nRead = fSource->Read(&buffer[0], std::min(offset - fileStart, (unsigned long long) buffer.size())) ;
+      if (nRead <= 0) break ;
+      fileStart += nRead ;
+    }
+    if (fileStart == offset) return true ;
+  }
+  printf("  SRSRawStream::seekg() ==> ERROR: offset %llu beyond the end of the stream (%llu bytes) \n", offset, fileStart) ;
+  fEOF = true ;
+  return false ;
+}
+
+//============================================================================================
+void SRSRawStream::close() {
+  fSource.reset() ;
+  fIsOpen = false ;
+}
@@ -69,17 +69,9 @@ void SelectorCluster::setClusters(std::string &strInputRootFileName, Uniformity:
 //Input is a TFile *
 void SelectorCluster::setClusters(TFile * file_InputRootFile, Uniformity::DetectorMPGD &inputDet){
     //Variable Declaration
-    Int_t iClustMulti;  //I cry a little inside because of this
-    Int_t iClustSize[3072];
-    Int_t iClustTimeBin[3072];
-    
-    Float_t fClustPos_X[3072];
-    Float_t fClustPos_Y[3072];
-    Float_t fClustADC[3072];
-    
-    Cluster clust;
+    bool bUseIndex = false;
     
-    std::pair<int,int> pair_iEvtRange;
+    EventIndex indexEvt;
     
     TTree *tree_Clusters = NULL;
     
@@ -102,6 +94,69 @@ void SelectorCluster::setClusters(TFile * file_InputRootFile, Uniformity::Detect
         return;
     } //End Case: failed to load TTree
     
+    //Read from the cluster cache instead of the tree if requested
+    //------------------------------------------------------
+    if ( aSetup.bClusterCache_Use ) { //Case: Use Cluster Cache
+        string strFileName  = file_InputRootFile->GetName();
+        string strCacheName = getClusterCacheName( strFileName );
+        
+        ClusterCacheReader readerCache;
+        
+        //Create (or refresh) the cache from the tree
+        if ( !isClusterCacheCurrent(strCacheName, strFileName) ) { convertClusterTree(tree_Clusters, strCacheName); }
+        
+        if ( readerCache.open(strCacheName) && readerCache.getNumEvents() == tree_Clusters->GetEntries() ) {
+            setClusters(readerCache, inputDet);
+            
+            return;
+        }
+        
+        printClassMethodMsg("SelectorCluster","setClusters",("cluster cache " + strCacheName + " not usable; reading the TCluster tree").c_str() );
+    } //End Case: Use Cluster Cache
+    
+    //Load the event index if requested; the cluster multiplicity is then taken from it
+    //------------------------------------------------------
+    if ( aSetup.bEventIndex_Use ) { //Case: Use Event Index
+        bUseIndex = ( loadEventIndex(file_InputRootFile, indexEvt, true, false) && indexEvt.getNumEvents() == tree_Clusters->GetEntries() );
+        
+        if ( !bUseIndex ) { printClassMethodMsg("SelectorCluster","setClusters","event index not usable; reading nclust from the TCluster tree"); }
+    } //End Case: Use Event Index
+    
+    //Select the clusters
+    //------------------------------------------------------
+    setClusters(tree_Clusters, (bUseIndex ? &indexEvt : nullptr), inputDet);
+    
+    //Do not close the input TFile, it is used elsewhere
+    
+    return;
+} //End SelectorCluster::setClusters()
+
+//Given the TCluster tree (or a TChain of TCluster trees) from amoreSRS
+//Applies the cluster selection and stores those selected clusters in inputDet
+//Input is a TTree *, event numbers are the tree (chain) entry numbers
+void SelectorCluster::setClusters(TTree * tree_Clusters, Uniformity::DetectorMPGD &inputDet){
+    setClusters(tree_Clusters, nullptr, inputDet);
+    
+    return;
+} //End SelectorCluster::setClusters()
+
+//As above; if ptr_Index is not a nullptr the cluster multiplicity is taken from it
+void SelectorCluster::setClusters(TTree * tree_Clusters, Uniformity::EventIndex * ptr_Index, Uniformity::DetectorMPGD &inputDet){
+    //Variable Declaration
+    int iEta;
+    
+    Int_t iClustMulti;  //I cry a little inside because of this
+    Int_t iClustSize[3072];
+    Int_t iClustTimeBin[3072];
+    
+    Float_t fClustPos_X[3072];
+    Float_t fClustPos_Y[3072];
+    Float_t fClustADC[3072];
+    
+    Cluster clust;
+    
+    std::pair<int,int> pair_iEvtRange;
+    
     //Initialize Tree Branch Address to retrieve the cluster information
     //------------------------------------------------------
     tree_Clusters->SetBranchAddress("nclust", &iClustMulti);
@@ -122,15 +177,20 @@ void SelectorCluster::setClusters(TFile * file_InputRootFile, Uniformity::Detect
         //First check to make sure the cluster multiplicity is within the selection
         //Only then get the info on the clusters
         
-        //Make sure we only read the number of clusters
-        tree_Clusters->SetBranchStatus("*",0);
-        tree_Clusters->SetBranchStatus("nclust",1);
-        
-        //Get the number of clusters
-        tree_Clusters->GetEntry(i);
+        if ( ptr_Index != nullptr ) { //Case: Multiplicity from Event Index, no I/O for rejected events
+            iClustMulti = ptr_Index->getNumClusters(i);
+        } //End Case: Multiplicity from Event Index, no I/O for rejected events
+        else{ //Case: Multiplicity from Tree
+            //Make sure we only read the number of clusters
+            tree_Clusters->SetBranchStatus("*",0);
+            tree_Clusters->SetBranchStatus("nclust",1);
+            
+            //Get the number of clusters
+            tree_Clusters->GetEntry(i);
+        } //End Case: Multiplicity from Tree
         
         //Output to the user some message that we are still running
-        if (i % 1000 == 0) cout<<"Cluster Selection; " <<i<<" Events Analyzed\n";
+        if (i % 1000 == 0) Logger::getInstance().logf(kLogInfo, "SelectorCluster::setClusters()", "%i Events Analyzed", i);
         
         //If the event fails to pass the selection; skip it
         //---------------Event Selection---------------
@@ -146,6 +206,14 @@ void SelectorCluster::setClusters(TFile * file_InputRootFile, Uniformity::Detect
         //Loop Over the elements of the cluster array (yes it must be done like this due to how hte NTuple from AMORE is created)
         //For each element create a cluster, and check if it passes the selection
         for (int j=0; j < iClustMulti; ++j) { //Loop Over Number of Clusters
+            //If the cluster is centered on a masked strip; skip it before doing any work
+            //---------------Strip Mask---------------
+            if ( !maskStrips.empty() ) { //Case: Strip Mask Defined
+                iEta = inputDet.getEtaIdx(fClustPos_Y[j]);
+                
+                if ( maskStrips.isMasked( iEta, inputDet.getStripNum(iEta, fClustPos_X[j]) ) ) continue;
+            } //End Case: Strip Mask Defined
+            
             //Set the cluster info
             clust.fPos_Y = fClustPos_Y[j];
             clust.fPos_X = fClustPos_X[j];
@@ -165,7 +233,68 @@ void SelectorCluster::setClusters(TFile * file_InputRootFile, Uniformity::Detect
         } //End Loop Over Number of Clusters
     } //End Loop Over "Events"
     
-    //Do not close the input TFile, it is used elsewhere
+    return;
+} //End SelectorCluster::setClusters()
+
+//Given a cluster cache (see ClusterCache.h)
+//Applies the cluster selection and stores those selected clusters in inputDet
+void SelectorCluster::setClusters(ClusterCacheReader & inputCache, Uniformity::DetectorMPGD &inputDet){
+    //Variable Declaration
+    int iClustMulti;
+    int iEta;
+    
+    const ClusterCacheRecord * ptr_Clust = NULL;
+    
+    Cluster clust;
+    
+    std::pair<int,int> pair_iEvtRange;
+    
+    //Determine Event Range
+    //------------------------------------------------------
+    pair_iEvtRange = getEventRange( aSetup.iEvt_First, aSetup.iEvt_Total, inputCache.getNumEvents() );
+    
+    //Get data event-by-event
+    //------------------------------------------------------
+    for (int i=pair_iEvtRange.first; i < pair_iEvtRange.second; ++i) {
+        iClustMulti = inputCache.getNumClusters(i);
+        
+        //Output to the user some message that we are still running
+        if (i % 1000 == 0) Logger::getInstance().logf(kLogInfo, "SelectorCluster::setClusters()", "%i Events Analyzed", i);
+        
+        //If the event fails to pass the selection; skip it
+        //---------------Event Selection---------------
+        //Cut on number of clusters
+        if ( !(aSetup.selClust.iCut_MultiMin < iClustMulti && iClustMulti < aSetup.selClust.iCut_MultiMax) ) continue;
+        
+        ptr_Clust = inputCache.getClusters(i);
+        
+        for (int j=0; j < iClustMulti; ++j, ++ptr_Clust) { //Loop Over Number of Clusters
+            //If the cluster is centered on a masked strip; skip it before doing any work
+            //---------------Strip Mask---------------
+            if ( !maskStrips.empty() ) { //Case: Strip Mask Defined
+                iEta = inputDet.getEtaIdx(ptr_Clust->fPlaneID);
+                
+                if ( maskStrips.isMasked( iEta, inputDet.getStripNum(iEta, ptr_Clust->fPos) ) ) continue;
+            } //End Case: Strip Mask Defined
+            
+            //Set the cluster info
+            clust.fPos_Y = ptr_Clust->fPlaneID;
+            clust.fPos_X = ptr_Clust->fPos;
+            
+            clust.fADC = ptr_Clust->fADC;
+            
+            clust.iSize = ptr_Clust->iSize;
+            
+            clust.iTimeBin = ptr_Clust->iTimeBin;
+            
+            //If the cluster fails to pass the selection; skip it
+            //---------------Cluster Selection---------------
+            if ( !clusterPassesSelection(clust) ) continue;
+            
+            //If a cluster makes it here, store it in the detector
+            inputDet.setCluster(i, clust);
+        } //End Loop Over Number of Clusters
+    } //End Loop Over "Events"
     
     return;
 } //End SelectorCluster::setClusters()
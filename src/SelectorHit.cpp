@@ -76,6 +76,60 @@ void SelectorHit::setHits(std::string &strInputRootFileName, Uniformity::Detecto
 //Right now ADC information of hits is not yet supported
 //Input is a TFile *
 void SelectorHit::setHits(TFile * file_InputRootFile, Uniformity::DetectorMPGD &inputDet){
+    //Variable Declaration
+    bool bUseIndex = false;
+    
+    EventIndex indexEvt;
+    
+    TTree *tree_Hits = NULL;
+    
+    //Check to see if data file opened successfully, if so load the tree
+    //------------------------------------------------------
+    if ( !file_InputRootFile->IsOpen() || file_InputRootFile->IsZombie() ) { //Case: failed to load ROOT file
+        perror( ("Uniformity::SelectorHit::setHits() - error while opening file: " + (string)file_InputRootFile->GetName() ).c_str() );
+        Timing::printROOTFileStatus(file_InputRootFile);
+        std::cout << "Exiting!!!\n";
+        
+        return;
+    } //End Case: failed to load ROOT file
+    
+    tree_Hits = (TTree*) file_InputRootFile->Get("THit");
+    
+    if ( nullptr == tree_Hits ) { //Case: failed to load TTree
+        printClassMethodMsg("SelectorHit","setHits",("error while fetching: " + (string) file_InputRootFile->GetName() ).c_str() );
+        printClassMethodMsg("SelectorHit","setHits","\tTree returns nullptr; Exiting!!!");
+        
+        return;
+    } //End Case: failed to load TTree
+    
+    //Load the event index if requested; the hit multiplicity is then taken from it
+    //------------------------------------------------------
+    if ( aSetup.bEventIndex_Use ) { //Case: Use Event Index
+        bUseIndex = ( loadEventIndex(file_InputRootFile, indexEvt, false, true) && indexEvt.getNumEvents() == tree_Hits->GetEntries() );
+        
+        if ( !bUseIndex ) { printClassMethodMsg("SelectorHit","setHits","event index not usable; reading nch from the THit tree"); }
+    } //End Case: Use Event Index
+    
+    //Select the hits
+    //------------------------------------------------------
+    setHits(tree_Hits, (bUseIndex ? &indexEvt : nullptr), inputDet);
+    
+    //Do not close the input TFile, it is used elsewhere
+    
+    return;
+} //End SelectorHit::setHits()
+
+//Given the THit tree (or a TChain of THit trees) from amoreSRS
+//Applies the hit selection and stores those selected hits in inputDet
+//Input is a TTree *, event numbers are the tree (chain) entry numbers
+void SelectorHit::setHits(TTree * tree_Hits, Uniformity::DetectorMPGD &inputDet){
+    setHits(tree_Hits, nullptr, inputDet);
+    
+    return;
+} //End SelectorHit::setHits()
+
+//As above; if ptr_Index is not a nullptr the hit multiplicity is taken from it
+void SelectorHit::setHits(TTree * tree_Hits, Uniformity::EventIndex * ptr_Index, Uniformity::DetectorMPGD &inputDet){
     //Variable Declaration
     Float_t fHitPos_Y[3072];
     
@@ -117,27 +171,6 @@ void SelectorHit::setHits(TFile * file_InputRootFile, Uniformity::DetectorMPGD &
 	Short_t sHitADC_Bin28[3072];
 	Short_t sHitADC_Bin29[3072];
 
-    TTree *tree_Hits = NULL;
-    
-    //Check to see if data file opened successfully, if so load the tree
-    //------------------------------------------------------
-    if ( !file_InputRootFile->IsOpen() || file_InputRootFile->IsZombie() ) { //Case: failed to load ROOT file
-        perror( ("Uniformity::SelectorHit::setHits() - error while opening file: " + (string)file_InputRootFile->GetName() ).c_str() );
-        Timing::printROOTFileStatus(file_InputRootFile);
-        std::cout << "Exiting!!!\n";
-        
-        return;
-    } //End Case: failed to load ROOT file
-    
-    tree_Hits = (TTree*) file_InputRootFile->Get("THit");
-    
-    if ( nullptr == tree_Hits ) { //Case: failed to load TTree
-        printClassMethodMsg("SelectorHit","setHits",("error while fetching: " + (string) file_InputRootFile->GetName() ).c_str() );
-        printClassMethodMsg("SelectorHit","setHits","\tTree returns nullptr; Exiting!!!");
-        
-        return;
-    } //End Case: failed to load TTree
-    
     //Initialize Tree Branch Address to retrieve the hit information (ADC values are done separately below)
     //------------------------------------------------------
     tree_Hits->SetBranchAddress("hitTimebin",&iHitTimeBin);
@@ -189,15 +222,20 @@ void SelectorHit::setHits(TFile * file_InputRootFile, Uniformity::DetectorMPGD &
         //First check to make sure the hit multiplicity is within the selection
         //Only then get the info on the hits
         
-        //Make sure we only read the number of hits
-        tree_Hits->SetBranchStatus("*",0);
-        tree_Hits->SetBranchStatus("nch",1);
-        
-        //Get the number of hits
-        tree_Hits->GetEntry(i);
+        if ( ptr_Index != nullptr ) { //Case: Multiplicity from Event Index, no I/O for rejected events
+            iHitMulti = ptr_Index->getNumHits(i);
+        } //End Case: Multiplicity from Event Index, no I/O for rejected events
+        else{ //Case: Multiplicity from Tree
+            //Make sure we only read the number of hits
+            tree_Hits->SetBranchStatus("*",0);
+            tree_Hits->SetBranchStatus("nch",1);
+            
+            //Get the number of hits
+            tree_Hits->GetEntry(i);
+        } //End Case: Multiplicity from Tree
         
         //Output to the user some message that we are still running
-        if (i % 1000 == 0) cout<<"Hit Selection; " <<i<<" Events Analyzed\n";
+        if (i % 1000 == 0) Logger::getInstance().logf(kLogInfo, "SelectorHit::setHits()", "%i Events Analyzed", i);
         
         //If the event fails to pass the selection; skip it
         //---------------Event Selection---------------
@@ -213,6 +251,10 @@ void SelectorHit::setHits(TFile * file_InputRootFile, Uniformity::DetectorMPGD &
         //Loop Over the elements of the hit array (yes it must be done like this due to how hte NTuple from AMORE is created)
         //For each element create a hit, and check if it passes the selection
         for (int j=0; j < iHitMulti; ++j) { //Loop Over Number of Hits
+            //If the hit is on a masked strip; skip it before doing any work
+            //---------------Strip Mask---------------
+            if ( !maskStrips.empty() && maskStrips.isMasked( inputDet.getEtaIdx(fHitPos_Y[j]), iHitStrip[j] ) ) continue;
+            
             //Define the Hit
             Hit hitStrip;
 
@@ -269,8 +311,6 @@ void SelectorHit::setHits(TFile * file_InputRootFile, Uniformity::DetectorMPGD &
     //------------------------------------------------------
     //  Placeholder
     
-    //Do not close the input TFile, it is used elsewhere
-    
     return;
 } //End SelectorHit::setHits()
 
@@ -41,16 +41,19 @@ std::pair<int,int> QualityControl::Uniformity::getEventRange(int iFirstEvt, int
             
             return pair_iRange;
         } //End Case: Incorrect Event Range, 1st Event Requested Beyond All Events
-        else if( (iFirstEvt + iNEvt) > iNTreeEntries ){
-            iNEvt = iNTreeEntries - iFirstEvt;
-        }
-        else if( iFirstEvt < 0){
+        
+        if( iFirstEvt < 0){
             iFirstEvt = 0;
         }
+        
+        if( (iFirstEvt + iNEvt) > iNTreeEntries ){
+            iNEvt = iNTreeEntries - iFirstEvt;
+        }
     } //End Case: Event Range
     
+    //Range is [first, second); callers loop i = first; i < second
     pair_iRange.first = iFirstEvt;
-    pair_iRange.second = iNEvt;
+    pair_iRange.second = iFirstEvt + iNEvt;
     
     return pair_iRange;
 } //End HandlerEvent::getEventRange();
@@ -33,6 +33,13 @@ void VisualizeComparison::storeCanvasComparisonHisto(std::string strOutputROOTFi
     TH1::AddDirectory(kFALSE);
     
     //Variable Declaration
+    map<int, string> map_strIdentFiles;
+    
+    vector<int> vec_iFiles;
+    
+    vector<string> vec_strObsNames = getCharSeparatedList(strObsName, ',');
+    vector<string> vec_strObsPaths;
+    
     TFile * ptr_fileOutput = new TFile(strOutputROOTFileName.c_str(), strOption.c_str(),"",1);
     
     //Check if File Failed to Open Correctly
@@ -46,9 +53,24 @@ void VisualizeComparison::storeCanvasComparisonHisto(std::string strOutputROOTFi
         return;
     } //End Check if File Failed to Open Correctly
     
-    //Call the method below
+    //Read every requested histogram from the identified input files up front
+    //------------------------------------------------------
+    map_strIdentFiles = getIdentifiedFiles();
+    for (auto iterFile = map_strIdentFiles.begin(); iterFile != map_strIdentFiles.end(); ++iterFile) {
+        vec_iFiles.push_back( (*iterFile).first );
+    }
+    
+    for (int i=0; i < vec_strObsNames.size(); ++i) {
+        vec_strObsPaths.push_back( getObsHistoPath( vec_strObsNames[i] ) );
+    }
+    
+    m_input.prefetch(vec_iFiles, vec_strObsPaths);
+    
+    //Call the method below for each observable
     //------------------------------------------------------
-    storeCanvasComparisonHisto(ptr_fileOutput, strObsName);
+    for (int i=0; i < vec_strObsNames.size(); ++i) {
+        storeCanvasComparisonHisto(ptr_fileOutput, vec_strObsNames[i]);
+    }
     
     //Close the File
     //------------------------------------------------------
@@ -158,27 +180,47 @@ void VisualizeComparison::setRunParameters(Uniformity::RunSetup inputSetup){
     return;
 } //End VisualizeComparison::setRunParameters()
 
-//Returns a map of identifier (key) and observable histogram
-shared_ptr<TH1F> VisualizeComparison::getObsHisto(TFile * file_InputRootFile, string strObsName){
-    //TFile does not manage objects
-    TH1::AddDirectory(kFALSE);
-    
+//Returns a map of index in m_vec_strFileList (key) and identifier (value) for each input file whose name contains m_strIdent
+map<int, string> VisualizeComparison::getIdentifiedFiles(){
     //Variable Declaration
-    shared_ptr<TH1F> ret_hObs;
+    map<int, string> ret_map_strIdentFiles;
     
-    string strRootFilePath = "";
+    string strFilenameNoSlashes = ""; //for string manipulation
     
-    //Check if File Failed to Open Correctly
-    //------------------------------------------------------
-    if ( !file_InputRootFile->IsOpen() || file_InputRootFile->IsZombie()  ) {
-        printClassMethodMsg("VisualizeComparison","getObsHisto","Error: File I/O");
-        printROOTFileStatus(file_InputRootFile);
-        printClassMethodMsg("VisualizeComparison","getObsHisto", "\tPlease cross check input file name, option, and the execution directory\n" );
-        printClassMethodMsg("VisualizeComparison","getObsHisto", "\tExiting; No Histograms have been stored!\n" );
+    vector<string> vec_strParsedName;
+    
+    for (int i=0; i<m_vec_strFileList.size(); ++i) { //Loop Over m_vec_strFileList
+        strFilenameNoSlashes = m_vec_strFileList[i];
         
-        return ret_hObs;
-    } //End Check if File Failed to Open Correctly
+        //Strip the file path
+        std::size_t posLastSlash = strFilenameNoSlashes.find_last_of("/");
+        if (posLastSlash != std::string::npos) {
+            strFilenameNoSlashes.erase(0,posLastSlash+1);
+        }
+        
+        //Get the underscore separated list of fields
+        vec_strParsedName = getCharSeparatedList(strFilenameNoSlashes, '_');
+        
+        //Look for the identifier, if not found skip this file
+        auto iterStr = std::find_if(vec_strParsedName.begin(), vec_strParsedName.end(), contains(m_strIdent) );
+        if ( iterStr == vec_strParsedName.end() ) continue;
+        
+        ret_map_strIdentFiles[i] = (*iterStr);
+    } //End Loop Over m_vec_strFileList
+    
+    return ret_map_strIdentFiles;
+} //End VisualizeComparison::getIdentifiedFiles()
 
+//Returns the histogram of an observable from input file iFile
+shared_ptr<TH1F> VisualizeComparison::getObsHisto(int iFile, string strObsName){
+    return m_input.getHisto(iFile, getObsHistoPath(strObsName) );
+} //End VisualizeComparison::getObsHisto()
+
+//Returns the path of an observable's histogram inside an input file
+string VisualizeComparison::getObsHistoPath(string strObsName){
+    //Variable Declaration
+    string strRootFilePath = "";
+    
     //Setup the filepath
     //------------------------------------------------------
     if (m_iSlice > -1) {
@@ -194,16 +236,10 @@ shared_ptr<TH1F> VisualizeComparison::getObsHisto(TFile * file_InputRootFile, st
         strRootFilePath = "Summary/";
     } //End Case: iEta Sector, sum over sector's iPhi
     
-    strRootFilePath = strRootFilePath + getNameByIndex(m_iEta, m_iPhi, m_iSlice, "h", strObsName);
-    
-    //Get the TH1F from the file
-    //------------------------------------------------------
-    
-    ret_hObs = make_shared<TH1F>( *((TH1F*) file_InputRootFile->Get( strRootFilePath.c_str() ) ) );
-    
-    return ret_hObs;
-} //End VisualizeComparison::getObsHisto()
+    return strRootFilePath + getNameByIndex(m_iEta, m_iPhi, m_iSlice, "h", strObsName);
+} //End VisualizeComparison::getObsHistoPath()
 
+//Returns a map of identifier (key) and observable histogram
 map<string, shared_ptr<TH1F> > VisualizeComparison::getObsHistoMap(std::string strObsName){
     //TFile does not manage objects
     TH1::AddDirectory(kFALSE);
@@ -211,48 +247,20 @@ map<string, shared_ptr<TH1F> > VisualizeComparison::getObsHistoMap(std::string s
     //Variable Declaration
     map<string, shared_ptr<TH1F> > ret_map_hObs;
     
+    map<int, string> map_strIdentFiles = getIdentifiedFiles();
+    
     shared_ptr<TH1F> hObs;
     
     string strHistoName = "";
-    string strKey = "";
-    string strFilenameNoSlashes = ""; //for string manipulation
-    
-    vector<string> vec_strParsedName;
     
-    for (int i=0; i<m_vec_strFileList.size(); ++i) { //Loop Over m_vec_strFileList
-        strFilenameNoSlashes = m_vec_strFileList[i];
-        
-        //Get the file
-        TFile * file_InputRootFile = new TFile(m_vec_strFileList[i].c_str(), "READ","",1);
-        
-        //Strip the file path
-        std::size_t posLastSlash = strFilenameNoSlashes.find_last_of("/");
-        if (posLastSlash != std::string::npos) {
-            strFilenameNoSlashes.erase(0,posLastSlash+1);
-            //strFilenameNoSlashes = strFilenameNoSlashes(posLastSlash+1);
-            
-        }
-        
-        //Get the underscore separated list of fields
-        vec_strParsedName = getCharSeparatedList(strFilenameNoSlashes, '_');
-        
-        //Look for the identifier, if not found skip this file
-        auto iterStr = std::find_if(vec_strParsedName.begin(), vec_strParsedName.end(), contains(m_strIdent) );
-        if ( iterStr == vec_strParsedName.end() ) {
-            file_InputRootFile->Close();
-            continue;
-        }
-        
+    for (auto iterFile = map_strIdentFiles.begin(); iterFile != map_strIdentFiles.end(); ++iterFile) { //Loop Over Identified Files
         //Get the histogram, if null skip this file
-        hObs = getObsHisto(file_InputRootFile, strObsName);
-        if ( hObs == nullptr) {
-            file_InputRootFile->Close();
-            continue;
-        }
+        hObs = getObsHisto( (*iterFile).first, strObsName);
+        if ( hObs == nullptr) continue;
         
         //Append the name of the histogram
         strHistoName = hObs->GetName();
-        strHistoName = strHistoName + "_" + (*iterStr);
+        strHistoName = strHistoName + "_" + (*iterFile).second;
         hObs->SetName( strHistoName.c_str() );
         
         //Normalize the histogram?
@@ -260,11 +268,9 @@ map<string, shared_ptr<TH1F> > VisualizeComparison::getObsHistoMap(std::string s
             hObs->Scale( 1. / hObs->Integral() );
         }
         
-        //Store this histogram and close the file
-        ret_map_hObs[(*iterStr)] = hObs;
-        file_InputRootFile->Close();
-        delete file_InputRootFile;
-    } //End Loop Over m_vec_strFileList
+        //Store this histogram
+        ret_map_hObs[(*iterFile).second] = hObs;
+    } //End Loop Over Identified Files
     
     return ret_map_hObs;
 } //End VisualizeComparison::getObsHistoMap()
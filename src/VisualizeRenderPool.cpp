@@ -0,0 +1,206 @@
+//
+//  VisualizeRenderPool.cpp
+//
+//
+//
+//
+
+#include "VisualizeRenderPool.h"
+
+//C++ Includes
+#include <cstdio>
+
+//POSIX Includes
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+using QualityControl::Timing::getString;
+
+using namespace QualityControl::Uniformity;
+
+//Default Constructor
+VisualizeRenderPool::VisualizeRenderPool(){
+
+} //End Default Constructor
+
+//Renders all stored jobs and writes the canvases into file_Results
+void VisualizeRenderPool::render(TFile * file_Results, int iNWorkers){
+    //Variable Declaration
+    int iStatus;
+
+    pid_t pid;
+
+    string strTempFileBase;
+
+    vector<pid_t> vec_pidWorkers;
+
+    TFile *file_Temp = NULL;
+
+    //Nothing to do?
+    if ( vec_jobs.size() == 0 ) return;
+
+    //Never fork more workers than jobs
+    if ( iNWorkers > (int)vec_jobs.size() ) { iNWorkers = vec_jobs.size(); }
+
+    //Serial Case: identical to calling the jobs by hand
+    //------------------------------------------------------
+    if ( iNWorkers <= 1 ) { //Case: Serial Rendering
+        for (auto iterJob = vec_jobs.begin(); iterJob != vec_jobs.end(); ++iterJob) {
+            (*iterJob).second(file_Results);
+        }
+
+        vec_jobs.clear();
+
+        return;
+    } //End Case: Serial Rendering
+
+    //Parallel Case: fork the workers
+    //------------------------------------------------------
+    strTempFileBase = file_Results->GetName();
+    if ( strTempFileBase.find(".root") != string::npos ) { strTempFileBase.erase( strTempFileBase.find(".root") ); }
+
+    printClassMethodMsg("VisualizeRenderPool","render", ( "Rendering " + getString( vec_jobs.size() ) + " canvas jobs with " + getString(iNWorkers) + " worker processes" ).c_str() );
+
+    //Remove left overs from a previous (crashed) rendering
+    for (int i=0; i < vec_jobs.size(); ++i) {
+        std::remove( getTempFileName(strTempFileBase, i).c_str() );
+    }
+
+    //Flush everything buffered so far so it is not duplicated by the workers
+    cout.flush();
+    fflush(stdout);
+    file_Results->Flush();
+
+    for (int i=0; i < iNWorkers; ++i) { //Loop Over Workers
+        pid = fork();
+
+        if ( pid == 0 ) { //Case: Worker Process
+            runWorker(i, iNWorkers, strTempFileBase);
+
+            //Skip static destructors & atexit handlers; ROOT would otherwise try to close the files the parent owns
+            _exit(0);
+        } //End Case: Worker Process
+        else if ( pid < 0 ) { //Case: fork failed
+            perror( "VisualizeRenderPool::render() - fork failed; remaining jobs will be rendered serially" );
+            break;
+        } //End Case: fork failed
+
+        vec_pidWorkers.push_back(pid);
+    } //End Loop Over Workers
+
+    //Wait for all workers
+    for (int i=0; i < vec_pidWorkers.size(); ++i) { //Loop Over Workers
+        if ( waitpid(vec_pidWorkers[i], &iStatus, 0) < 0 || !WIFEXITED(iStatus) || WEXITSTATUS(iStatus) != 0 ) {
+            printClassMethodMsg("VisualizeRenderPool","render", ( "Worker " + getString(i) + " did not finish cleanly; its missing jobs will be rendered serially" ).c_str() );
+        }
+    } //End Loop Over Workers
+
+    //Merge the output of each job into file_Results in job order
+    //------------------------------------------------------
+    for (int i=0; i < vec_jobs.size(); ++i) { //Loop Over Jobs
+        string strTempFileName = getTempFileName(strTempFileBase, i);
+
+        file_Temp = NULL;
+        if ( i % iNWorkers < vec_pidWorkers.size() && 0 == access(strTempFileName.c_str(), R_OK) ) {
+            file_Temp = new TFile(strTempFileName.c_str(), "READ", "", 1);
+        }
+
+        if ( file_Temp != NULL && file_Temp->IsOpen() && !file_Temp->IsZombie() ) { //Case: Job Rendered by Worker
+            mergeDirectory(file_Temp, file_Results);
+        } //End Case: Job Rendered by Worker
+        else{ //Case: Job Missing, Render Here
+            printClassMethodMsg("VisualizeRenderPool","render", ( "Rendering job " + vec_jobs[i].first + " serially" ).c_str() );
+
+            vec_jobs[i].second(file_Results);
+        } //End Case: Job Missing, Render Here
+
+        if ( file_Temp != NULL ) {
+            file_Temp->Close();
+            delete file_Temp;
+        }
+
+        std::remove( strTempFileName.c_str() );
+        std::remove( (strTempFileName + ".part").c_str() );
+    } //End Loop Over Jobs
+
+    vec_jobs.clear();
+
+    return;
+} //End VisualizeRenderPool::render()
+
+//Recursively copies every object (and sub-directory) of dir_Source into dir_Target
+void VisualizeRenderPool::mergeDirectory(TDirectory * dir_Source, TDirectory * dir_Target){
+    //Variable Declaration
+    TClass *class_Obj = NULL;
+
+    TDirectory *dir_SubTarget = NULL;
+
+    TKey *key = NULL;
+
+    TObject *obj = NULL;
+
+    TIter iterKey( dir_Source->GetListOfKeys() );
+
+    while ( ( key = (TKey*) iterKey() ) ) { //Loop Over Keys
+        class_Obj = gROOT->GetClass( key->GetClassName() );
+
+        if ( class_Obj != nullptr && class_Obj->InheritsFrom("TDirectory") ) { //Case: Sub-Directory
+            dir_SubTarget = dir_Target->GetDirectory( key->GetName(), false, "GetDirectory" );
+
+            if ( dir_SubTarget == nullptr ) { dir_SubTarget = dir_Target->mkdir( key->GetName() ); }
+
+            mergeDirectory( (TDirectory*) key->ReadObj(), dir_SubTarget );
+        } //End Case: Sub-Directory
+        else{ //Case: Object
+            obj = key->ReadObj();
+
+            dir_Target->cd();
+            obj->Write( key->GetName() );
+
+            delete obj;
+        } //End Case: Object
+    } //End Loop Over Keys
+
+    return;
+} //End VisualizeRenderPool::mergeDirectory()
+
+//Runs the jobs assigned to worker iWorker; only called in a forked process
+void VisualizeRenderPool::runWorker(int iWorker, int iNWorkers, string & strTempFileBase){
+    //Variable Declaration
+    TFile *file_Temp = NULL;
+
+    //Workers never open a display
+    gROOT->SetBatch(kTRUE);
+
+    for (int i=iWorker; i < vec_jobs.size(); i+=iNWorkers) { //Loop Over Jobs of this Worker
+        //Written under a different name & renamed once complete so a crash never leaves a partial file behind
+        string strTempFileName = getTempFileName(strTempFileBase, i);
+        string strPartFileName = strTempFileName + ".part";
+
+        file_Temp = new TFile( strPartFileName.c_str(), "RECREATE", "", 1);
+
+        if ( !file_Temp->IsOpen() || file_Temp->IsZombie() ) { //Case: failed to create temporary file
+            //Leave the job to the parent
+            delete file_Temp;
+            continue;
+        } //End Case: failed to create temporary file
+
+        vec_jobs[i].second(file_Temp);
+
+        file_Temp->Close();
+        delete file_Temp;
+
+        std::rename( strPartFileName.c_str(), strTempFileName.c_str() );
+    } //End Loop Over Jobs of this Worker
+
+    cout.flush();
+    fflush(stdout);
+
+    return;
+} //End VisualizeRenderPool::runWorker()
@@ -548,7 +548,7 @@ void VisualizeUniformity::storeCanvasFits(TFile * file_InputRootFile, std::strin
                 dir_SectorPhi = dir_SectorEta->mkdir( ( "SectorPhi" + getString( (*iterPhi).first ) ).c_str() );
             } //End Case: Directory did not exist in file, CREATE
             
-            hFitSucess2D->SetBinContent( (*iterPhi).first, iEta, (*iterPhi).second.fNFitSuccess / aSetup.iUniformityGranularity );
+            if ( (*iterPhi).second.map_slices.size() > 0 ) hFitSucess2D->SetBinContent( (*iterPhi).first, iEta, (*iterPhi).second.fNFitSuccess / (*iterPhi).second.map_slices.size() );
             
             for (auto iterSlice = (*iterPhi).second.map_slices.begin(); iterSlice != (*iterPhi).second.map_slices.end(); ++iterSlice) {
                 //Check to see if dir_Slice exists already, if not create it
@@ -1641,7 +1641,16 @@ void VisualizeUniformity::storeCanvasHisto2DHistorySegmented(TFile * file_InputR
             //        latex_EtaSector.SetTextSize(0.05);
             //        latex_EtaSector.DrawLatexNDC(0.125, 0.85, ( "i#eta = " + getString(iEta) ).c_str() );
             
-            hObs2D = getSummarizedRunHistoryHisto2D(map_hObs2DRunHistory, iEta, -1 );
+            if ( !map_hObs2DRunHistory.empty() ) { //Case: Full Run History
+                hObs2D = getSummarizedRunHistoryHisto2D(map_hObs2DRunHistory, iEta, -1 );
+            } //End Case: Full Run History
+            else{ //Case: Run History Summary
+                RunHistoryStore storeObs = getObsRunHistoryStore(strObsName, etaSector);
+                
+                if ( storeObs.empty() ) continue;
+                
+                hObs2D = make_shared<TH2F>( storeObs.getHisto2D( getNameByIndex(iEta, -1, -1, "h", strObsName + "_Summary"), strObsName ) );
+            } //End Case: Run History Summary
             
             //Setup the TLatex for this iEta sector
             //        TLatex latex_EtaSector;
@@ -1660,7 +1669,16 @@ void VisualizeUniformity::storeCanvasHisto2DHistorySegmented(TFile * file_InputR
             for (auto iterPhi = etaSector.map_sectorsPhi.begin(); iterPhi != etaSector.map_sectorsPhi.end(); ++iterPhi) { //Loop over phi sectors
                 map_hObs2DRunHistory = getMapObsHisto2D(strObsName, (*iterPhi).second );
                 
-                hObs2D = getSummarizedRunHistoryHisto2D(map_hObs2DRunHistory, iEta, (*iterPhi).first );
+                if ( !map_hObs2DRunHistory.empty() ) { //Case: Full Run History
+                    hObs2D = getSummarizedRunHistoryHisto2D(map_hObs2DRunHistory, iEta, (*iterPhi).first );
+                } //End Case: Full Run History
+                else{ //Case: Run History Summary
+                    RunHistoryStore storeObs = getObsRunHistoryStore(strObsName, (*iterPhi).second );
+                    
+                    if ( storeObs.empty() ) continue;
+                    
+                    hObs2D = make_shared<TH2F>( storeObs.getHisto2D( getNameByIndex(iEta, (*iterPhi).first, -1, "h", strObsName + "_Summary"), strObsName ) );
+                } //End Case: Run History Summary
                 
                 //Check if there is a new fMaxBinVal
                 if (fMaxBinVal < hObs2D->GetBinContent(hObs2D->GetMaximumBin() ) ) {
@@ -2196,10 +2214,30 @@ std::map<int, std::shared_ptr<TH2F> > VisualizeUniformity::getMapObsHisto2D(std:
     return ret_map;
 } //End VisualizeUniformity::getMapObsHisto2D()
 
+//Returns the run history summary of strObsName; an empty store if the observable has none
+RunHistoryStore VisualizeUniformity::getObsRunHistoryStore(std::string strObsName, Uniformity::ReadoutSector &inputSector){
+    std::transform(strObsName.begin(),strObsName.end(),strObsName.begin(),toupper);
+    
+    if (0 == strObsName.compare("HISTORYCLUSTADC") ) { //Case: Cluster ADC's
+        return inputSector.clustHistos.storeADC_v_Run;
+    } //End Case: Cluster ADC's
+    else if (0 == strObsName.compare("HISTORYCLUSTTIME") ) { //Case: Cluster Time
+        return inputSector.clustHistos.storeTime_v_Run;
+    } //End Case: Cluster Time
+    else if (0 == strObsName.compare("HISTORYHITADC") ) { //Case: Hit ADC
+        return inputSector.hitHistos.storeADC_v_Run;
+    } //End Case: Hit ADC
+    else if (0 == strObsName.compare("HISTORYHITTIME") ) { //Case: Hit Time
+        return inputSector.hitHistos.storeTime_v_Run;
+    } //End Case: Hit Time
+    
+    return RunHistoryStore();
+} //End VisualizeUniformity::getObsRunHistoryStore()
+
 //Summarizes a map of run history histograms
 //There are no checks to make sure the map does not return a null pointer
 //At this stage if it returns a null pointer there was a problem elsewhere!
-shared_ptr<TH2F> VisualizeUniformity::getSummarizedRunHistoryHisto2D(map<int, shared_ptr<TH2F> > inputMapHisto2D, int iEta, int iPhi ){
+shared_ptr<TH2F> VisualizeUniformity::getSummarizedRunHistoryHisto2D(map<int, shared_ptr<TH2F> > & inputMapHisto2D, int iEta, int iPhi ){
     //Variable Declaration
     Timing::HistoSetup setupHisto_RunHistory_X, setupHisto_RunHistory_Y;
     
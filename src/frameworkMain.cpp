@@ -20,6 +20,7 @@
 //Framework Includes
 #include "DetectorMPGD.h"   //Needs to be included before AnalyzeResponseUniformity.h and ParameterloadDetectorSRS.h
 #include "InterfaceAnalysis.h"
+#include "Logger.h"
 #include "ParameterLoaderDetector.h"
 #include "ParameterLoaderAnalysis.h"
 #include "ParameterLoaderRun.h"
@@ -77,6 +78,7 @@ void printHelpMenu(){
     cout<<"\t These input files must be have been produced when running with a 'run info' header\n";
     cout<<endl;
     cout<<"\tIf running reconstruction the input must be an RD51 SRS output file (e.g. *.raw)\n";
+    cout<<"\t\tit may be compressed (gzip, zstd, lz4) or a member of a tar archive given as archive.tar:member.raw\n";
     cout<<"\tFor each call of the executable only one *.raw file should be in the input run list\n";
     cout<<endl;
     cout<<"\tIf you have both a 'run info' and a 'compare info' header only the last one will be used\n";
@@ -95,6 +97,7 @@ void printHelpMenu(){
     cout<<"\t\t...\n";
     cout<<"\t\t<PHYSICAL FILENAME OF INPUT FILE N>\n";
     cout<<"\t[END_RUN_LIST]\n";
+    cout<<"\tEach line may be a comma separated list of filenames and/or glob patterns (e.g. /data/Det_Run3870_*.raw)\n";
     
     //Header - Run Info
     cout<<endl;
@@ -108,6 +111,8 @@ void printHelpMenu(){
     cout<<"\t\tConfig_Analysis = '<PHYSICAL FILENAME OF ANALYSIS CONFIG FILE>'\n";
     cout<<"\t\tConfig_Mapping = '<PHYSICAL FILENAME OF MAPPING CONFIG FILE>';\n";
     cout<<"\t\tDetector_Name = '<DETECTOR SERIAL NUMBER WITHOUT / CHAR>';\n";
+    cout<<"\t\tInput_Chain = '<READ THE FILES OF ONE RUN LIST LINE AS ONE RUN true/false>';\n";
+    cout<<"\t\tInput_Chain_NThreads = '<THREADS USED TO OPEN THE FILES OF A CHAINED RUN>';\n";
     cout<<"\t\tInput_Is_Frmwrk_Output = '<ANALYZE PREVIOUS OUTPUT true/false>';\n";
     cout<<"\t\tInput_Identifier = '<STRING IDENTIFIER FOUND IN FILENAME>';\n";
     cout<<"\t\tOutput_File_Name = '<OUTPUT ROOT FILE NAME>';\n";
@@ -117,6 +122,7 @@ void printHelpMenu(){
     cout<<"\t\tAna_Hits = '<PERFORM THE HIT ANALYSIS true/false>';\n";
     cout<<"\t\tAna_Clusters = '<PERFORM THE CLUSTER ANALYSIS true/false>';\n";
     cout<<"\t\tAna_Fitting = '<FIT OUTPUT HISTOGRAMS true/false>';\n";
+    cout<<"\t\tAna_NThreads = '<THREADS THE SELECTION & FILLING OF ONE RUN IS SPLIT OVER>';\n";
     cout<<"\t\tVisualize_AutoSaveImages = '<SAVE CANVASES AS *.PDF & *.PNG true/false>';\n";
     cout<<"\t\tVisualize_DrawPhiLines = '<DENOTE IPHI REGIONS IN SUMMARY PLOTS true/false>';\n";
     cout<<"\t\tVisualize_Plots = '<MAKE SUMMARY PLOTS true/false>';\n";
@@ -239,7 +245,10 @@ void runModeAnalysis(RunSetup & rSetup, vector<string> & vec_strInputFiles, vect
 } //End runModeAnalysis()
 
 //Performs the Reconstruction
-void runModeReconstruction(RunSetup & rSetup, vector<pair<int, string> > & vec_pairedRunList){
+//bSelectDetector: keep only the tree of rSetup.strDetName when the reco config writes one tree per detector (the analysis handles a single detector)
+void runModeReconstruction(RunSetup & rSetup, vector<pair<int, string> > & vec_pairedRunList, bool bSelectDetector){
+    vector<pair<int, string> > vec_pairedTreeList;
+    
     for (auto iterRun = vec_pairedRunList.begin(); iterRun != vec_pairedRunList.end(); ++iterRun) { //Loop Over input Runs
         //C++14 only
         //unique_ptr<SRSMain> recoInterface = make_unique<SRSMain>(& SRSMain::Reprocessor( (*iterRun).second, rSetup.strFile_Config_Reco ) );
@@ -247,16 +256,32 @@ void runModeReconstruction(RunSetup & rSetup, vector<pair<int, string> > & vec_p
         unique_ptr<SRSMain> recoInterface(new SRSMain( (*iterRun).second, rSetup.strFile_Config_Reco ) );
         recoInterface->Reprocess();
         
-        //remove the *.raw from the filename, append with _dataTree.root
-        if ( (*iterRun).second.find(".raw") != std::string::npos ) {
-            (*iterRun).second.erase((*iterRun).second.find(".raw"), (*iterRun).second.length() - (*iterRun).second.find(".raw") );
-            (*iterRun).second = (*iterRun).second + "_dataTree.root";
-        }
+        //the tree files written by the reconstruction (*.raw removed, archive member or event range taken into account),
+        //one per detector if the reco config splits them
+        vector<string> vec_strOutputFiles = recoInterface->GetOutputFiles();
+        vector<string> vec_strOutputDets = recoInterface->GetOutputDetectors();
+        bool bFoundDetector = false;
+        for (int i=0; i < vec_strOutputFiles.size(); ++i) { //Loop Over Output Trees
+            if ( bSelectDetector && !vec_strOutputDets[i].empty() && 0 != vec_strOutputDets[i].compare( rSetup.strDetName ) ) { //Case: Tree of Another Detector
+                cout<<"runModeReconstruction() - Skipping " << vec_strOutputFiles[i] << ", detector " << vec_strOutputDets[i] << " is not the analyzed detector " << rSetup.strDetName << endl;
+                continue;
+            } //End Case: Tree of Another Detector
+            
+            bFoundDetector = true;
+            vec_pairedTreeList.push_back(std::make_pair( (*iterRun).first, vec_strOutputFiles[i] ) );
+        } //End Loop Over Output Trees
+        
+        if (!bFoundDetector) { //Case: Analyzed Detector Not Reconstructed
+            cout<<"runModeReconstruction() - No tree of detector " << rSetup.strDetName << " written for " << (*iterRun).second << ", run skipped!\n";
+            cout<<"\tPlease check the detector name against the mapping file of the reco config.\n";
+        } //End Case: Analyzed Detector Not Reconstructed
         
         //Delete the interface
         recoInterface.reset();
     } //End Loop Over input Runs
     
+    vec_pairedRunList = vec_pairedTreeList;
+    
     return;
 } //End runModeReconstruction()
 
@@ -303,6 +328,9 @@ int main( int argc_, char * argv_[] ){
             
             return -2;
         } //End Case: Input Not Understood
+        
+        //Verbose mode also prints the debug messages of the logger
+        if (bVerboseMode) Logger::getInstance().setLevel(kLogDebug);
 
         //Set the run config file
         //strFile_Config_Run = vec_strInputArgs[1];
@@ -364,7 +392,7 @@ int main( int argc_, char * argv_[] ){
         
     } //End Case: Framework Input
     else { //Case: amoreSRS Input
-        vec_pairedRunList = loaderRun.getPairedRunList(file_Config, rSetup.strIdent, bVerboseMode);
+        vec_pairedRunList = loaderRun.getPairedRunList(file_Config, rSetup.strIdent, bVerboseMode, rSetup.bInputChain);
         
         //Check if
         if (vec_pairedRunList.size() == 0) {
@@ -422,7 +450,9 @@ int main( int argc_, char * argv_[] ){
         
         visualizeComp.setDrawOption(rSetup.strDrawOption);
         visualizeComp.setIdentifier(rSetup.strIdent);
+        visualizeComp.setInputCacheSize(rSetup.iComp_CacheSize);
         visualizeComp.setInputFiles(vec_strInputFiles);
+        visualizeComp.setInputNThreads(rSetup.iComp_NThreads);
         visualizeComp.setNormalize(rSetup.bDrawNormalized);
         visualizeComp.setPosFull(rSetup.iEta, rSetup.iPhi, rSetup.iSlice );
         
@@ -444,11 +474,11 @@ int main( int argc_, char * argv_[] ){
             recoInterface.reset();
         } //End Loop Over input Runs*/
         
-        runModeReconstruction(rSetup, vec_pairedRunList);
+        runModeReconstruction(rSetup, vec_pairedRunList, false);
     } //End Run Mode: Reconstruction
     else if ( 0 == rSetup.strRunMode.compare( m_modes_run.m_strRecoNAna) ) { //Run Mode: Reconstruction & Analysis
         //Reconstruct Events
-        runModeReconstruction(rSetup, vec_pairedRunList);
+        runModeReconstruction(rSetup, vec_pairedRunList, true);
 
         //Analyze Events
         runModeAnalysis(rSetup, vec_strInputFiles, vec_pairedRunList, bVerboseMode);
@@ -461,6 +491,9 @@ int main( int argc_, char * argv_[] ){
         return -5;
     } //End Run Mode: Unrecognized
     
+    //Counters & lines dropped by the rate limit
+    Logger::getInstance().printSummary();
+    
     cout<<"Finished!"<<endl;
     
     return 0;
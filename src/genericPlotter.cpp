@@ -15,6 +15,7 @@
 
 //Framework Includes
 #include "ParameterLoaderPlotter.h"
+#include "PlotterBatch.h"
 #include "PlotterGraph.h"
 #include "PlotterGraph2D.h"
 #include "PlotterGraphErrors.h"
@@ -33,6 +34,8 @@ using std::string;
 using std::vector;
 
 using QualityControl::Timing::convert2bool;
+using QualityControl::Timing::getCharSeparatedList;
+using QualityControl::Timing::stoiSafe;
 using QualityControl::Timing::printStreamStatus;
 
 using namespace QualityControl::Plotter;
@@ -163,6 +166,29 @@ int main( int argc_, char * argv_[] ){
         
         return 0;
     } //End Case: Help Menu
+    else if (vec_strInputArgs.size() >= 5 && vec_strInputArgs[1].compare("--batch") == 0) { //Case: Batch Image Export
+        //Usage: ./genericPlotter --batch <Image Formats, e.g. png,pdf,svg> <Number of Workers> <Plot Config File> [<Plot Config File> ...]
+        PlotterBatch batchPlotter;
+        
+        batchPlotter.setImgFormats( getCharSeparatedList(vec_strInputArgs[2], ',') );
+        batchPlotter.setNWorkers( stoiSafe("Number of Workers", vec_strInputArgs[3]) );
+        
+        for (int i=4; i < vec_strInputArgs.size(); ++i) {
+            batchPlotter.addConfig( vec_strInputArgs[i] );
+        }
+        
+        int iNFailures = batchPlotter.render();
+        
+        if (iNFailures > 0) {
+            cout<<"main() - " << iNFailures << " of " << batchPlotter.getNumConfigs() << " plot config files could not be plotted\n";
+            
+            return -4;
+        }
+        
+        cout<<"Finished\n";
+        
+        return 0;
+    } //End Case: Batch Image Export
     else if(vec_strInputArgs.size() == 3){ //Case: Analysis!
         bool bExitSuccess = false;
         